@@ -7,9 +7,15 @@
 #pragma once
 
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/Memory.h"
 #include "MantidKernel/SingletonHolder.h"
 #include "MantidKernel/Timer.h"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -20,15 +26,42 @@ namespace Instrumentation {
 
 /** AlgoTimeRegister : simple class to dump information about executed
  * algorithms
+ *
+ * With performancelog.write on, the start and end of each algorithm are
+ * appended to performancelog.filename. With performancelog.trace on, each
+ * execution is also kept as a Span, nested under the algorithm that ran it on
+ * the same thread, for export as a Chrome trace (chrome://tracing or Perfetto)
+ * to performancelog.tracefilename and for summaryTable(). Both settings are
+ * read as each algorithm starts so they can be changed at any time.
  */
 class MANTID_API_DLL AlgoTimeRegisterImpl {
 public:
   AlgoTimeRegisterImpl(const AlgoTimeRegisterImpl &) = delete;
   AlgoTimeRegisterImpl &operator=(const AlgoTimeRegisterImpl &) = delete;
 
+  /// One algorithm execution recorded for the trace
+  struct Span {
+    std::string name;
+    std::thread::id threadId;
+    /// Numbered from 1 in the order the spans started
+    size_t id{0};
+    /// Id of the enclosing span, or 0 at the top level
+    size_t parentId{0};
+    size_t depth{0};
+    Kernel::time_point_ns begin;
+    Kernel::time_point_ns end;
+    /// CPU time used by the whole process while the span was open
+    double cpuSeconds{0.};
+    /// Change in the resident memory of the process, in bytes
+    int64_t memoryChange{0};
+    /// Totals passed to addCounter(), e.g. events or bytes read
+    std::map<std::string, double> counters;
+  };
+
   class Dump {
     Kernel::time_point_ns m_regStart_chrono;
     const std::string m_name;
+    std::unique_ptr<Span> m_span;
 
   public:
     Dump(const std::string &nm);
@@ -39,6 +72,13 @@ public:
                const Kernel::time_point_ns &end);
   void addTime(const std::string &name, const Kernel::time_point_ns &begin, const Kernel::time_point_ns &end);
 
+  void addCounter(const std::string &name, const double value);
+  std::vector<Span> getSpans() const;
+  void clearSpans();
+  std::string traceEvents() const;
+  std::string summaryTable() const;
+  bool writeTrace(const std::string &filename) const;
+
   std::mutex m_mutex;
 
 private:
@@ -48,10 +88,23 @@ private:
   ~AlgoTimeRegisterImpl();
 
   bool writeToFile();
+  std::unique_ptr<Span> beginSpan(const std::string &name, const Kernel::time_point_ns &begin);
+  void endSpan(std::unique_ptr<Span> span, const Kernel::time_point_ns &end);
 
   Kernel::time_point_ns m_start;
   std::string m_filename;
   bool m_hasWrittenToFile;
+
+  /// Finished spans, in the order they finished
+  std::vector<Span> m_spans;
+  /// Id of the last span started
+  std::atomic<size_t> m_lastSpanId;
+  /// Where the trace is written on exit
+  std::string m_traceFilename;
+  /// Reads the resident memory of the process
+  Kernel::MemoryStats m_memoryStats;
+  /// Protects the spans and trace filename
+  mutable std::mutex m_spanMutex;
 };
 
 using AlgoTimeRegister = Mantid::Kernel::SingletonHolder<AlgoTimeRegisterImpl>;
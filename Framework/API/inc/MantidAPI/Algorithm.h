@@ -207,6 +207,7 @@ public:
   void initialize() override;
   bool execute() override final;
   void addTimer(const std::string &name, const Kernel::time_point_ns &begin, const Kernel::time_point_ns &end);
+  void addCounter(const std::string &name, const double value);
   void executeAsChildAlg() override;
   std::map<std::string, std::string> validateInputs() override;
 
@@ -5,10 +5,16 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAPI/AlgoTimeRegister.h"
+#include "MantidJson/Json.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/MultiThreaded.h"
+#include <algorithm>
+#include <ctime>
 #include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <time.h>
+#include <unordered_map>
 
 namespace Mantid {
 namespace Instrumentation {
@@ -18,19 +24,33 @@ Kernel::Logger &LOGGER() {
   static Kernel::Logger logger("AlgoTimeRegister");
   return logger;
 }
+
+/// The spans open on this thread, innermost last
+thread_local std::vector<AlgoTimeRegisterImpl::Span *> g_openSpans;
+
+/// @return the CPU time used by the process so far, in seconds
+double processCPUSeconds() { return static_cast<double>(std::clock()) / CLOCKS_PER_SEC; }
+
+/// @return a duration in microseconds, the unit of the trace-event format
+double toMicroseconds(const std::chrono::nanoseconds duration) {
+  return static_cast<double>(duration.count()) / 1000.;
+}
 } // namespace
 
 using Kernel::ConfigService;
 using Kernel::time_point_ns;
 
 AlgoTimeRegisterImpl::Dump::Dump(const std::string &nm)
-    : m_regStart_chrono(std::chrono::high_resolution_clock::now()), m_name(nm) {}
+    : m_regStart_chrono(std::chrono::high_resolution_clock::now()), m_name(nm),
+      m_span(AlgoTimeRegister::Instance().beginSpan(nm, m_regStart_chrono)) {}
 
 AlgoTimeRegisterImpl::Dump::~Dump() {
   const time_point_ns regFinish = std::chrono::high_resolution_clock::now();
   {
     AlgoTimeRegister::Instance().addTime(m_name, std::this_thread::get_id(), m_regStart_chrono, regFinish);
   }
+  if (m_span)
+    AlgoTimeRegister::Instance().endSpan(std::move(m_span), regFinish);
 }
 
 void AlgoTimeRegisterImpl::addTime(const std::string &name, const Kernel::time_point_ns &begin,
@@ -89,10 +109,177 @@ void AlgoTimeRegisterImpl::addTime(const std::string &name, const std::thread::i
   }
 }
 
+/** Open a span for the trace if performancelog.trace is on
+ * @param name :: name of the algorithm
+ * @param begin :: when it started
+ * @return the span, or nullptr if tracing is off
+ */
+std::unique_ptr<AlgoTimeRegisterImpl::Span> AlgoTimeRegisterImpl::beginSpan(const std::string &name,
+                                                                            const Kernel::time_point_ns &begin) {
+  if (!ConfigService::Instance().getValue<bool>("performancelog.trace").value_or(false))
+    return nullptr;
+  const auto traceFilename = ConfigService::Instance().getString("performancelog.tracefilename");
+  {
+    std::lock_guard<std::mutex> lock(m_spanMutex);
+    m_traceFilename = traceFilename;
+  }
+
+  auto span = std::make_unique<Span>();
+  span->name = name;
+  span->threadId = std::this_thread::get_id();
+  span->id = ++m_lastSpanId;
+  if (!g_openSpans.empty()) {
+    span->parentId = g_openSpans.back()->id;
+    span->depth = g_openSpans.back()->depth + 1;
+  }
+  span->begin = begin;
+  // Hold the starting values until endSpan() takes the difference
+  span->cpuSeconds = -processCPUSeconds();
+  span->memoryChange = -static_cast<int64_t>(m_memoryStats.getCurrentRSS());
+  g_openSpans.emplace_back(span.get());
+  return span;
+}
+
+/** Close a span and keep it for the trace
+ * @param span :: the span from beginSpan()
+ * @param end :: when the algorithm finished
+ */
+void AlgoTimeRegisterImpl::endSpan(std::unique_ptr<Span> span, const Kernel::time_point_ns &end) {
+  span->end = end;
+  span->cpuSeconds += processCPUSeconds();
+  span->memoryChange += static_cast<int64_t>(m_memoryStats.getCurrentRSS());
+  // Spans close in reverse order on a thread, so this is normally the last one
+  const auto open = std::find(g_openSpans.rbegin(), g_openSpans.rend(), span.get());
+  if (open != g_openSpans.rend())
+    g_openSpans.erase(std::next(open).base());
+
+  std::lock_guard<std::mutex> lock(m_spanMutex);
+  m_spans.emplace_back(std::move(*span));
+}
+
+/** Add to a counter of the innermost algorithm running on this thread, for
+ * example the number of events or spectra processed or bytes read. Does
+ * nothing if no span is open.
+ * @param name :: name of the counter
+ * @param value :: amount to add to it
+ */
+void AlgoTimeRegisterImpl::addCounter(const std::string &name, const double value) {
+  if (!g_openSpans.empty())
+    g_openSpans.back()->counters[name] += value;
+}
+
+/// @return a copy of the finished spans
+std::vector<AlgoTimeRegisterImpl::Span> AlgoTimeRegisterImpl::getSpans() const {
+  std::lock_guard<std::mutex> lock(m_spanMutex);
+  return m_spans;
+}
+
+/// Forget the finished spans
+void AlgoTimeRegisterImpl::clearSpans() {
+  std::lock_guard<std::mutex> lock(m_spanMutex);
+  m_spans.clear();
+}
+
+/** The finished spans in the Chrome trace-event format, as complete ("X")
+ * events with one track per thread
+ * @return the trace as a JSON string
+ */
+std::string AlgoTimeRegisterImpl::traceEvents() const {
+  const auto spans = getSpans();
+  std::unordered_map<std::thread::id, ::Json::UInt> threadNumbers;
+  ::Json::Value events(::Json::arrayValue);
+  for (const auto &span : spans) {
+    const auto nextNumber = static_cast<::Json::UInt>(threadNumbers.size());
+    const auto threadNumber = threadNumbers.try_emplace(span.threadId, nextNumber).first->second;
+    ::Json::Value event;
+    event["name"] = span.name;
+    event["cat"] = "algorithm";
+    event["ph"] = "X";
+    event["pid"] = 0;
+    event["tid"] = threadNumber;
+    event["ts"] = toMicroseconds(span.begin - m_start);
+    event["dur"] = toMicroseconds(span.end - span.begin);
+    ::Json::Value args;
+    args["id"] = ::Json::UInt64(span.id);
+    args["parent"] = ::Json::UInt64(span.parentId);
+    args["cpu_seconds"] = span.cpuSeconds;
+    args["memory_change_bytes"] = ::Json::Int64(span.memoryChange);
+    for (const auto &[counter, value] : span.counters)
+      args[counter] = value;
+    event["args"] = args;
+    events.append(event);
+  }
+  ::Json::Value root;
+  root["traceEvents"] = events;
+  root["displayTimeUnit"] = "ms";
+  return JsonHelpers::jsonToString(root);
+}
+
+/** A table of the finished spans by algorithm, slowest first. Self time
+ * excludes child algorithms; threads is the CPU time over the wall time.
+ * @return the table as text
+ */
+std::string AlgoTimeRegisterImpl::summaryTable() const {
+  const auto spans = getSpans();
+  std::unordered_map<size_t, double> childSeconds;
+  for (const auto &span : spans) {
+    if (span.parentId != 0)
+      childSeconds[span.parentId] += std::chrono::duration<double>(span.end - span.begin).count();
+  }
+
+  struct Row {
+    size_t calls{0};
+    double total{0.};
+    double self{0.};
+    double cpu{0.};
+  };
+  std::map<std::string, Row> rows;
+  for (const auto &span : spans) {
+    const double seconds = std::chrono::duration<double>(span.end - span.begin).count();
+    auto &row = rows[span.name];
+    ++row.calls;
+    row.total += seconds;
+    row.self += seconds - childSeconds[span.id];
+    row.cpu += span.cpuSeconds;
+  }
+  std::vector<std::pair<std::string, Row>> sorted(rows.begin(), rows.end());
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const auto &lhs, const auto &rhs) { return lhs.second.total > rhs.second.total; });
+
+  std::ostringstream table;
+  table << std::left << std::setw(40) << "Algorithm" << std::right << std::setw(8) << "Calls" << std::setw(12)
+        << "Total (s)" << std::setw(12) << "Self (s)" << std::setw(12) << "Mean (s)" << std::setw(10) << "Threads"
+        << '\n';
+  table << std::fixed << std::setprecision(3);
+  for (const auto &[name, row] : sorted) {
+    table << std::left << std::setw(40) << name << std::right << std::setw(8) << row.calls << std::setw(12)
+          << row.total << std::setw(12) << row.self << std::setw(12) << row.total / static_cast<double>(row.calls)
+          << std::setw(10) << std::setprecision(1) << (row.total > 0. ? row.cpu / row.total : 0.)
+          << std::setprecision(3) << '\n';
+  }
+  return table.str();
+}
+
+/** Write traceEvents() to a file
+ * @param filename :: the file to write
+ * @return true if the file was written
+ */
+bool AlgoTimeRegisterImpl::writeTrace(const std::string &filename) const {
+  std::ofstream fs(filename);
+  if (!fs)
+    return false;
+  fs << traceEvents();
+  return static_cast<bool>(fs);
+}
+
 AlgoTimeRegisterImpl::AlgoTimeRegisterImpl()
-    : m_start(std::chrono::high_resolution_clock::now()), m_hasWrittenToFile(false) {}
+    : m_start(std::chrono::high_resolution_clock::now()), m_hasWrittenToFile(false), m_lastSpanId(0) {}
 
-AlgoTimeRegisterImpl::~AlgoTimeRegisterImpl() {}
+AlgoTimeRegisterImpl::~AlgoTimeRegisterImpl() {
+  // Services such as logging may already be gone, so failure is silent
+  if (!m_spans.empty() && !m_traceFilename.empty())
+    writeTrace(m_traceFilename);
+}
 
 } // namespace Instrumentation
 } // namespace Mantid
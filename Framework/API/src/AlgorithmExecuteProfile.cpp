@@ -30,5 +30,14 @@ void Algorithm::addTimer(const std::string &name, const Kernel::time_point_ns &b
                          const Kernel::time_point_ns &end) {
   Instrumentation::AlgoTimeRegister::Instance().addTime(name, begin, end);
 }
+
+/** Add to a counter in the performance trace of this execution, e.g. the
+ * number of events loaded. Does nothing unless performancelog.trace is on.
+ * @param name :: name of the counter
+ * @param value :: amount to add to it
+ */
+void Algorithm::addCounter(const std::string &name, const double value) {
+  Instrumentation::AlgoTimeRegister::Instance().addCounter(name, value);
+}
 } // namespace API
 } // namespace Mantid
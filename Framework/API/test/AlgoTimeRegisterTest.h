@@ -8,6 +8,7 @@
 #pragma once
 
 #include "MantidAPI/AlgoTimeRegister.h"
+#include "MantidJson/Json.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
@@ -17,6 +18,7 @@
 #include <sstream>
 
 using Mantid::Instrumentation::AlgoTimeRegister;
+using Mantid::Instrumentation::AlgoTimeRegisterImpl;
 using Mantid::Kernel::ConfigService;
 
 class AlgoTimeRegisterTest : public CxxTest::TestSuite {
@@ -190,6 +192,71 @@ public:
     TS_ASSERT(!std::filesystem::exists(m_directory + "noWrite.log"));
   }
 
+  void test_nested_spans_are_traced() {
+    ConfigService::Instance().setString("performancelog.trace", "On");
+    auto &timeRegister = AlgoTimeRegister::Instance();
+    timeRegister.clearSpans();
+    {
+      AlgoTimeRegisterImpl::Dump parent("Parent");
+      timeRegister.addCounter("Spectra", 10);
+      {
+        AlgoTimeRegisterImpl::Dump child("Child");
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        timeRegister.addCounter("Events", 5);
+        timeRegister.addCounter("Events", 2);
+      }
+      timeRegister.addCounter("Spectra", 1);
+    }
+    ConfigService::Instance().setString("performancelog.trace", "Off");
+
+    const auto spans = timeRegister.getSpans();
+    TS_ASSERT_EQUALS(spans.size(), 2);
+    if (spans.size() != 2)
+      return;
+    // The child finishes first
+    const auto &child = spans[0];
+    const auto &parent = spans[1];
+    TS_ASSERT_EQUALS(child.name, "Child");
+    TS_ASSERT_EQUALS(parent.name, "Parent");
+    TS_ASSERT_EQUALS(parent.parentId, 0);
+    TS_ASSERT_EQUALS(parent.depth, 0);
+    TS_ASSERT_EQUALS(child.parentId, parent.id);
+    TS_ASSERT_EQUALS(child.depth, 1);
+    TS_ASSERT(parent.begin <= child.begin && child.end <= parent.end);
+    TS_ASSERT_EQUALS(child.counters.at("Events"), 7.);
+    TS_ASSERT_EQUALS(parent.counters.at("Spectra"), 11.);
+    TS_ASSERT_EQUALS(parent.counters.count("Events"), 0);
+
+    ::Json::Value trace;
+    TS_ASSERT(Mantid::JsonHelpers::parse(timeRegister.traceEvents(), &trace));
+    const auto &events = trace["traceEvents"];
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0]["name"].asString(), "Child");
+    TS_ASSERT_EQUALS(events[0]["ph"].asString(), "X");
+    TS_ASSERT_EQUALS(events[0]["args"]["Events"].asDouble(), 7.);
+    TS_ASSERT_LESS_THAN_EQUALS(events[0]["dur"].asDouble(), events[1]["dur"].asDouble());
+
+    const auto table = timeRegister.summaryTable();
+    TS_ASSERT_DIFFERS(table.find("Parent"), std::string::npos);
+    // Slowest first
+    TS_ASSERT_LESS_THAN(table.find("Parent"), table.find("Child"));
+
+    TS_ASSERT(timeRegister.writeTrace(m_directory + "trace.json"));
+    TS_ASSERT(std::filesystem::exists(m_directory + "trace.json"));
+    timeRegister.clearSpans();
+  }
+
+  void test_nothing_is_traced_when_trace_is_off() {
+    ConfigService::Instance().setString("performancelog.trace", "Off");
+    auto &timeRegister = AlgoTimeRegister::Instance();
+    timeRegister.clearSpans();
+    {
+      AlgoTimeRegisterImpl::Dump dump("Untraced");
+      timeRegister.addCounter("Events", 1);
+    }
+    TS_ASSERT(timeRegister.getSpans().empty());
+  }
+
 private:
   const std::string m_directory = "AlgoTimeRegisterTest/";
   std::mutex m_mutex;
@@ -148,7 +148,8 @@ private:
   std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> fitPeaks();
 
   /// fit peaks in a same spectrum
-  void fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_peak_centers,
+  void fitSpectrumPeaks(size_t wi, const API::IAlgorithm_sptr &peak_fitter,
+                        const std::vector<double> &expected_peak_centers,
                         const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
                         std::vector<std::vector<double>> &lastGoodPeakParameters,
                         std::vector<size_t> &lastGoodPeakSpectra,
@@ -173,6 +174,9 @@ private:
   double fitFunctionMD(API::IFunction_sptr fit_function, const API::MatrixWorkspace_sptr &dataws, const size_t wsindex,
                        const std::pair<double, double> &vec_xmin, const std::pair<double, double> &vec_xmax);
 
+  /// create the child algorithm Fit set up for fitting peaks
+  API::IAlgorithm_sptr createFitAlgorithm(const bool calcErrors);
+
   /// fit a single peak with high background
   double fitFunctionHighBackground(const API::IAlgorithm_sptr &fit, const std::pair<double, double> &fit_window,
                                    const size_t &ws_index, const double &expected_peak_center, bool observe_peak_shape,
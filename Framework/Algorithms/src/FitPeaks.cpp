@@ -1013,6 +1013,9 @@ std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> FitPeaks::fitPeak
                                                             std::vector<double>(m_peakFunction->nParams(), 0.0));
     // track which spectrum index last successfully fitted each peak
     std::vector<size_t> lastGoodPeakSpectra(m_numPeaksToFit, 0);
+    // one Fit for all the peaks of all the spectra of this thread, to save
+    // setting up a child algorithm for every spectrum
+    IAlgorithm_sptr peak_fitter = createFitAlgorithm(m_fitErrorTable != nullptr);
 
     for (auto wi = iws_begin; wi < iws_end; ++wi) {
       // peaks to fit
@@ -1026,8 +1029,8 @@ std::vector<std::shared_ptr<FitPeaksAlgorithm::PeakFitResult>> FitPeaks::fitPeak
       std::shared_ptr<FitPeaksAlgorithm::PeakFitPreCheckResult> spectrum_pre_check_result =
           std::make_shared<FitPeaksAlgorithm::PeakFitPreCheckResult>();
 
-      fitSpectrumPeaks(static_cast<size_t>(wi), expected_peak_centers, fit_result, lastGoodPeakParameters,
-                       lastGoodPeakSpectra, spectrum_pre_check_result);
+      fitSpectrumPeaks(static_cast<size_t>(wi), peak_fitter, expected_peak_centers, fit_result,
+                       lastGoodPeakParameters, lastGoodPeakSpectra, spectrum_pre_check_result);
 
       PARALLEL_CRITICAL(FindPeaks_WriteOutput) {
         writeFitResult(static_cast<size_t>(wi), expected_peak_centers, fit_result);
@@ -1152,7 +1155,8 @@ private:
 //----------------------------------------------------------------------------------------------
 /** Fit peaks across one single spectrum
  */
-void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_peak_centers,
+void FitPeaks::fitSpectrumPeaks(size_t wi, const API::IAlgorithm_sptr &peak_fitter,
+                                const std::vector<double> &expected_peak_centers,
                                 const std::shared_ptr<FitPeaksAlgorithm::PeakFitResult> &fit_result,
                                 std::vector<std::vector<double>> &lastGoodPeakParameters,
                                 std::vector<size_t> &lastGoodPeakSpectra,
@@ -1167,25 +1171,9 @@ void FitPeaks::fitSpectrumPeaks(size_t wi, const std::vector<double> &expected_p
     return;
   }
 
-  // Set up sub algorithm Fit for peak and background
-  IAlgorithm_sptr peak_fitter; // both peak and background (combo)
-  try {
-    peak_fitter = createChildAlgorithm("Fit", -1, -1, false);
-  } catch (Exception::NotFoundError &) {
-    std::stringstream errss;
-    errss << "The FitPeak algorithm requires the CurveFitting library";
-    g_log.error(errss.str());
-    throw std::runtime_error(errss.str());
-  }
-
   // Clone background function
   IBackgroundFunction_sptr bkgdfunction = std::dynamic_pointer_cast<API::IBackgroundFunction>(m_bkgdFunction->clone());
 
-  // set up properties of algorithm (reference) 'Fit'
-  peak_fitter->setProperty("Minimizer", m_minimizer);
-  peak_fitter->setProperty("CostFunction", m_costFunction);
-  peak_fitter->setProperty("CalcErrors", true);
-
   const double x0 = m_inputMatrixWS->histogram(wi).x().front();
   const double xf = m_inputMatrixWS->histogram(wi).x().back();
 
@@ -1777,13 +1765,17 @@ double FitPeaks::fitFunctionSD(const IAlgorithm_sptr &fit, const API::IPeakFunct
                                const API::MatrixWorkspace_sptr &dataws, size_t wsindex,
                                const std::pair<double, double> &peak_range, const double &expected_peak_center,
                                bool estimate_peak_width, bool estimate_background) {
-  std::stringstream errorid;
-  errorid << "(WorkspaceIndex=" << wsindex << " PeakCentre=" << expected_peak_center << ")";
+  // only built when there is something to report, as it is needed for few of the fits
+  auto errorid = [wsindex, &expected_peak_center]() {
+    std::stringstream id;
+    id << "(WorkspaceIndex=" << wsindex << " PeakCentre=" << expected_peak_center << ")";
+    return id.str();
+  };
 
   // validate peak window
   if (peak_range.first >= peak_range.second) {
     std::stringstream msg;
-    msg << "Invalid peak window: xmin>xmax (" << peak_range.first << ", " << peak_range.second << ")" << errorid.str();
+    msg << "Invalid peak window: xmin>xmax (" << peak_range.first << ", " << peak_range.second << ")" << errorid();
     throw std::runtime_error(msg.str());
   }
 
@@ -1841,19 +1833,22 @@ double FitPeaks::fitFunctionSD(const IAlgorithm_sptr &fit, const API::IPeakFunct
   }
 
   // Execute fit and get result of fitting background
-  g_log.debug() << "[E1201] FitSingleDomain Before fitting, Fit function: " << fit->asString() << "\n";
-  errorid << " starting function [" << comp_func->asString() << "]";
+  const bool logDebug = g_log.is(Kernel::Logger::Priority::PRIO_DEBUG);
+  if (logDebug)
+    g_log.debug() << "[E1201] FitSingleDomain Before fitting, Fit function: " << fit->asString() << "\n";
+  const std::string startingFunction = comp_func->asString();
   try {
     fit->execute();
-    g_log.debug() << "[E1202] FitSingleDomain After fitting, Fit function: " << fit->asString() << "\n";
+    if (logDebug)
+      g_log.debug() << "[E1202] FitSingleDomain After fitting, Fit function: " << fit->asString() << "\n";
 
     if (!fit->isExecuted()) {
-      g_log.warning() << "Fitting peak SD (single domain) failed to execute. " + errorid.str();
+      g_log.warning() << "Fitting peak SD (single domain) failed to execute. " + errorid() + " starting function [" +
+                             startingFunction + "]";
       return DBL_MAX;
     }
   } catch (std::invalid_argument &e) {
-    errorid << ": " << e.what();
-    g_log.warning() << "\nWhile fitting " + errorid.str();
+    g_log.warning() << "\nWhile fitting " + errorid() + " starting function [" + startingFunction + "]: " + e.what();
     return DBL_MAX; // probably the wrong thing to do
   }
 
@@ -1872,18 +1867,8 @@ double FitPeaks::fitFunctionMD(API::IFunction_sptr fit_function, const API::Matr
                                const size_t wsindex, const std::pair<double, double> &vec_xmin,
                                const std::pair<double, double> &vec_xmax) {
   // Note: after testing it is found that multi-domain Fit cannot be reused
-  API::IAlgorithm_sptr fit;
-  try {
-    fit = createChildAlgorithm("Fit", -1, -1, false);
-  } catch (Exception::NotFoundError &) {
-    std::stringstream errss;
-    errss << "The FitPeak algorithm requires the CurveFitting library";
-    throw std::runtime_error(errss.str());
-  }
-  // set up background fit instance
-  fit->setProperty("Minimizer", m_minimizer);
-  fit->setProperty("CostFunction", m_costFunction);
-  fit->setProperty("CalcErrors", true);
+  // set up background fit instance, whose errors are never used
+  API::IAlgorithm_sptr fit = createFitAlgorithm(false);
 
   // This use multi-domain; but does not know how to set up IFunction_sptr
   // fitfunc,
@@ -1926,6 +1911,28 @@ double FitPeaks::fitFunctionMD(API::IFunction_sptr fit_function, const API::Matr
   return chi2;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Create the child algorithm Fit with the minimizer and cost function of the
+ * peak fitting. It can be reused for any number of single domain fits.
+ * @param calcErrors :: whether Fit shall calculate the errors of the fitted parameters
+ * @return the Fit algorithm
+ */
+API::IAlgorithm_sptr FitPeaks::createFitAlgorithm(const bool calcErrors) {
+  API::IAlgorithm_sptr fit;
+  try {
+    fit = createChildAlgorithm("Fit", -1, -1, false);
+  } catch (Exception::NotFoundError &) {
+    std::stringstream errss;
+    errss << "The FitPeak algorithm requires the CurveFitting library";
+    g_log.error(errss.str());
+    throw std::runtime_error(errss.str());
+  }
+  fit->setProperty("Minimizer", m_minimizer);
+  fit->setProperty("CostFunction", m_costFunction);
+  fit->setProperty("CalcErrors", calcErrors);
+  return fit;
+}
+
 //----------------------------------------------------------------------------------------------
 /// Fit peak with high background
 double FitPeaks::fitFunctionHighBackground(const IAlgorithm_sptr &fit, const std::pair<double, double> &fit_window,
@@ -1003,9 +1003,11 @@ public:
     // there is no Chi2 column in error table
     TS_ASSERT_EQUALS(error_table->columnCount(), param_ws->columnCount() - 1);
 
-    // check fit error
+    // check fit error: the errors are only calculated when the table is requested
+    const size_t chi2_index = param_ws->columnCount() - 1;
     for (size_t irow = 0; irow < param_ws->rowCount(); ++irow) {
-      continue;
+      if (param_ws->cell<double>(irow, chi2_index) < DBL_MAX)
+        TS_ASSERT(error_table->getColumn("PeakCentre")->toDouble(irow) > 0.);
     }
 
     // clean up
@@ -0,0 +1,155 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/Jacobian.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace Mantid {
+namespace CurveFitting {
+/**
+A dual number for forward-mode automatic differentiation: a value together
+with its derivatives with respect to N variables. Arithmetic on dual numbers
+applies the chain rule, so a calculation written once as a template of its
+number type gives the values when run on doubles and the exact derivatives
+when run on DualNumber.
+
+Functions of one argument not defined here can be added with chain(), given
+the value of the function and of its derivative.
+
+@tparam N :: the number of variables
+*/
+template <size_t N> class DualNumber {
+public:
+  /// A constant
+  DualNumber(const double value = 0.0) : m_value(value), m_derivatives{} {}
+  /// Variable number i
+  DualNumber(const double value, const size_t i) : m_value(value), m_derivatives{} { m_derivatives[i] = 1.0; }
+
+  /// @return the value
+  double value() const { return m_value; }
+  /// @return the derivative with respect to variable i
+  double derivative(const size_t i) const { return m_derivatives[i]; }
+
+  /** Apply a function of one argument
+   * @param u :: the argument
+   * @param value :: the function at u
+   * @param derivative :: the derivative of the function at u
+   * @return the function of u
+   */
+  friend DualNumber chain(const DualNumber &u, const double value, const double derivative) {
+    DualNumber res(value);
+    for (size_t i = 0; i < N; ++i)
+      res.m_derivatives[i] = derivative * u.m_derivatives[i];
+    return res;
+  }
+
+  DualNumber operator-() const { return chain(*this, -m_value, -1.0); }
+
+  DualNumber &operator+=(const DualNumber &other) {
+    m_value += other.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] += other.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator-=(const DualNumber &other) {
+    m_value -= other.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] -= other.m_derivatives[i];
+    return *this;
+  }
+  DualNumber &operator*=(const DualNumber &other) {
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] = m_derivatives[i] * other.m_value + m_value * other.m_derivatives[i];
+    m_value *= other.m_value;
+    return *this;
+  }
+  DualNumber &operator/=(const DualNumber &other) {
+    const double inverse = 1.0 / other.m_value;
+    m_value *= inverse;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] = (m_derivatives[i] - m_value * other.m_derivatives[i]) * inverse;
+    return *this;
+  }
+
+  friend DualNumber operator+(DualNumber a, const DualNumber &b) { return a += b; }
+  friend DualNumber operator-(DualNumber a, const DualNumber &b) { return a -= b; }
+  friend DualNumber operator*(DualNumber a, const DualNumber &b) { return a *= b; }
+  friend DualNumber operator/(DualNumber a, const DualNumber &b) { return a /= b; }
+
+  friend bool operator<(const DualNumber &a, const DualNumber &b) { return a.m_value < b.m_value; }
+  friend bool operator>(const DualNumber &a, const DualNumber &b) { return a.m_value > b.m_value; }
+  friend bool operator==(const DualNumber &a, const DualNumber &b) { return a.m_value == b.m_value; }
+
+  friend DualNumber exp(const DualNumber &u) {
+    const double e = std::exp(u.m_value);
+    return chain(u, e, e);
+  }
+  friend DualNumber log(const DualNumber &u) { return chain(u, std::log(u.m_value), 1.0 / u.m_value); }
+  friend DualNumber sqrt(const DualNumber &u) {
+    const double s = std::sqrt(u.m_value);
+    return chain(u, s, 0.5 / s);
+  }
+  friend DualNumber pow(const DualNumber &u, const double p) {
+    const double v = std::pow(u.m_value, p - 1.0);
+    return chain(u, v * u.m_value, p * v);
+  }
+  friend DualNumber sin(const DualNumber &u) { return chain(u, std::sin(u.m_value), std::cos(u.m_value)); }
+  friend DualNumber cos(const DualNumber &u) { return chain(u, std::cos(u.m_value), -std::sin(u.m_value)); }
+  friend DualNumber atan(const DualNumber &u) {
+    return chain(u, std::atan(u.m_value), 1.0 / (1.0 + u.m_value * u.m_value));
+  }
+  friend DualNumber erf(const DualNumber &u) {
+    return chain(u, std::erf(u.m_value), M_2_SQRTPI * std::exp(-u.m_value * u.m_value));
+  }
+  friend DualNumber erfc(const DualNumber &u) {
+    return chain(u, std::erfc(u.m_value), -M_2_SQRTPI * std::exp(-u.m_value * u.m_value));
+  }
+  friend DualNumber fabs(const DualNumber &u) { return u.m_value < 0.0 ? -u : u; }
+
+private:
+  /// The value
+  double m_value;
+  /// The derivatives with respect to each variable
+  std::array<double, N> m_derivatives;
+};
+
+/// @return the value of a number, for code templated on the number type
+inline double valueOf(const double x) { return x; }
+/// @return the value of a dual number, for code templated on the number type
+template <size_t N> double valueOf(const DualNumber<N> &x) { return x.value(); }
+
+/** Calculate the derivatives of a 1D function with respect to its N
+ * parameters by running its calculation on dual numbers.
+ * @param function :: the function, which has N parameters
+ * @param jacobian :: the derivatives are set in this
+ * @param xValues :: the x values
+ * @param nData :: the number of x values
+ * @param calculate :: the calculation of the function, templated on the number
+ * type: it takes the array of the N parameters, the x values, their number and
+ * a pointer to where the results go.
+ */
+template <size_t N, typename Calculate>
+void functionDerivAutoDiff(const API::IFunction &function, API::Jacobian &jacobian, const double *xValues,
+                           const size_t nData, Calculate &&calculate) {
+  std::array<DualNumber<N>, N> parameters;
+  for (size_t i = 0; i < N; ++i)
+    parameters[i] = DualNumber<N>(function.getParameter(i), i);
+  std::vector<DualNumber<N>> out(nData);
+  calculate(parameters, xValues, nData, out.data());
+  for (size_t iY = 0; iY < nData; ++iY) {
+    for (size_t iP = 0; iP < N; ++iP)
+      jacobian.set(iY, iP, out[iY].derivative(iP));
+  }
+}
+
+} // namespace CurveFitting
+} // namespace Mantid
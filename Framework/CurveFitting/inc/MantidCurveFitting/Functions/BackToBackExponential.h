@@ -12,6 +12,8 @@
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidCurveFitting/DllConfig.h"
 
+#include <array>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -66,6 +68,11 @@ protected:
   /// Derivative evaluation method to be implemented in the inherited classes
   void functionDerivLocal(API::Jacobian *, const double *, const size_t) override {}
   double expWidth() const;
+
+private:
+  /// Calculate the function for double or dual number parameters
+  template <typename T>
+  void calculate(const std::array<T, 5> &parameters, const double *xValues, const size_t nData, T *out) const;
 };
 
 using BackToBackExponential_sptr = std::shared_ptr<BackToBackExponential>;
@@ -10,9 +10,11 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAPI/CompositeFunction.h"
+#include "MantidAPI/FunctionDomain1D.h"
 #include "MantidCurveFitting/DllConfig.h"
 #include <cmath>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -117,7 +119,7 @@ public:
   /// Set up the function for a fit.
   void setUpForFit() override;
 
-  /// Deletes and zeroes pointer m_resolution forsing function(...) to
+  /// Deletes the cached resolution forsing function(...) to
   /// recalculate the resolution function
   void refreshResolution() const;
 
@@ -126,10 +128,21 @@ protected:
   void init() override;
 
 private:
+  struct Resolution;
+  /// Check if the resolution has no active parameters
+  bool isResolutionFixed() const;
+  /// Find the resolution cached for a domain
+  std::shared_ptr<const Resolution> findResolution(const API::FunctionDomain1D &domain, bool fftMode) const;
+  /// Cache the resolution calculated for a domain
+  std::shared_ptr<const Resolution> storeResolution(const API::FunctionDomain1D &domain, bool fftMode,
+                                                    std::vector<double> transform) const;
   /// Keep the Fourier transform of the resolution function (divided by the
   /// step in xValues) when in FFT mode, and the inverted resolution if in
-  /// Direct mode
-  mutable std::vector<double> m_resolution;
+  /// Direct mode, for each domain the function is calculated on
+  mutable std::vector<std::shared_ptr<const Resolution>> m_resolutions;
+  /// Guards m_resolutions, as the function can be calculated on several
+  /// domains in parallel
+  mutable std::mutex m_resolutionMutex;
   void innerFunctionsAre1D() const;
 };
 
@@ -62,6 +62,9 @@ private:
   std::string m_formula;
   /// extended muParser instance
   mu::Parser *m_parser;
+  /// Evaluates the derivatives with respect to all the parameters at once, if
+  /// the formula could be differentiated. Otherwise they are found numerically.
+  std::unique_ptr<mu::Parser> m_derivativeParser;
   /// Used as 'x' variable in m_parser.
   mutable double m_x;
   /// True indicates that input formula contains 'x' variable
@@ -73,6 +76,8 @@ private:
 
   /// mu::Parser callback function for setting variables.
   static double *AddVariable(const char *varName, void *pufun);
+  /// Set up the parser of the derivatives of the formula, if it can be differentiated
+  void setUpDerivatives();
 };
 
 } // namespace Functions
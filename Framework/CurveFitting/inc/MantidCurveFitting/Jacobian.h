@@ -8,6 +8,8 @@
 
 #include "MantidAPI/Jacobian.h"
 
+#include "Eigen/Core"
+
 #include <vector>
 
 namespace Mantid {
@@ -70,6 +72,10 @@ public:
   }
   /// overwrite base method
   void zero() override { m_data.assign(m_data.size(), 0.0); }
+  /// The storage viewed as a row-major ny x np matrix, without copying
+  Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>> matrix() {
+    return {m_data.data(), static_cast<Eigen::Index>(m_ny), static_cast<Eigen::Index>(m_np)};
+  }
 };
 
 } // namespace CurveFitting
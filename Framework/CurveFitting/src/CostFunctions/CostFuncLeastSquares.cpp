@@ -71,73 +71,46 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function, API:
   Jacobian jacobian(ny, np);
   function->functionDeriv(*domain, jacobian);
 
-  size_t iActiveP = 0;
-  double fVal = 0.0;
-  std::vector<double> weights = getFitWeights(values);
-
+  std::vector<size_t> activeParams;
   for (size_t ip = 0; ip < np; ++ip) {
-    if (!function->isActive(ip))
-      continue;
-
-    double d = 0.0;
-    for (size_t i = 0; i < ny; ++i) {
-      double calc = values->getCalculated(i);
-      double obs = values->getFitData(i);
-      double w = weights[i];
-      double y = (calc - obs) * w;
-      d += y * jacobian.get(i, ip) * w;
-      if (iActiveP == 0) {
-        fVal += y * y;
-      }
-    }
-    PARALLEL_CRITICAL(der_set) {
-      double der = m_der.get(iActiveP);
-      m_der.set(iActiveP, der + d);
-    }
-    ++iActiveP;
-
-    if (iActiveP >= m_der.size())
-      break;
+    if (function->isActive(ip))
+      activeParams.emplace_back(ip);
   }
+  if (activeParams.size() > m_der.size())
+    activeParams.resize(m_der.size());
+  const auto na = static_cast<Eigen::Index>(activeParams.size());
 
-  PARALLEL_ATOMIC
-  m_value += 0.5 * fVal;
-
-  if (!evalHessian)
-    return;
-
-  size_t i1 = 0;                  // active parameter index
-  for (size_t i = 0; i < np; ++i) // over parameters
-  {
-    if (!function->isActive(i))
-      continue;
-    size_t i2 = 0;                  // active parameter index
-    for (size_t j = 0; j <= i; ++j) // over ~ half of parameters
-    {
-      if (!function->isActive(j))
-        continue;
-      double d = 0.0;
-      for (size_t k = 0; k < ny; ++k) // over fitting data
-      {
-        double w = weights[k];
-        d += jacobian.get(k, i) * jacobian.get(k, j) * w * w;
-      }
-      PARALLEL_CRITICAL(hessian_set) {
-        double h = m_hessian.get(i1, i2);
-        m_hessian.set(i1, i2, h + d);
-        if (i1 != i2) {
-          m_hessian.set(i2, i1, h + d);
-        }
-      }
-      ++i2;
-
-      if (i2 >= m_hessian.size2())
-        break;
+  // Weight the residuals and the Jacobian in place and move the active
+  // columns to its front, so no copy of the ny x np matrix is made
+  std::vector<double> weights = getFitWeights(values);
+  Eigen::VectorXd residuals(ny);
+  for (size_t i = 0; i < ny; ++i) {
+    residuals(static_cast<Eigen::Index>(i)) = (values->getCalculated(i) - values->getFitData(i)) * weights[i];
+  }
+  auto matrix = jacobian.matrix();
+  matrix.array().colwise() *= Eigen::Map<const Eigen::ArrayXd>(weights.data(), matrix.rows());
+  for (size_t ia = 0; ia < activeParams.size(); ++ia) {
+    // activeParams is increasing so a column is never overwritten before it is moved
+    if (activeParams[ia] != ia) {
+      matrix.col(static_cast<Eigen::Index>(ia)) = matrix.col(static_cast<Eigen::Index>(activeParams[ia]));
     }
-    ++i1;
+  }
+  const auto weightedJacobian = matrix.leftCols(na);
+
+  // Sum up this domain on its own so that the members are locked only once
+  // to add it, however many parameters there are
+  const Eigen::VectorXd der = weightedJacobian.transpose() * residuals;
+  Eigen::MatrixXd hessian;
+  if (evalHessian) {
+    hessian.noalias() = weightedJacobian.transpose() * weightedJacobian;
+  }
 
-    if (i1 >= m_hessian.size1())
-      break;
+  PARALLEL_CRITICAL(val_deriv_hessian_set) {
+    m_value += 0.5 * residuals.squaredNorm();
+    m_der.mutator().head(na) += der;
+    if (evalHessian) {
+      m_hessian.mutator().topLeftCorner(na, na) += hessian;
+    }
   }
 }
 
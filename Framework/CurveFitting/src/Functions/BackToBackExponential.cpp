@@ -9,6 +9,7 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/BackToBackExponential.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidCurveFitting/DualNumber.h"
 
 #include <cmath>
 #include <gsl/gsl_multifit_nlin.h>
@@ -25,6 +26,17 @@ using namespace API;
 
 DECLARE_FUNCTION(BackToBackExponential)
 
+namespace {
+/// The logarithm of erfc, which does not underflow for large arguments
+double logErfc(const double x) { return gsl_sf_log_erfc(x); }
+
+template <size_t N> DualNumber<N> logErfc(const DualNumber<N> &x) {
+  const double value = gsl_sf_log_erfc(x.value());
+  // d/dx ln(erfc(x)) = -2/sqrt(pi) * exp(-x^2) / erfc(x)
+  return chain(x, value, -M_2_SQRTPI * std::exp(-x.value() * x.value() - value));
+}
+} // namespace
+
 void BackToBackExponential::init() {
   // Do not change the order of these parameters!
   declareParameter("I", 0.0, "integrated intensity of the peak"); // 0
@@ -104,53 +116,62 @@ void BackToBackExponential::setFwhm(const double w) {
 }
 
 void BackToBackExponential::function1D(double *out, const double *xValues, const size_t nData) const {
-  /*
-    const double& I = getParameter("I");
-    const double& a = getParameter("A");
-    const double& b = getParameter("B");
-    const double& x0 = getParameter("X0");
-    const double& s = getParameter("S");
-  */
+  const std::array<double, 5> parameters{getParameter(0), getParameter(1), getParameter(2), getParameter(3),
+                                         getParameter(4)};
+  calculate(parameters, xValues, nData, out);
+}
 
-  const double I = getParameter(0);
-  const double a = getParameter(1);
-  const double b = getParameter(2);
-  const double x0 = getParameter(3);
-  const double s = getParameter(4);
+/**
+ * Evaluate function derivatives by automatic differentiation.
+ */
+void BackToBackExponential::functionDeriv1D(Jacobian *jacobian, const double *xValues, const size_t nData) {
+  functionDerivAutoDiff<5>(*this, *jacobian, xValues, nData,
+                           [this](const auto &parameters, const double *x, const size_t n, auto *out) {
+                             calculate(parameters, x, n, out);
+                           });
+}
+
+/**
+ * Calculate the function for double or dual number parameters
+ * @param parameters :: I, A, B, X0 and S
+ * @param xValues :: the x values
+ * @param nData :: the number of x values
+ * @param out :: the function values
+ */
+template <typename T>
+void BackToBackExponential::calculate(const std::array<T, 5> &parameters, const double *xValues, const size_t nData,
+                                      T *out) const {
+  const T &I = parameters[0];
+  const T &a = parameters[1];
+  const T &b = parameters[2];
+  const T &x0 = parameters[3];
+  const T &s = parameters[4];
 
   // find the reasonable extent of the peak ~100 fwhm
   double extent = expWidth();
-  if (s > extent)
-    extent = s;
+  if (valueOf(s) > extent)
+    extent = valueOf(s);
   extent *= 100;
 
-  double s2 = s * s;
-  double normFactor = a * b / (a + b) / 2;
+  const T s2 = s * s;
+  T normFactor = a * b / (a + b) / 2;
   // Needed for IntegratePeaksMD for cylinder profile fitted with b=0
-  if (normFactor == 0.0)
+  if (valueOf(normFactor) == 0.0)
     normFactor = 1.0;
   for (size_t i = 0; i < nData; i++) {
-    double diff = xValues[i] - x0;
-    if (fabs(diff) < extent) {
-      double val = 0.0;
-      double arg1 = a / 2 * (a * s2 + 2 * diff);
-      val += exp(arg1 + gsl_sf_log_erfc((a * s2 + diff) / sqrt(2 * s2))); // prevent overflow
-      double arg2 = b / 2 * (b * s2 - 2 * diff);
-      val += exp(arg2 + gsl_sf_log_erfc((b * s2 - diff) / sqrt(2 * s2))); // prevent overflow
+    const T diff = xValues[i] - x0;
+    if (fabs(valueOf(diff)) < extent) {
+      T val = 0.0;
+      const T arg1 = a / 2 * (a * s2 + 2 * diff);
+      val += exp(arg1 + logErfc((a * s2 + diff) / sqrt(2 * s2))); // prevent overflow
+      const T arg2 = b / 2 * (b * s2 - 2 * diff);
+      val += exp(arg2 + logErfc((b * s2 - diff) / sqrt(2 * s2))); // prevent overflow
       out[i] = I * val * normFactor;
     } else
       out[i] = 0.0;
   }
 }
 
-/**
- * Evaluate function derivatives numerically.
- */
-void BackToBackExponential::functionDeriv1D(Jacobian *jacobian, const double *xValues, const size_t nData) {
-  FunctionDomain1DView domain(xValues, nData);
-  this->calNumericalDeriv(domain, *jacobian);
-}
-
 /**
  * Calculate contribution to the width by the exponentials.
  */
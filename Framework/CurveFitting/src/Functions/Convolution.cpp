@@ -28,7 +28,9 @@
 
 namespace {
 const double tolerance{0.02};
-}
+/// The number of domains to keep the resolution for
+const size_t maxCachedResolutions{64};
+} // namespace
 
 namespace Mantid::CurveFitting::Functions {
 
@@ -98,20 +100,75 @@ void Convolution::setAttribute(const std::string &attName, const IFunction::Attr
   CompositeFunction::setAttribute(attName, att);
 }
 
+/// The resolution function calculated for a domain
+struct Convolution::Resolution {
+  /// The x values of the domain
+  std::vector<double> domain;
+  /// True if the transform is for the FFT mode
+  bool fftMode;
+  /// The Fourier transform of the resolution in FFT mode, the inverted
+  /// resolution in Direct mode
+  std::vector<double> transform;
+  /// The resolution on the x values of the domain, empty if it wasn't kept
+  std::vector<double> values;
+};
+
 namespace {
 // anonymous namespace for local definitions
 
-// A struct incapsulating workspaces for real fft
+// A struct incapsulating workspaces and wavetables for real fft and its inverse
 struct RealFFTWorkspace {
   explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)), wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
+      : size(nData), workspace(gsl_fft_real_workspace_alloc(nData)), wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        inverseWavetable(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  RealFFTWorkspace(const RealFFTWorkspace &) = delete;
+  RealFFTWorkspace &operator=(const RealFFTWorkspace &) = delete;
   ~RealFFTWorkspace() {
+    gsl_fft_halfcomplex_wavetable_free(inverseWavetable);
     gsl_fft_real_wavetable_free(wavetable);
     gsl_fft_real_workspace_free(workspace);
   }
+  size_t size;
   gsl_fft_real_workspace *workspace;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *inverseWavetable;
 };
+
+/**
+ * The fft workspace of the calling thread, kept between evaluations so that
+ * the wavetables are only recalculated when the size of the data changes.
+ * Fetch it right before use: evaluating a function may replace it.
+ * @param nData :: The size of the data to transform
+ * @return The workspace
+ */
+RealFFTWorkspace &threadFFTWorkspace(size_t nData) {
+  thread_local std::unique_ptr<RealFFTWorkspace> workspace;
+  if (!workspace || workspace->size != nData) {
+    workspace = std::make_unique<RealFFTWorkspace>(nData);
+  }
+  return *workspace;
+}
+
+/**
+ * Add the resolution on the domain, scaled by the heights of the delta
+ * functions in the model.
+ * @param resolution :: The cached resolution
+ * @param function :: The resolution function, to calculate it if the values weren't kept
+ * @param xValues :: The x values of the domain
+ * @param nData :: The number of x values
+ * @param scale :: The sum of the heights of the delta functions
+ * @param out :: The values to add to
+ */
+void addScaledResolution(const std::vector<double> &resolution, const IFunction_sptr &function, const double *xValues,
+                         size_t nData, double scale, double *out) {
+  std::vector<double> tmp;
+  if (resolution.empty()) {
+    tmp.resize(nData);
+    evaluateFunctionOnRange(function, nData, xValues, tmp);
+  }
+  const auto &values = resolution.empty() ? tmp : resolution;
+  std::transform(out, out + nData, values.begin(), out, [scale](double y, double r) { return y + scale * r; });
+}
 } // namespace
 
 /**
@@ -168,12 +225,11 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
-  refreshResolution();
-  RealFFTWorkspace workspace(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
-  if (m_resolution.empty()) {
-    m_resolution.resize(nData);
+  auto resolution = findResolution(d1d, true);
+  if (!resolution) {
+    std::vector<double> transform(nData);
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
     std::vector<double> xr(nData);
@@ -189,34 +245,36 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
     xr[0] = -n2 * dx;
     if (odd)
       xr[nData - 1] = -xr[0];
-    evaluateFunctionOnRange(getFunction(0), nData, &xr[0], m_resolution);
+    evaluateFunctionOnRange(getFunction(0), nData, &xr[0], transform);
 
     // rotate the data to produce the right transform
     if (odd) {
-      double tmp = m_resolution[nData - 1];
+      double tmp = transform[nData - 1];
       for (int i = n2 - 1; i >= 0; i--) {
-        m_resolution[n2 + i + 1] = m_resolution[i];
-        m_resolution[i] = m_resolution[n2 + i];
+        transform[n2 + i + 1] = transform[i];
+        transform[i] = transform[n2 + i];
       }
-      m_resolution[n2] = tmp;
+      transform[n2] = tmp;
     } else {
       for (int i = 0; i < n2; i++) {
-        double tmp = m_resolution[i];
-        m_resolution[i] = m_resolution[n2 + i];
-        m_resolution[n2 + i] = tmp;
+        double tmp = transform[i];
+        transform[i] = transform[n2 + i];
+        transform[n2 + i] = tmp;
       }
     }
-    gsl_fft_real_transform(m_resolution.data(), 1, nData, workspace.wavetable, workspace.workspace);
-    std::transform(m_resolution.begin(), m_resolution.end(), m_resolution.begin(),
+    const auto &workspace = threadFFTWorkspace(nData);
+    gsl_fft_real_transform(transform.data(), 1, nData, workspace.wavetable, workspace.workspace);
+    std::transform(transform.begin(), transform.end(), transform.begin(),
                    std::bind(std::multiplies<double>(), _1, dx));
+    resolution = storeResolution(d1d, true, std::move(transform));
   }
 
-  // Now m_resolution contains fourier transform of the resolution
+  // Now resolution->transform contains fourier transform of the resolution
 
   if (nFunctions() == 1) {
     // return the resolution transform for testing
     double dx = 1.; // nData > 1? xValues[1] - xValues[0]: 1.;
-    std::transform(m_resolution.begin(), m_resolution.end(), values.getPointerToCalculated(0),
+    std::transform(resolution->transform.begin(), resolution->transform.end(), values.getPointerToCalculated(0),
                    std::bind(std::multiplies<double>(), _1, dx));
     return;
   }
@@ -259,6 +317,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
   if (!deltaFunctionsOnly) {
     // Transform the model function
     getFunction(1)->function(domain, values);
+    const auto &workspace = threadFFTWorkspace(nData);
     gsl_fft_real_transform(out, 1, nData, workspace.wavetable, workspace.workspace);
 
     // Fourier transform is integration - multiply by the step in the
@@ -268,7 +327,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
 
     // now out contains fourier transform of the model function
 
-    HalfComplex res(m_resolution.data(), nData);
+    HalfComplex res(const_cast<double *>(resolution->transform.data()), nData);
     HalfComplex fun(out, nData);
 
     // Multiply transforms of the resolution and model functions
@@ -283,9 +342,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r = gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r, workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
+    gsl_fft_halfcomplex_inverse(out, 1, nData, workspace.inverseWavetable, workspace.workspace);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -298,10 +355,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
   if (dltF != 0.0 && !deltaShifted) {
     // If model contains any delta functions their effect is addition of scaled
     // resolution
-    std::vector<double> tmp(nData);
-    evaluateFunctionOnRange(getFunction(0), nData, xValues, tmp);
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), std::bind(std::multiplies<double>(), _1, dltF));
-    std::transform(out, out + nData, tmp.data(), out, std::plus<double>());
+    addScaledResolution(resolution->values, getFunction(0), xValues, nData, dltF, out);
   } else if (!dltFuns.empty()) {
     std::vector<double> x(nData);
     for (const auto &df : dltFuns) {
@@ -335,8 +389,6 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
                                                            // x-values
   auto ixN = nData - ixP - 1;                              // negative x-values (ixP+ixN=nData-1)
 
-  refreshResolution();
-
   // double the domain where to evaluate the convolution. Guarantees complete
   // overlap betwen convolution and signal in the original range.
   const size_t mData = nData + ixN + ixP; // equal to 2*nData-1
@@ -348,16 +400,19 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
     xValuesExtd[i] = -Dx + static_cast<double>(i) * dx;
   }
 
-  if (m_resolution.empty()) {
-    m_resolution.resize(nData);
-  }
-  // Fill m_resolution with the resolution function data
-  // Lines 341-349 is duplicated in functionFFTmode. To be cleanup
-  // in issue 16064
-  evaluateFunctionOnRange(getFunction(0), nData, &xValues[0], m_resolution);
+  auto resolution = findResolution(d1d, false);
+  if (!resolution) {
+    std::vector<double> inverted(nData);
+    // Fill inverted with the resolution function data
+    // Lines 341-349 is duplicated in functionFFTmode. To be cleanup
+    // in issue 16064
+    evaluateFunctionOnRange(getFunction(0), nData, &xValues[0], inverted);
 
-  // Reverse the axis of the resolution data
-  std::reverse(m_resolution.begin(), m_resolution.end());
+    // Reverse the axis of the resolution data
+    std::reverse(inverted.begin(), inverted.end());
+    resolution = storeResolution(d1d, false, std::move(inverted));
+  }
+  const auto &inverted = resolution->transform;
 
   // check for delta functions
   std::vector<std::shared_ptr<DeltaFunction>> dltFuns;
@@ -403,7 +458,7 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
     for (size_t i = 0; i < nData; i++) {
       double tmp{0.0};
       for (size_t j = 0; j < nData; j++) {
-        tmp += outExt[i + j] * m_resolution[j];
+        tmp += outExt[i + j] * inverted[j];
       }
       out[i] = tmp * dx;
     }
@@ -416,10 +471,7 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
     // resolution
     // Lines 412-430 is duplicated in functionFFTmode. To be cleanup
     // in issue 16064
-    std::vector<double> tmp(nData);
-    evaluateFunctionOnRange(getFunction(0), nData, xValues, tmp);
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), std::bind(std::multiplies<double>(), _1, dltF));
-    std::transform(out, out + nData, tmp.data(), out, std::plus<double>());
+    addScaledResolution(resolution->values, getFunction(0), xValues, nData, dltF, out);
   } else if (!dltFuns.empty()) {
     std::vector<double> x(nData);
     for (const auto &df : dltFuns) {
@@ -480,27 +532,78 @@ size_t Convolution::addFunction(IFunction_sptr f) {
  * Make sure that the resolution is updated if this function is reused in
  * several Fits.
  */
-void Convolution::setUpForFit() { m_resolution.clear(); }
+void Convolution::setUpForFit() {
+  std::lock_guard<std::mutex> lock(m_resolutionMutex);
+  m_resolutions.clear();
+}
 
-/// Deletes and zeroes pointer m_resolution forsing function(...) to recalculate
-/// the resolution function
+/// Deletes the cached resolution forsing function(...) to recalculate
+/// the resolution function if it has active parameters
 void Convolution::refreshResolution() const {
-  // refresh when calculation for the first time
-  bool needRefreshing = m_resolution.empty();
-  if (!needRefreshing) {
-    // if resolution has active parameters always refresh
-    IFunction const &res = *getFunction(0);
-    for (size_t i = 0; i < res.nParams(); ++i) {
-      if (res.isActive(i)) {
-        needRefreshing = true;
-        break;
-      }
-    }
-  }
-  if (!needRefreshing)
+  if (isResolutionFixed())
     return;
   // delete fourier transform of the resolution to force its recalculation
-  m_resolution.clear();
+  std::lock_guard<std::mutex> lock(m_resolutionMutex);
+  m_resolutions.clear();
+}
+
+/// Returns true if the resolution has no active parameters and can be cached
+bool Convolution::isResolutionFixed() const {
+  IFunction const &res = *getFunction(0);
+  for (size_t i = 0; i < res.nParams(); ++i) {
+    if (res.isActive(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Find the resolution cached for a domain. The function can be evaluated on
+ * several domains at once, for example by a Fit with the Parallel domain
+ * type, so the cache keeps the resolution for each domain.
+ * @param domain :: The domain the function is calculated on
+ * @param fftMode :: True to find the transform of the FFT mode
+ * @return The cached resolution, or nullptr if it has to be calculated
+ */
+std::shared_ptr<const Convolution::Resolution> Convolution::findResolution(const FunctionDomain1D &domain,
+                                                                         bool fftMode) const {
+  if (!isResolutionFixed())
+    return nullptr;
+  const double *xValues = domain.getPointerAt(0);
+  std::lock_guard<std::mutex> lock(m_resolutionMutex);
+  const auto found = std::find_if(m_resolutions.cbegin(), m_resolutions.cend(), [&](const auto &resolution) {
+    return resolution->fftMode == fftMode && resolution->domain.size() == domain.size() &&
+           std::equal(resolution->domain.cbegin(), resolution->domain.cend(), xValues);
+  });
+  return found == m_resolutions.cend() ? nullptr : *found;
+}
+
+/**
+ * Cache the resolution calculated for a domain, if the resolution is fixed.
+ * @param domain :: The domain the function is calculated on
+ * @param fftMode :: True if the transform is for the FFT mode
+ * @param transform :: The Fourier transform or the inverted resolution
+ * @return The resolution
+ */
+std::shared_ptr<const Convolution::Resolution>
+Convolution::storeResolution(const FunctionDomain1D &domain, bool fftMode, std::vector<double> transform) const {
+  auto resolution = std::make_shared<Resolution>();
+  resolution->fftMode = fftMode;
+  resolution->transform = std::move(transform);
+  if (!isResolutionFixed())
+    return resolution;
+  const size_t nData = domain.size();
+  const double *xValues = domain.getPointerAt(0);
+  resolution->domain.assign(xValues, xValues + nData);
+  resolution->values.resize(nData);
+  evaluateFunctionOnRange(getFunction(0), nData, xValues, resolution->values);
+  std::lock_guard<std::mutex> lock(m_resolutionMutex);
+  if (m_resolutions.size() >= maxCachedResolutions) {
+    m_resolutions.erase(m_resolutions.begin());
+  }
+  m_resolutions.emplace_back(resolution);
+  return resolution;
 }
 
 } // namespace Mantid::CurveFitting::Functions
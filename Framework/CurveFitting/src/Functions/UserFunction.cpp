@@ -8,11 +8,20 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidAPI/Expression.h"
+#include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/Jacobian.h"
 #include "MantidAPI/MuParserUtils.h"
 #include "MantidGeometry/muParser_Silent.h"
 #include <boost/tokenizer.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <map>
+
 namespace Mantid::CurveFitting::Functions {
 
 using namespace CurveFitting;
@@ -24,6 +33,148 @@ using Mantid::API::MuParserUtils::extraOneVarFunctions;
 using namespace Kernel;
 using namespace API;
 
+namespace {
+std::string bracket(const std::string &expr) { return "(" + expr + ")"; }
+
+// Build the sum, difference, product and quotient of two formulas, dropping
+// terms that are zero and factors that are one to keep the derivatives short
+
+std::string add(const std::string &a, const std::string &b) {
+  if (a == "0")
+    return b;
+  if (b == "0")
+    return a;
+  return bracket(a) + "+" + bracket(b);
+}
+
+std::string subtract(const std::string &a, const std::string &b) {
+  if (b == "0")
+    return a;
+  if (a == "0")
+    return "-" + bracket(b);
+  return bracket(a) + "-" + bracket(b);
+}
+
+std::string multiply(const std::string &a, const std::string &b) {
+  if (a == "0" || b == "0")
+    return "0";
+  if (a == "1")
+    return b;
+  if (b == "1")
+    return a;
+  return bracket(a) + "*" + bracket(b);
+}
+
+std::string divide(const std::string &a, const std::string &b) {
+  if (a == "0")
+    return "0";
+  return bracket(a) + "/" + bracket(b);
+}
+
+/// Derivatives of the functions of one argument known to mu::Parser, as formulas of the argument
+const std::map<std::string, std::function<std::string(const std::string &)>> FUNCTION_DERIVATIVES = {
+    {"sin", [](const std::string &u) { return "cos(" + u + ")"; }},
+    {"cos", [](const std::string &u) { return "-sin(" + u + ")"; }},
+    {"tan", [](const std::string &u) { return "1/cos(" + u + ")^2"; }},
+    {"asin", [](const std::string &u) { return "1/sqrt(1-(" + u + ")^2)"; }},
+    {"acos", [](const std::string &u) { return "-1/sqrt(1-(" + u + ")^2)"; }},
+    {"atan", [](const std::string &u) { return "1/(1+(" + u + ")^2)"; }},
+    {"sinh", [](const std::string &u) { return "cosh(" + u + ")"; }},
+    {"cosh", [](const std::string &u) { return "sinh(" + u + ")"; }},
+    {"tanh", [](const std::string &u) { return "1-tanh(" + u + ")^2"; }},
+    {"exp", [](const std::string &u) { return "exp(" + u + ")"; }},
+    {"ln", [](const std::string &u) { return "1/(" + u + ")"; }},
+    {"log2", [](const std::string &u) { return "1/((" + u + ")*ln(2))"; }},
+    {"log10", [](const std::string &u) { return "1/((" + u + ")*ln(10))"; }},
+    {"sqrt", [](const std::string &u) { return "0.5/sqrt(" + u + ")"; }},
+    {"abs", [](const std::string &u) { return "sign(" + u + ")"; }}};
+
+/// @return true if the name is a number or a mu::Parser variable or constant
+bool isValue(const std::string &name) {
+  char *end = nullptr;
+  std::strtod(name.c_str(), &end);
+  if (!name.empty() && *end == '\0')
+    return true;
+  if (name.empty() || !(std::isalpha(static_cast<unsigned char>(name.front())) || name.front() == '_'))
+    return false;
+  return std::all_of(name.cbegin(), name.cend(),
+                     [](const char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; });
+}
+
+/** Differentiate a formula symbolically. Only the operators and functions
+ * whose meaning is the same in Expression and mu::Parser are handled.
+ * @param expr :: the formula parsed into an expression
+ * @param var :: the variable to differentiate with respect to
+ * @return the derivative as a mu::Parser formula
+ * @throw std::invalid_argument if the formula cannot be differentiated
+ */
+std::string differentiate(const Expression &expr, const std::string &var) {
+  const auto &name = expr.name();
+  if (!expr.isFunct()) {
+    if (name == var)
+      return "1";
+    if (isValue(name))
+      return "0";
+    throw std::invalid_argument("Cannot differentiate " + name);
+  }
+  if (name.empty() && expr.size() == 1) {
+    // brackets
+    return differentiate(expr[0], var);
+  }
+  if ((name == "-" || name == "+") && expr.size() == 1) {
+    const auto deriv = differentiate(expr[0], var);
+    return name == "-" && deriv != "0" ? "-" + bracket(deriv) : deriv;
+  }
+  if (name == "+") {
+    std::string deriv = "0";
+    for (const auto &term : expr) {
+      if (term.operator_name() == "-")
+        deriv = subtract(deriv, differentiate(term, var));
+      else
+        deriv = add(deriv, differentiate(term, var));
+    }
+    return deriv;
+  }
+  if (name == "*") {
+    std::string value = expr[0].str();
+    std::string deriv = differentiate(expr[0], var);
+    for (size_t i = 1; i < expr.size(); ++i) {
+      const auto term = expr[i].str();
+      const auto termDeriv = differentiate(expr[i], var);
+      if (expr[i].operator_name() == "*") {
+        deriv = add(multiply(deriv, term), multiply(value, termDeriv));
+        value = bracket(value) + "*" + bracket(term);
+      } else if (expr[i].operator_name() == "/") {
+        deriv = divide(subtract(multiply(deriv, term), multiply(value, termDeriv)), bracket(term) + "^2");
+        value = bracket(value) + "/" + bracket(term);
+      } else {
+        throw std::invalid_argument("Cannot differentiate operator " + expr[i].operator_name());
+      }
+    }
+    return deriv;
+  }
+  if (name == "^" && expr.size() == 2) {
+    // Expression and mu::Parser may disagree on the order of a sign and a power
+    const auto &base = expr[0];
+    if (base.isFunct() && base.size() == 1 && (base.name() == "-" || base.name() == "+"))
+      throw std::invalid_argument("Cannot differentiate a power of a signed value");
+    const auto baseValue = base.str();
+    const auto exponent = expr[1].str();
+    const auto baseDeriv = differentiate(base, var);
+    const auto exponentDeriv = differentiate(expr[1], var);
+    if (exponentDeriv == "0")
+      return multiply(bracket(exponent) + "*" + bracket(baseValue) + "^" + bracket(exponent + "-1"), baseDeriv);
+    return multiply(bracket(baseValue) + "^" + bracket(exponent),
+                    add(multiply(exponentDeriv, "ln" + bracket(baseValue)),
+                        divide(multiply(exponent, baseDeriv), baseValue)));
+  }
+  const auto function = FUNCTION_DERIVATIVES.find(name);
+  if (function != FUNCTION_DERIVATIVES.end() && expr.size() == 1)
+    return multiply(bracket(function->second(expr[0].str())), differentiate(expr[0], var));
+  throw std::invalid_argument("Cannot differentiate " + name);
+}
+} // namespace
+
 /// Constructor
 UserFunction::UserFunction() : m_parser(new mu::Parser()), m_x(0.), m_x_set(false) {
   extraOneVarFunctions(*m_parser);
@@ -69,6 +220,10 @@ void UserFunction::setAttribute(const std::string &attName, const Attribute &val
 
   m_x_set = false;
   clearAllParameters();
+  // The parsers point at the parameters just freed, so must not be used until
+  // they are set up for the new formula
+  m_parser->ClearVar();
+  m_derivativeParser.reset();
 
   try {
     mu::Parser tmp_parser;
@@ -91,13 +246,46 @@ void UserFunction::setAttribute(const std::string &attName, const Attribute &val
     return;
   }
 
-  m_parser->ClearVar();
   m_parser->DefineVar("x", &m_x);
   for (size_t i = 0; i < nParams(); i++) {
     m_parser->DefineVar(parameterName(i), getParameterAddress(i));
   }
 
   m_parser->SetExpr(m_formula);
+  setUpDerivatives();
+}
+
+/** Differentiate the formula with respect to each parameter and set up a
+ * parser that evaluates all the derivatives in one go. If the formula cannot be
+ * differentiated, functionDeriv falls back to numerical derivatives.
+ */
+void UserFunction::setUpDerivatives() {
+  m_derivativeParser.reset();
+  if (nParams() == 0)
+    return;
+  try {
+    Expression expr;
+    expr.parse(m_formula);
+    std::string derivatives;
+    for (size_t i = 0; i < nParams(); i++) {
+      derivatives += (i == 0 ? "" : ",") + differentiate(expr, parameterName(i));
+    }
+
+    auto parser = std::make_unique<mu::Parser>();
+    extraOneVarFunctions(*parser);
+    parser->DefineVar("x", &m_x);
+    for (size_t i = 0; i < nParams(); i++) {
+      parser->DefineVar(parameterName(i), getParameterAddress(i));
+    }
+    parser->SetExpr(derivatives);
+    // mu::Parser only checks the syntax when it is first evaluated
+    int nResults = 0;
+    parser->Eval(nResults);
+    if (static_cast<size_t>(nResults) == nParams())
+      m_derivativeParser = std::move(parser);
+  } catch (...) {
+    // use numerical derivatives
+  }
 }
 
 /** Calculate the fitting function.
@@ -128,7 +316,25 @@ void UserFunction::function1D(double *out, const double *xValues, const size_t n
  * respect to the fitting parameters
  */
 void UserFunction::functionDeriv(const API::FunctionDomain &domain, API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
+  const auto *domain1D = dynamic_cast<const FunctionDomain1D *>(&domain);
+  if (!m_derivativeParser || !domain1D || dynamic_cast<const FunctionDomain1DHistogram *>(&domain)) {
+    calNumericalDeriv(domain, jacobian);
+    return;
+  }
+  for (size_t i = 0; i < domain1D->size(); i++) {
+    m_x = (*domain1D)[i];
+    int nResults = 0;
+    const double *derivatives = nullptr;
+    try {
+      derivatives = m_derivativeParser->Eval(nResults);
+    } catch (mu::Parser::exception_type &e) {
+      throw std::invalid_argument("Error evaluating the derivatives of function \"" + m_formula +
+                                  "\" for x=" + std::to_string(m_x) + ": " + e.GetMsg());
+    }
+    for (size_t ip = 0; ip < nParams(); ip++) {
+      jacobian.set(i, ip, derivatives[ip]);
+    }
+  }
 }
 
 } // namespace Mantid::CurveFitting::Functions
@@ -19,6 +19,7 @@
 #include "MantidCurveFitting/Functions/ExpDecay.h"
 #include "MantidCurveFitting/Functions/Gaussian.h"
 #include "MantidCurveFitting/Functions/LinearBackground.h"
+#include "MantidCurveFitting/Functions/Polynomial.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
 #include "MantidCurveFitting/GSLFunctions.h"
 
@@ -208,6 +209,39 @@ public:
     TS_ASSERT_DELTA(L, -0.145, 1e-10); // L + costFun->val() == 0
   }
 
+  void test_hessian_of_active_parameters() {
+    std::vector<double> x{0., 1., 2.}, y(3);
+    for (size_t i = 0; i < x.size(); ++i) {
+      y[i] = x[i] * x[i] + 2. * x[i] + 1.;
+    }
+    API::FunctionDomain1D_sptr domain(new API::FunctionDomain1DVector(x));
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitData(y);
+    values->setFitWeights(1.0);
+
+    std::shared_ptr<UserFunction> fun = std::make_shared<UserFunction>();
+    fun->setAttributeValue("Formula", "a*x^2+b*x+c");
+    fun->setParameter("a", 1.0);
+    fun->setParameter("b", 2.0);
+    fun->setParameter("c", 0.5);
+    fun->fix(1);
+
+    std::shared_ptr<CostFuncLeastSquares> costFun = std::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(fun, domain, values);
+
+    TS_ASSERT_DELTA(costFun->valDerivHessian(), 0.375, 1e-10); // == 0.5 * 3 * 0.5^2
+    const EigenVector &g = costFun->getDeriv();
+    TS_ASSERT_EQUALS(g.size(), 2);
+    TS_ASSERT_DELTA(g.get(0), -2.5, 1e-10); // == -0.5 * (0 + 1 + 4)
+    TS_ASSERT_DELTA(g.get(1), -1.5, 1e-10); // == -0.5 * 3
+    const EigenMatrix &H = costFun->getHessian();
+    TS_ASSERT_EQUALS(H.size1(), 2);
+    TS_ASSERT_DELTA(H.get(0, 0), 17.0, 1e-10); // == 0 + 1 + 16
+    TS_ASSERT_DELTA(H.get(0, 1), 5.0, 1e-10);  // == 0 + 1 + 4
+    TS_ASSERT_DELTA(H.get(1, 0), 5.0, 1e-10);
+    TS_ASSERT_DELTA(H.get(1, 1), 3.0, 1e-10);
+  }
+
   void test_Fixing_parameter() {
     std::vector<double> x(10), y(10);
     for (size_t i = 0; i < x.size(); ++i) {
@@ -337,3 +371,35 @@ public:
     }
   }
 };
+
+class LeastSquaresTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LeastSquaresTestPerformance *createSuite() { return new LeastSquaresTestPerformance(); }
+  static void destroySuite(LeastSquaresTestPerformance *suite) { delete suite; }
+
+  // The time of a fit iteration against the number of parameters
+  void test_valDerivHessian_10_parameters() { valDerivHessian(10); }
+  void test_valDerivHessian_50_parameters() { valDerivHessian(50); }
+  void test_valDerivHessian_200_parameters() { valDerivHessian(200); }
+
+private:
+  void valDerivHessian(const int nParams) {
+    API::FunctionDomain1D_sptr domain(new API::FunctionDomain1DVector(-1.0, 1.0, 10000));
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitData(std::vector<double>(domain->size(), 1.0));
+    values->setFitWeights(1.0);
+
+    auto fun = std::make_shared<Polynomial>();
+    fun->initialize();
+    fun->setAttributeValue("n", nParams - 1);
+
+    auto costFun = std::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(fun, domain, values);
+    for (size_t i = 0; i < 10; ++i) {
+      costFun->setParameter(0, 0.1 * static_cast<double>(i));
+      TS_ASSERT_LESS_THAN(0.0, costFun->valDerivHessian());
+    }
+  }
+};
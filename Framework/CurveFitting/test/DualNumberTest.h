@@ -0,0 +1,59 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/DualNumber.h"
+
+#include <cmath>
+
+using Mantid::CurveFitting::DualNumber;
+
+class DualNumberTest : public CxxTest::TestSuite {
+public:
+  void test_constant_has_no_derivatives() {
+    DualNumber<2> c(3.0);
+    TS_ASSERT_EQUALS(c.value(), 3.0);
+    TS_ASSERT_EQUALS(c.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(c.derivative(1), 0.0);
+  }
+
+  void test_arithmetic() {
+    DualNumber<2> x(2.0, 0);
+    DualNumber<2> y(5.0, 1);
+    auto f = (x * y + 3.0 * x) / (y - x) - -x;
+    // f = (xy + 3x) / (y - x) + x
+    TS_ASSERT_DELTA(f.value(), 16.0 / 3.0 + 2.0, 1e-14);
+    // df/dx = (y + 3) / (y - x) + (xy + 3x) / (y - x)^2 + 1
+    TS_ASSERT_DELTA(f.derivative(0), 8.0 / 3.0 + 16.0 / 9.0 + 1.0, 1e-14);
+    // df/dy = x / (y - x) - (xy + 3x) / (y - x)^2
+    TS_ASSERT_DELTA(f.derivative(1), 2.0 / 3.0 - 16.0 / 9.0, 1e-14);
+  }
+
+  void test_functions() {
+    DualNumber<1> x(0.7, 0);
+    TS_ASSERT_DELTA(exp(x).derivative(0), std::exp(0.7), 1e-14);
+    TS_ASSERT_DELTA(log(x).derivative(0), 1.0 / 0.7, 1e-14);
+    TS_ASSERT_DELTA(sqrt(x).derivative(0), 0.5 / std::sqrt(0.7), 1e-14);
+    TS_ASSERT_DELTA(pow(x, 2.5).value(), std::pow(0.7, 2.5), 1e-14);
+    TS_ASSERT_DELTA(pow(x, 2.5).derivative(0), 2.5 * std::pow(0.7, 1.5), 1e-14);
+    TS_ASSERT_DELTA(sin(x).derivative(0), std::cos(0.7), 1e-14);
+    TS_ASSERT_DELTA(cos(x).derivative(0), -std::sin(0.7), 1e-14);
+    TS_ASSERT_DELTA(atan(x).derivative(0), 1.0 / 1.49, 1e-14);
+    TS_ASSERT_DELTA(erfc(x).derivative(0), -M_2_SQRTPI * std::exp(-0.49), 1e-14);
+    TS_ASSERT_DELTA(fabs(-x).derivative(0), 1.0, 1e-14);
+  }
+
+  void test_chain() {
+    DualNumber<2> x(0.5, 1);
+    auto f = chain(3.0 * x, std::tanh(1.5), 1.0 - std::tanh(1.5) * std::tanh(1.5));
+    TS_ASSERT_DELTA(f.value(), std::tanh(1.5), 1e-14);
+    TS_ASSERT_EQUALS(f.derivative(0), 0.0);
+    TS_ASSERT_DELTA(f.derivative(1), 3.0 * (1.0 - std::tanh(1.5) * std::tanh(1.5)), 1e-14);
+  }
+};
@@ -11,6 +11,7 @@
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/Functions/BackToBackExponential.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 #include <cmath>
 
@@ -204,4 +205,58 @@ public:
     TS_ASSERT_EQUALS(b2bExp.intensity(), 2.1);
     TS_ASSERT_EQUALS(b2bExp.intensityError(), b2bExp.getError("I"));
   }
+
+  void test_derivatives_match_numerical_derivatives() {
+    BackToBackExponential b2bExp;
+    b2bExp.initialize();
+    b2bExp.setParameter("I", 2.1);
+    b2bExp.setParameter("A", 1.2);
+    b2bExp.setParameter("B", 0.3);
+    b2bExp.setParameter("X0", 0.5);
+    b2bExp.setParameter("S", 0.7);
+
+    Mantid::API::FunctionDomain1DVector x(-6, 10, 30);
+    Mantid::CurveFitting::Jacobian jacobian(x.size(), 5);
+    Mantid::CurveFitting::Jacobian numerical(x.size(), 5);
+    b2bExp.functionDeriv(x, jacobian);
+    b2bExp.setStepSizeMethod(Mantid::API::IFunction::StepSizeMethod::SQRT_EPSILON);
+    b2bExp.calNumericalDeriv(x, numerical);
+
+    for (size_t i = 0; i < x.size(); ++i) {
+      for (size_t ip = 0; ip < 5; ++ip) {
+        TS_ASSERT_DELTA(jacobian.get(i, ip), numerical.get(i, ip), 1e-5);
+      }
+    }
+  }
+};
+
+class BackToBackExponentialTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BackToBackExponentialTestPerformance *createSuite() { return new BackToBackExponentialTestPerformance(); }
+  static void destroySuite(BackToBackExponentialTestPerformance *suite) { delete suite; }
+
+  BackToBackExponentialTestPerformance() : m_x(-50, 50, 100000), m_jacobian(m_x.size(), 5) {
+    m_b2bExp.initialize();
+    m_b2bExp.setParameter("I", 2.1);
+    m_b2bExp.setParameter("A", 1.2);
+    m_b2bExp.setParameter("B", 0.3);
+    m_b2bExp.setParameter("S", 0.7);
+  }
+
+  void test_automatic_derivatives() {
+    for (size_t i = 0; i < 10; ++i)
+      m_b2bExp.functionDeriv(m_x, m_jacobian);
+  }
+
+  void test_numerical_derivatives() {
+    for (size_t i = 0; i < 10; ++i)
+      m_b2bExp.calNumericalDeriv(m_x, m_jacobian);
+  }
+
+private:
+  BackToBackExponential m_b2bExp;
+  Mantid::API::FunctionDomain1DVector m_x;
+  Mantid::CurveFitting::Jacobian m_jacobian;
 };
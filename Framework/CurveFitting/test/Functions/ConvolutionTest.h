@@ -14,6 +14,7 @@
 
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidDataObjects/TableWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -363,6 +364,95 @@ public:
     }
   }
 
+  void test_resolution_is_recalculated_when_the_domain_changes() {
+    Convolution conv;
+
+    double pi = acos(0.) * 2;
+    double h1 = 3;
+    double s1 = pi / 2;
+    auto res = std::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.);
+    res->setParameter("h", h1);
+    res->setParameter("s", s1);
+    // a fixed resolution is calculated once for a domain and cached
+    for (size_t i = 0; i < res->nParams(); ++i) {
+      res->fix(i);
+    }
+    conv.addFunction(res);
+
+    double h2 = 10.;
+    double s2 = pi / 3;
+    auto fun = std::make_shared<ConvolutionTest_Gauss>();
+    fun->setParameter("h", h2);
+    fun->setParameter("s", s2);
+    conv.addFunction(fun);
+
+    // a convolution of two gaussians is a gaussian with h == hp and s == sp
+    double sp = s1 * s2 / (s1 + s2);
+    double hp = h1 * h2 * sqrt(pi / (s1 + s2));
+
+    // the third domain is the size of the second, the last is the first again
+    const std::vector<std::pair<int, double>> domains{{116, 0.13}, {90, 0.17}, {90, 0.16}, {116, 0.13}};
+    for (const auto &[N, dx] : domains) {
+      std::vector<double> x(N);
+      for (int i = 0; i < N; i++) {
+        x[i] = i * dx;
+      }
+      double c2 = dx * N / 2;
+      fun->setParameter("c", c2);
+
+      FunctionDomain1DView xView(x.data(), N);
+      FunctionValues out(xView);
+      conv.function(xView, out);
+      for (int i = 0; i < N; i++) {
+        double xi = x[i] - c2;
+        TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-10);
+      }
+    }
+  }
+
+  void test_function_can_be_calculated_on_several_domains_in_parallel() {
+    Convolution conv;
+    auto res = FunctionFactory::Instance().createInitialized("name=Gaussian, PeakCentre=0, Height=1, Sigma=0.3");
+    res->fixAll();
+    conv.addFunction(res);
+    conv.addFunction(FunctionFactory::Instance().createInitialized("name=DeltaFunction, Height=2"));
+    conv.addFunction(FunctionFactory::Instance().createInitialized("name=Gaussian, PeakCentre=0, Height=1, "
+                                                                   "Sigma=0.4"));
+
+    // domains of different sizes, the odd ones asymmetric so calculated in Direct mode
+    const int nDomains = 16;
+    std::vector<std::vector<double>> x(nDomains);
+    for (int i = 0; i < nDomains; ++i) {
+      const size_t n = 100 + 10 * i;
+      x[i].resize(n);
+      const double xMax = i % 2 == 0 ? 4.0 : 8.0;
+      for (size_t j = 0; j < n; ++j) {
+        x[i][j] = -4.0 + static_cast<double>(j) * (xMax + 4.0) / static_cast<double>(n - 1);
+      }
+    }
+    std::vector<std::vector<double>> expected(nDomains);
+    for (int i = 0; i < nDomains; ++i) {
+      FunctionDomain1DView domain(x[i].data(), x[i].size());
+      FunctionValues values(domain);
+      conv.function(domain, values);
+      expected[i] = values.toVector();
+    }
+
+    std::vector<std::vector<double>> calculated(nDomains * 10);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < nDomains * 10; ++i) {
+      const auto &xi = x[i % nDomains];
+      FunctionDomain1DView domain(xi.data(), xi.size());
+      FunctionValues values(domain);
+      conv.function(domain, values);
+      calculated[i] = values.toVector();
+    }
+    for (int i = 0; i < nDomains * 10; ++i) {
+      TS_ASSERT_EQUALS(calculated[i], expected[i % nDomains]);
+    }
+  }
+
   void testAttributesSetUpCorrectlyForConvolution() {
     Convolution conv;
     auto func = std::make_shared<ConvolutionTest_LinearWithAttributes>();
@@ -467,3 +557,38 @@ public:
     TS_ASSERT(categories[0] == "General");
   }
 };
+
+class ConvolutionTestPerformance : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ConvolutionTestPerformance *createSuite() { return new ConvolutionTestPerformance(); }
+  static void destroySuite(ConvolutionTestPerformance *suite) { delete suite; }
+
+  ConvolutionTestPerformance() : m_x(2000) {
+    auto resolution = FunctionFactory::Instance().createInitialized("name=Gaussian, PeakCentre=0, Height=1, "
+                                                                    "Sigma=0.02");
+    resolution->fixAll();
+    m_conv.addFunction(resolution);
+    m_conv.addFunction(FunctionFactory::Instance().createInitialized("name=DeltaFunction, Height=0.5"));
+    m_conv.addFunction(FunctionFactory::Instance().createInitialized("name=Lorentzian, PeakCentre=0, "
+                                                                     "Amplitude=1, FWHM=0.1"));
+    const double dx = 1.0 / static_cast<double>(m_x.size() - 1);
+    for (size_t i = 0; i < m_x.size(); ++i) {
+      m_x[i] = -0.5 + static_cast<double>(i) * dx;
+    }
+  }
+
+  void test_repeated_evaluation_with_a_fixed_resolution() {
+    FunctionDomain1DView domain(m_x.data(), m_x.size());
+    FunctionValues values(domain);
+    for (size_t i = 0; i < 2000; ++i) {
+      m_conv.setParameter("f1.f1.FWHM", 0.1 + 1e-5 * static_cast<double>(i));
+      m_conv.function(domain, values);
+    }
+  }
+
+private:
+  Convolution m_conv;
+  std::vector<double> m_x;
+};
@@ -77,6 +77,54 @@ public:
     TS_ASSERT(categories[0] == "General");
   }
 
+  void test_derivatives_are_analytic() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*exp(-x/b)+c/(1+x^2)+sqrt(x)^d"));
+    fun.setParameter("a", 1.5);
+    fun.setParameter("b", 2.0);
+    fun.setParameter("c", 0.7);
+    fun.setParameter("d", 1.3);
+
+    const size_t nParams = 4;
+    const size_t nData = 10;
+    std::vector<double> x(nData);
+    for (size_t i = 0; i < nData; i++) {
+      x[i] = 0.5 + 0.1 * static_cast<double>(i);
+    }
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(nData, nParams);
+    fun.functionDeriv(domain, J);
+
+    for (size_t i = 0; i < nData; i++) {
+      TS_ASSERT_DELTA(J.get(i, 0), exp(-x[i] / 2.0), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 1), 1.5 * exp(-x[i] / 2.0) * x[i] / 4.0, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 2), 1.0 / (1.0 + x[i] * x[i]), 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 3), pow(sqrt(x[i]), 1.3) * log(sqrt(x[i])), 1e-12);
+    }
+  }
+
+  void test_derivatives_are_numerical_if_the_formula_cannot_be_differentiated() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*max(x,b)"));
+    fun.setParameter("a", 2.0);
+    fun.setParameter("b", 0.45);
+
+    const size_t nParams = 2;
+    const size_t nData = 10;
+    std::vector<double> x(nData);
+    for (size_t i = 0; i < nData; i++) {
+      x[i] = 0.1 * static_cast<double>(i);
+    }
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(nData, nParams);
+    fun.functionDeriv(domain, J);
+
+    for (size_t i = 0; i < nData; i++) {
+      TS_ASSERT_DELTA(J.get(i, 0), std::max(x[i], 0.45), 0.03);
+      TS_ASSERT_DELTA(J.get(i, 1), x[i] < 0.45 ? 2.0 : 0.0, 0.03);
+    }
+  }
+
   void test_setAttribute_will_reevaluate_function_if_it_has_changed() {
     UserFunction fun;
     fun.setAttribute("Formula", UserFunction::Attribute("a*x"));
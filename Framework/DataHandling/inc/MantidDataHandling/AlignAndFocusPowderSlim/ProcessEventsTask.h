@@ -8,6 +8,7 @@
 #pragma once
 
 #include "MantidDataHandling/AlignAndFocusPowderSlim/BankCalibration.h"
+#include "MantidKernel/BinEdgeSearch.h"
 #include <ranges>
 #include <tbb/tbb.h>
 #include <vector>
@@ -19,11 +20,11 @@ public:
   ProcessEventsTask(DetIDsVector *detids, TofVector *tofs, const BankCalibration *calibration,
                     const std::vector<double> *binedges)
       : y_temp(binedges->size() - 1, 0), m_detids(detids), m_tofs(tofs), m_calibration(calibration),
-        m_binedges(binedges) {}
+        m_binSearch(*binedges) {}
 
   ProcessEventsTask(ProcessEventsTask &other, tbb::split)
       : y_temp(other.y_temp.size(), 0), m_detids(other.m_detids), m_tofs(other.m_tofs),
-        m_calibration(other.m_calibration), m_binedges(other.m_binedges) {}
+        m_calibration(other.m_calibration), m_binSearch(other.m_binSearch) {}
 
   void operator()(const tbb::blocked_range<size_t> &range) {
     if (m_calibration->empty()) {
@@ -31,10 +32,6 @@ public:
     }
     // Cache values to reduce number of function calls
     const auto &range_end = range.end();
-    const auto &binedges_cbegin = m_binedges->cbegin();
-    const auto &binedges_cend = m_binedges->cend();
-    const auto &tof_min = m_binedges->front();
-    const auto &tof_max = m_binedges->back();
 
     // Calibrate and histogram the data
     auto detid_iter = std::ranges::next(m_detids->begin(), range.begin());
@@ -45,14 +42,9 @@ public:
       if (calib_factor < IGNORE_PIXEL) {
         // Apply calibration
         const double &tof = static_cast<double>(*tof_iter) * calib_factor;
-        if ((tof < tof_max) && (!(tof < tof_min))) { // check against max first to allow skipping second
-          // Find the bin index using binary search
-          const auto &it = std::upper_bound(binedges_cbegin, binedges_cend, tof);
-
-          // Increment the count if a bin was found
-          const auto &bin = static_cast<size_t>(std::distance(binedges_cbegin, it) - 1);
-          y_temp[bin]++;
-        }
+        // Increment the count if a bin was found
+        if (const auto bin = m_binSearch.find(tof))
+          y_temp[*bin]++;
       }
       ++detid_iter;
       ++tof_iter;
@@ -71,7 +63,8 @@ private:
   DetIDsVector *m_detids;
   TofVector *m_tofs;
   const BankCalibration *m_calibration;
-  const std::vector<double> *m_binedges;
+  /// Finds the bin for each event; refers to the bin edges passed to the constructor
+  Kernel::BinEdgeSearch m_binSearch;
 };
 
 } // namespace Mantid::DataHandling::AlignAndFocusPowderSlim
@@ -14,6 +14,7 @@ class BankPulseTimes;
 
 namespace Mantid {
 namespace DataHandling {
+class EventChunkPipeline;
 class LoadEventNexus;
 
 /** Helper class for LoadEventNexus that is specific to the current default
@@ -54,6 +55,11 @@ public:
   /// number of chunks per bank
   size_t eventsPerChunk;
 
+  /// Number of events read from disk at a time
+  size_t eventsPerRead;
+  /// Bounds the events read but not processed and orders their processing
+  EventChunkPipeline *pipeline;
+
   LoadEventNexus *alg;
   EventWorkspaceCollection &m_ws;
 
@@ -0,0 +1,110 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** EventChunkPipeline connects the tasks that read chunks of events from disk
+ * to the tasks that turn them into events, without letting the reads run
+ * arbitrarily far ahead of the processing.
+ *
+ * Reads are given the number of bytes they will allocate when scheduled. They
+ * are passed to the ThreadScheduler while the bytes in flight stay within the
+ * memory limit and held back otherwise. The bytes are returned when the
+ * Reservation taken by the read, and shared with the processing tasks of its
+ * chunk, is destroyed. A read is always let through when nothing is in flight,
+ * so a single chunk larger than the limit cannot stall the pipeline.
+ *
+ * Processing tasks are scheduled into streams. The tasks of one stream run one
+ * at a time in the order they were scheduled, which keeps the chunks of a bank
+ * appending to the same event lists in file order.
+ *
+ * Nothing here blocks a thread of the ThreadPool: held back tasks are pushed to
+ * the scheduler from whichever task releases the memory or finishes the stream.
+ * While any chunk is in flight or any task is held back the scheduler is told
+ * that work is pending, so the threads of the pool wait for it rather than
+ * exiting when the queue runs empty.
+ */
+class MANTID_DATAHANDLING_DLL EventChunkPipeline {
+public:
+  /// Returns the memory reserved for one chunk when destroyed
+  class MANTID_DATAHANDLING_DLL Reservation {
+  public:
+    Reservation(EventChunkPipeline &pipeline, const size_t bytes);
+    ~Reservation();
+    Reservation(const Reservation &) = delete;
+    Reservation &operator=(const Reservation &) = delete;
+
+  private:
+    EventChunkPipeline &m_pipeline;
+    const size_t m_bytes;
+  };
+
+  EventChunkPipeline(Kernel::ThreadScheduler &scheduler, const size_t memoryLimit);
+  ~EventChunkPipeline();
+
+  /// Maximum bytes of chunks in flight
+  size_t memoryLimit() const { return m_memoryLimit; }
+  size_t memoryInFlight() const;
+  size_t numberOfWaitingReads() const;
+
+  void scheduleRead(std::shared_ptr<Kernel::Task> read, const size_t bytes);
+
+  size_t addStream();
+  void scheduleInStream(const size_t stream, std::shared_ptr<Kernel::Task> task,
+                        std::shared_ptr<Reservation> reservation);
+
+private:
+  class StreamTask;
+
+  /// A read waiting for memory
+  struct WaitingRead {
+    std::shared_ptr<Kernel::Task> task;
+    size_t bytes;
+  };
+
+  /// The processing tasks of one stream
+  struct Stream {
+    /// Whether a task of the stream is in the scheduler or running
+    bool busy{false};
+    /// Tasks waiting for the one before them to finish
+    std::deque<std::shared_ptr<Kernel::Task>> waiting;
+  };
+
+  void releaseMemory(const size_t bytes);
+  void streamTaskFinished(const size_t stream);
+  void updatePendingWork();
+
+  /// Scheduler the tasks are passed on to
+  Kernel::ThreadScheduler &m_scheduler;
+  /// Maximum bytes of chunks in flight
+  const size_t m_memoryLimit;
+  /// Bytes of chunks read, or being read, and not yet processed
+  size_t m_memoryInFlight;
+  /// Reads held back until there is memory for them, oldest first
+  std::deque<WaitingRead> m_waitingReads;
+  /// Processing streams, by index
+  std::deque<Stream> m_streams;
+  /// Number of streams with a task in the scheduler or running
+  size_t m_busyStreams;
+  /// Whether the scheduler has been told that work is pending
+  bool m_workPending;
+  /// Protects the members above
+  mutable std::mutex m_mutex;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -24,7 +24,14 @@ class BankPulseTimes;
 class DefaultEventLoader;
 
 /** This task does the disk IO from loading the NXS file, and so will be on a
-  disk IO mutex
+  disk IO mutex.
+
+  Unless the events are compressed while loading, the first task for a bank only
+  reads the pulse information. The events are then read by a chain of tasks,
+  each reading one chunk of DefaultEventLoader::eventsPerRead events, queueing
+  the read of the next chunk and handing its own chunk to ProcessBankData.
+  DefaultEventLoader::pipeline bounds the chunks in flight and keeps the chunks
+  of a bank processed in order.
 */
 class MANTID_DATAHANDLING_DLL LoadBankFromDiskTask : public Kernel::Task {
 
@@ -37,6 +44,28 @@ public:
   void run() override;
 
 private:
+  /// State shared by the tasks that read the chunks of one bank
+  struct BankStream {
+    /// Event index (length of # of pulses), shared by all chunks
+    std::shared_ptr<std::vector<uint64_t>> eventIndex;
+    /// Pulse times for this bank, shared by all chunks
+    std::shared_ptr<BankPulseTimes> pulseTimes;
+    /// One past the last event to load
+    uint64_t stopEvent;
+    /// Largest pixel ID processed in the lower stream, set by the first chunk
+    uint32_t midId;
+    /// Whether midId has been set
+    bool haveMidId;
+    /// Pipeline stream processing pixel IDs up to midId
+    size_t lowerStream;
+    /// Pipeline stream processing pixel IDs above midId
+    size_t upperStream;
+  };
+
+  LoadBankFromDiskTask(const LoadBankFromDiskTask &previous, const uint64_t startEvent);
+  void scheduleChunkRead(const uint64_t startEvent);
+  void runChunk();
+  bool clipToSpectraToLoad();
   void loadPulseTimes(Nexus::File &file);
   std::unique_ptr<std::vector<uint64_t>> loadEventIndex(Nexus::File &file);
   void prepareEventId(Nexus::File &file, uint64_t &start_event, uint64_t &stop_event,
@@ -75,6 +104,8 @@ private:
   bool m_have_weight;
   /// Frame period numbers
   const std::vector<int> m_framePeriodNumbers;
+  /// Set for the tasks reading one chunk of a bank
+  std::shared_ptr<BankStream> m_stream;
 }; // END-DEF-CLASS LoadBankFromDiskTask
 
 } // namespace DataHandling
@@ -162,6 +162,13 @@ private:
                  bool hasFArea, Mantid::Nexus::NXDouble &xErrors, bool hasXErrors, Mantid::Nexus::NXDouble &xbins,
                  int64_t blocksize, int64_t nchannels, int64_t &hist, int64_t &wsIndex,
                  const API::MatrixWorkspace_sptr &local_workspace);
+  /// Read a block of spectra from the Y, E, F and Dx datasets
+  void readBlock(Mantid::Nexus::NXDouble &data, Mantid::Nexus::NXDouble &errors, Mantid::Nexus::NXDouble &farea,
+                 bool hasFArea, Mantid::Nexus::NXDouble &xErrors, bool hasXErrors, int64_t blocksize, int64_t hist);
+  /// Copy a block read by readBlock into the workspace
+  void fillBlock(Mantid::Nexus::NXDouble &data, Mantid::Nexus::NXDouble &errors, Mantid::Nexus::NXDouble &farea,
+                 bool hasFArea, Mantid::Nexus::NXDouble &xErrors, bool hasXErrors, int64_t blocksize, int64_t nchannels,
+                 int64_t wsIndex, const API::MatrixWorkspace_sptr &local_workspace);
 
   /// Load the data from a non-spectra axis (Numeric/Text) into the workspace
   void loadNonSpectraAxis(const API::MatrixWorkspace_sptr &local_workspace, const Mantid::Nexus::NXData &data);
@@ -185,6 +192,8 @@ private:
   bool m_shared_bins;
   /// The cached x binning if we have bins
   HistogramData::BinEdges m_xbins;
+  /// Bin edges of the last spectrum loaded, if they are not shared by all
+  Kernel::cow_ptr<HistogramData::HistogramX> m_previousX;
   /// Numeric values for the second axis, if applicable
   MantidVec m_axis1vals;
 
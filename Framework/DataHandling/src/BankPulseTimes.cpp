@@ -96,22 +96,35 @@ void BankPulseTimes::readData(Nexus::File &file, std::size_t numValues, Mantid::
   Nexus::DimVector indexStart{0};
   Nexus::DimVector indexStep{std::min(numValues, std::size_t(12 * 3600 * 60))}; // 12 hour at 60Hz
 
+  if (indexStep[0] == 0)
+    return;
+  // Nothing below may reallocate while a read into nextData is in flight
+  pulseTimes.reserve(pulseTimes.size() + numValues);
+
   // getSlab needs the data allocated already
   std::vector<ValueType> rawData(indexStep[0]);
+  std::vector<ValueType> nextData;
+  auto pending = file.getSlabAsync(rawData.data(), indexStart, indexStep);
 
   // loop over chunks of data and transform each chunk
-  while ((indexStep[0] > 0) && (indexStart[0] < numValues)) {
-    file.getSlab(rawData.data(), indexStart, indexStep);
+  while (true) {
+    pending.get();
+
+    // increment the slab to get, and read it while this one is transformed
+    indexStart[0] += indexStep[0];
+    indexStep[0] = std::min(indexStep[0], numValues - indexStart[0]);
+    if (indexStep[0] > 0) {
+      nextData.resize(indexStep[0]);
+      pending = file.getSlabAsync(nextData.data(), indexStart, indexStep);
+    }
 
     // Now create the pulseTimes
     std::transform(rawData.cbegin(), rawData.cend(), std::back_inserter(pulseTimes),
                    [start](ValueType incremental_time) { return start + incremental_time; });
 
-    // increment the slab to get
-    indexStart[0] += indexStep[0];
-    indexStep[0] = std::min(indexStep[0], numValues - indexStart[0]);
-    // resize the vector
-    rawData.resize(indexStep[0]);
+    if (indexStep[0] == 0)
+      break;
+    rawData.swap(nextData);
   }
 }
 
@@ -6,8 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidAPI/Progress.h"
+#include "MantidDataHandling/EventChunkPipeline.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
 
@@ -15,6 +17,13 @@ using namespace Mantid::Kernel;
 
 namespace Mantid::DataHandling {
 
+namespace {
+/// Events read from disk at a time if not set in the configuration
+constexpr int DEFAULT_EVENTS_PER_READ = 4000000;
+/// Memory, in MB, for events read but not processed if not set in the configuration
+constexpr int DEFAULT_IN_FLIGHT_MB = 1024;
+} // namespace
+
 void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws, bool haveWeights,
                               bool event_id_is_spec, std::vector<std::string> bankNames,
                               const std::vector<int> &periodLog, const std::string &classType,
@@ -29,10 +38,28 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   ThreadPool pool(scheduler);
   auto diskIOMutex = std::make_shared<std::mutex>();
 
+  // Events are read in chunks, with enough memory in flight for every thread
+  // to have a couple of chunks to work on
+  auto &config = ConfigService::Instance();
+  const auto inFlightMB =
+      std::max(config.getValue<int>("LoadEventNexus.InFlightMemoryMB").value_or(DEFAULT_IN_FLIGHT_MB), 1);
+  const size_t inFlightMemory = static_cast<size_t>(inFlightMB) * 1024 * 1024;
+  const size_t bytesPerEvent = sizeof(uint32_t) + sizeof(float) + (haveWeights ? sizeof(float) : 0);
+  const size_t numThreads = std::max<size_t>(ThreadPool::getNumPhysicalCores(), 1);
+  const auto eventsPerRead =
+      std::max(config.getValue<int>("LoadEventNexus.EventsPerRead").value_or(DEFAULT_EVENTS_PER_READ), 1);
+  loader.eventsPerRead =
+      std::max<size_t>(std::min<size_t>(eventsPerRead, inFlightMemory / (2 * numThreads * bytesPerEvent)), 1);
+  EventChunkPipeline pipeline(*scheduler, inFlightMemory);
+  loader.pipeline = &pipeline;
+
   // set up progress bar for the rest of the (multi-threaded) process
-  size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
+  size_t numReads = 0;
+  for (size_t i = bankRange.first; i < bankRange.second; i++)
+    numReads += (bankNumEvents[i] + loader.eventsPerRead - 1) / loader.eventsPerRead;
+  size_t numProg = bankNames.size() + numReads * (1 + 3); // 1 = disktask, 3 = proc task
   if (loader.splitProcessing)
-    numProg += bankNames.size() * 3; // 3 = second proc task
+    numProg += numReads * 3; // 3 = second proc task
   auto prog = std::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
@@ -50,7 +77,8 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollec
                                        bool event_id_is_spec, const size_t numBanks, const bool precount,
                                        const int chunk, const int totalChunks)
     : m_haveWeights(haveWeights), event_id_is_spec(event_id_is_spec), precount(precount), chunk(chunk),
-      totalChunks(totalChunks), firstChunkForBank(1), eventsPerChunk(0), alg(alg), m_ws(ws) {
+      totalChunks(totalChunks), firstChunkForBank(1), eventsPerChunk(0), eventsPerRead(0), pipeline(nullptr), alg(alg),
+      m_ws(ws) {
   // This map will be used to find the workspace index
   if (event_id_is_spec)
     pixelID_to_wi_vector = m_ws.getSpectrumToWorkspaceIndexVector(pixelID_to_wi_offset);
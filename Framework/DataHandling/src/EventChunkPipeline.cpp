@@ -0,0 +1,189 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataHandling/EventChunkPipeline.h"
+
+#include <utility>
+
+namespace Mantid::DataHandling {
+
+/** Runs a processing task, then lets the next task of its stream go. */
+class EventChunkPipeline::StreamTask : public Kernel::Task {
+public:
+  StreamTask(EventChunkPipeline &pipeline, const size_t stream, std::shared_ptr<Kernel::Task> task,
+             std::shared_ptr<Reservation> reservation)
+      : Kernel::Task(task->cost()), m_pipeline(pipeline), m_stream(stream), m_task(std::move(task)),
+        m_reservation(std::move(reservation)) {
+    setMutex(m_task->getMutex());
+  }
+
+  void run() override {
+    m_task->run();
+    // Free the chunk before the next one in the stream starts
+    m_task.reset();
+    m_reservation.reset();
+    m_pipeline.streamTaskFinished(m_stream);
+  }
+
+private:
+  EventChunkPipeline &m_pipeline;
+  const size_t m_stream;
+  std::shared_ptr<Kernel::Task> m_task;
+  std::shared_ptr<Reservation> m_reservation;
+};
+
+/** Take over memory that has been reserved by EventChunkPipeline::scheduleRead()
+ * @param pipeline :: the pipeline the memory was reserved from
+ * @param bytes :: the number of bytes reserved
+ */
+EventChunkPipeline::Reservation::Reservation(EventChunkPipeline &pipeline, const size_t bytes)
+    : m_pipeline(pipeline), m_bytes(bytes) {}
+
+EventChunkPipeline::Reservation::~Reservation() { m_pipeline.releaseMemory(m_bytes); }
+
+/** Constructor
+ * @param scheduler :: the scheduler to pass the tasks on to
+ * @param memoryLimit :: maximum bytes of chunks to have in flight
+ */
+EventChunkPipeline::EventChunkPipeline(Kernel::ThreadScheduler &scheduler, const size_t memoryLimit)
+    : m_scheduler(scheduler), m_memoryLimit(memoryLimit), m_memoryInFlight(0), m_busyStreams(0),
+      m_workPending(false) {}
+
+EventChunkPipeline::~EventChunkPipeline() {
+  // Tasks left behind by an abort hold reservations that call back into the
+  // pipeline, so destroy them while the members are still valid.
+  {
+    std::deque<Stream> streams;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    streams.swap(m_streams);
+  }
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_workPending)
+    m_scheduler.removePendingWork();
+}
+
+/// @return the bytes of chunks that are being read or waiting to be processed
+size_t EventChunkPipeline::memoryInFlight() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_memoryInFlight;
+}
+
+/// @return the number of reads held back for lack of memory
+size_t EventChunkPipeline::numberOfWaitingReads() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_waitingReads.size();
+}
+
+/** Schedule a task that will read a chunk of events. The task must construct a
+ * Reservation for the same number of bytes when it runs.
+ * @param read :: the task
+ * @param bytes :: the memory the chunk will need until it is processed
+ */
+void EventChunkPipeline::scheduleRead(std::shared_ptr<Kernel::Task> read, const size_t bytes) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_memoryInFlight > 0 && (!m_waitingReads.empty() || m_memoryInFlight + bytes > m_memoryLimit)) {
+      m_waitingReads.push_back({std::move(read), bytes});
+      updatePendingWork();
+      return;
+    }
+    m_memoryInFlight += bytes;
+    updatePendingWork();
+  }
+  m_scheduler.push(std::move(read));
+}
+
+/** Return memory and schedule the reads that now fit
+ * @param bytes :: the number of bytes to return
+ */
+void EventChunkPipeline::releaseMemory(const size_t bytes) {
+  std::deque<std::shared_ptr<Kernel::Task>> ready;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_memoryInFlight -= bytes;
+    // After an abort the scheduler is being cleared and must not be pushed to
+    if (!m_scheduler.getAborted()) {
+      while (!m_waitingReads.empty() &&
+             (m_memoryInFlight == 0 || m_memoryInFlight + m_waitingReads.front().bytes <= m_memoryLimit)) {
+        m_memoryInFlight += m_waitingReads.front().bytes;
+        ready.emplace_back(std::move(m_waitingReads.front().task));
+        m_waitingReads.pop_front();
+      }
+    }
+    updatePendingWork();
+  }
+  for (auto &task : ready)
+    m_scheduler.push(std::move(task));
+}
+
+/** Add a new processing stream
+ * @return the index of the stream
+ */
+size_t EventChunkPipeline::addStream() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_streams.emplace_back();
+  return m_streams.size() - 1;
+}
+
+/** Schedule a task to run after all the tasks already scheduled in a stream
+ * @param stream :: index of the stream, from addStream()
+ * @param task :: the task
+ * @param reservation :: memory of the chunk the task processes, held until it
+ * has run
+ */
+void EventChunkPipeline::scheduleInStream(const size_t stream, std::shared_ptr<Kernel::Task> task,
+                                          std::shared_ptr<Reservation> reservation) {
+  auto streamTask = std::make_shared<StreamTask>(*this, stream, std::move(task), std::move(reservation));
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &thisStream = m_streams.at(stream);
+    if (thisStream.busy) {
+      thisStream.waiting.emplace_back(std::move(streamTask));
+      return;
+    }
+    thisStream.busy = true;
+    ++m_busyStreams;
+    updatePendingWork();
+  }
+  m_scheduler.push(std::move(streamTask));
+}
+
+/** Schedule the next task of a stream
+ * @param stream :: index of the stream whose task finished
+ */
+void EventChunkPipeline::streamTaskFinished(const size_t stream) {
+  std::shared_ptr<Kernel::Task> next;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &thisStream = m_streams[stream];
+    if (thisStream.waiting.empty() || m_scheduler.getAborted()) {
+      thisStream.busy = false;
+      --m_busyStreams;
+      updatePendingWork();
+      return;
+    }
+    next = std::move(thisStream.waiting.front());
+    thisStream.waiting.pop_front();
+  }
+  m_scheduler.push(std::move(next));
+}
+
+/** Tell the scheduler whether work is pending here: chunks in flight, held back
+ * reads or stream tasks. Must be called with the mutex held after every change
+ * to them.
+ */
+void EventChunkPipeline::updatePendingWork() {
+  const bool pending = m_memoryInFlight > 0 || !m_waitingReads.empty() || m_busyStreams > 0;
+  if (pending == m_workPending)
+    return;
+  if (pending)
+    m_scheduler.addPendingWork();
+  else
+    m_scheduler.removePendingWork();
+  m_workPending = pending;
+}
+
+} // namespace Mantid::DataHandling
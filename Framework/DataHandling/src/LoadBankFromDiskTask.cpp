@@ -7,6 +7,7 @@
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/BankPulseTimes.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
+#include "MantidDataHandling/EventChunkPipeline.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankCompressed.h"
 #include "MantidDataHandling/ProcessBankData.h"
@@ -24,6 +25,13 @@
 namespace {
 // this is used for unit conversion to correct units
 const std::string MICROSEC("microseconds");
+
+/// Memory needed to hold the event_id, event_time_offset and, if present,
+/// event_weight of a chunk of events
+size_t chunkBytes(const uint64_t numEvents, const bool haveWeights) {
+  const size_t bytesPerEvent = sizeof(uint32_t) + sizeof(float) + (haveWeights ? sizeof(float) : 0);
+  return static_cast<size_t>(numEvents) * bytesPerEvent;
+}
 } // namespace
 
 namespace Mantid::DataHandling {
@@ -59,6 +67,23 @@ LoadBankFromDiskTask::LoadBankFromDiskTask(DefaultEventLoader &loader, std::stri
   m_max_id = 0;
 }
 
+/** Constructor for the task reading the next chunk of events of a bank
+ *
+ * @param previous :: the task that read the pulse information or the previous
+ * chunk
+ * @param startEvent :: index of the first event to read
+ */
+LoadBankFromDiskTask::LoadBankFromDiskTask(const LoadBankFromDiskTask &previous, const uint64_t startEvent)
+    : Task(previous), m_loader(previous.m_loader), entry_name(previous.entry_name), entry_type(previous.entry_type),
+      prog(previous.prog), scheduler(previous.scheduler), m_loadError(false),
+      m_detIdFieldName(previous.m_detIdFieldName), m_timeOfFlightFieldName(previous.m_timeOfFlightFieldName),
+      m_loadStart(1, startEvent),
+      m_loadSize(1, std::min<uint64_t>(m_loader.eventsPerRead, previous.m_stream->stopEvent - startEvent)),
+      m_min_id(std::numeric_limits<uint32_t>::max()), m_max_id(0), m_have_weight(false),
+      m_framePeriodNumbers(previous.m_framePeriodNumbers), m_stream(previous.m_stream) {
+  m_cost = static_cast<double>(m_loadSize[0]);
+}
+
 /** Load the pulse times, if needed. This sets thisBankPulseTimes to the right pointer.
  */
 void LoadBankFromDiskTask::loadPulseTimes(Nexus::File &file) {
@@ -179,7 +204,7 @@ std::unique_ptr<std::vector<uint32_t>> LoadBankFromDiskTask::loadEventId(Nexus::
   }
 
   // Now we allocate the required arrays
-  auto event_id = std::make_unique<std::vector<uint32_t>>(dim0);
+  auto event_id = std::make_unique<std::vector<uint32_t>>(m_loadSize[0]);
 
   if (!m_loadError) {
     Nexus::IOHelper::readNexusSlab<uint32_t, Nexus::IOHelper::Narrowing::Prevent>(*event_id, file, m_detIdFieldName,
@@ -235,7 +260,7 @@ std::unique_ptr<std::vector<float>> LoadBankFromDiskTask::loadTof(Nexus::File &f
   }
 
   // Allocate the array
-  auto event_time_of_flight = std::make_unique<std::vector<float>>(tof_dim0);
+  auto event_time_of_flight = std::make_unique<std::vector<float>>(m_loadSize[0]);
 
   // Mantid assumes event_time_offset to be float.
   // Nexus only requires event_time_offset to be a NXNumber.
@@ -303,6 +328,11 @@ std::unique_ptr<std::vector<float>> LoadBankFromDiskTask::loadEventWeights(Nexus
 }
 
 void LoadBankFromDiskTask::run() {
+  if (m_stream) {
+    this->runChunk();
+    return;
+  }
+
   // timer for performance
   Mantid::Kernel::Timer timer;
 
@@ -364,7 +394,13 @@ void LoadBankFromDiskTask::run() {
       m_loadStart[0] = start_event;
       m_loadSize[0] = stop_event - start_event;
 
-      if ((m_loader.alg->compressEvents) || ((m_loadSize[0] > 0))) {
+      if (!m_loader.alg->compressEvents && m_loadSize[0] > 0) {
+        // The events are read in chunks by the tasks scheduled below
+        file.closeData();
+        m_stream = std::make_shared<BankStream>(BankStream{event_index, thisBankPulseTimes, stop_event, 0, false,
+                                                           m_loader.pipeline->addStream(),
+                                                           m_loader.pipeline->addStream()});
+      } else if ((m_loader.alg->compressEvents) || ((m_loadSize[0] > 0))) {
         if (m_loader.alg->getCancel()) {
           m_loader.alg->getLogger().error() << "Loading bank " << entry_name << " is cancelled.\n";
           m_loadError = true; // To allow cancelling the algorithm
@@ -419,34 +455,17 @@ void LoadBankFromDiskTask::run() {
     return;
   }
 
-  const auto bank_size = m_max_id - m_min_id;
-  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
-  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
-  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
-  // check that if a range of spectra were requested that these fit within
-  // this bank
-  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
-    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
-                                       // than the max of this bank
-      return;
-    }
-    // the min spectra to load is higher than the min for this bank
-    m_min_id = minSpectraToLoad;
-  }
-  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
-    if (maxSpectraToLoad < m_min_id) {
-      // the maximum spectra to load is less than the minimum of this bank
-      return;
-    }
-    // the max spectra to load is lower than the max for this bank
-    m_max_id = maxSpectraToLoad;
-  }
-  if (m_min_id > m_max_id) {
-    // the min is now larger than the max, this means the entire block of
-    // spectra to load is outside this bank
+  // Start reading the events
+  if (m_stream) {
+    this->scheduleChunkRead(m_loadStart[0]);
+    thisBankPulseTimes.reset();
     return;
   }
 
+  const auto bank_size = m_max_id - m_min_id;
+  if (!this->clipToSpectraToLoad())
+    return;
+
   // schedule the job to generate the event lists
   auto mid_id = m_max_id;
   if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
@@ -536,6 +555,145 @@ void LoadBankFromDiskTask::run() {
   thisBankPulseTimes.reset();
 }
 
+/** Queue the task reading the chunk of events starting at startEvent
+ * @param startEvent :: index of the first event to read
+ */
+void LoadBankFromDiskTask::scheduleChunkRead(const uint64_t startEvent) {
+  std::shared_ptr<LoadBankFromDiskTask> read(new LoadBankFromDiskTask(*this, startEvent));
+  const auto bytes = chunkBytes(read->m_loadSize[0], m_loader.m_haveWeights);
+  m_loader.pipeline->scheduleRead(std::move(read), bytes);
+}
+
+/** Read one chunk of the events of a bank. The read of the following chunk is
+ * queued first, so that it can start as soon as the disk is free, then the
+ * chunk is handed to ProcessBankData in the processing streams of the bank.
+ * The reads share the disk IO mutex, so the next read cannot start before this
+ * one has handed over its chunk, which keeps the chunks in order.
+ */
+void LoadBankFromDiskTask::runChunk() {
+  // timer for performance
+  Mantid::Kernel::Timer timer;
+
+  // Returns the memory of this chunk once every task using it is done
+  const auto reservation = std::make_shared<EventChunkPipeline::Reservation>(
+      *m_loader.pipeline, chunkBytes(m_loadSize[0], m_loader.m_haveWeights));
+
+  if (m_loader.alg->getCancel()) {
+    m_loader.alg->getLogger().error() << "Loading bank " << entry_name << " is cancelled.\n";
+    return;
+  }
+
+  const uint64_t nextEvent = m_loadStart[0] + m_loadSize[0];
+  if (nextEvent < m_stream->stopEvent)
+    this->scheduleChunkRead(nextEvent);
+
+  m_have_weight = m_loader.m_haveWeights;
+  prog->report(entry_name + ": load from disk");
+
+  // arrays to load into
+  std::shared_ptr<std::vector<uint32_t>> event_id;
+  std::shared_ptr<std::vector<float>> event_time_of_flight;
+  std::shared_ptr<std::vector<float>> event_weight;
+
+  Nexus::File file(m_loader.alg->m_filename);
+  try {
+    file.openGroup(m_loader.alg->m_top_entry_name, "NXentry");
+    file.openGroup(entry_name, entry_type);
+    file.openData(m_detIdFieldName);
+    event_id = this->loadEventId(file);
+    if (!m_loadError) {
+      event_time_of_flight = this->loadTof(file);
+      if (m_have_weight)
+        event_weight = this->loadEventWeights(file);
+    }
+  } catch (std::exception &e) {
+    m_loader.alg->getLogger().error() << "Error while loading bank " << entry_name << ":\n";
+    m_loader.alg->getLogger().error() << e.what() << '\n';
+    m_loadError = true;
+  } catch (...) {
+    m_loader.alg->getLogger().error() << "Unspecified error while loading bank " << entry_name << '\n';
+    m_loadError = true;
+  }
+
+  // Close up the file even if errors occured.
+  file.closeGroup();
+  file.close();
+
+  if (m_loadError)
+    return;
+
+  const auto bank_size = m_max_id - m_min_id;
+  if (!this->clipToSpectraToLoad())
+    return;
+
+  // The chunks are processed in two streams split at a pixel ID fixed by the
+  // first chunk, so that each event list is only appended to by one stream.
+  auto &stream = *m_stream;
+  if (!stream.haveMidId) {
+    stream.midId = std::numeric_limits<uint32_t>::max();
+    if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
+      // only split if told to and the section to load is at least 1/4 the size
+      // of the whole bank
+      stream.midId = (m_max_id + m_min_id) / 2;
+    stream.haveMidId = true;
+  }
+
+  const auto numEvents = static_cast<size_t>(m_loadSize[0]);
+  const auto startAt = static_cast<size_t>(m_loadStart[0]);
+  if (m_min_id <= stream.midId) {
+    m_loader.pipeline->scheduleInStream(
+        stream.lowerStream,
+        std::make_shared<ProcessBankData>(m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents,
+                                          startAt, stream.eventIndex, stream.pulseTimes, m_have_weight, event_weight,
+                                          m_min_id, std::min(m_max_id, stream.midId)),
+        reservation);
+  }
+  if (m_max_id > stream.midId) {
+    m_loader.pipeline->scheduleInStream(
+        stream.upperStream,
+        std::make_shared<ProcessBankData>(m_loader, entry_name, prog, event_id, event_time_of_flight, numEvents,
+                                          startAt, stream.eventIndex, stream.pulseTimes, m_have_weight, event_weight,
+                                          std::max(m_min_id, stream.midId + 1), m_max_id),
+        reservation);
+  }
+
+#ifndef _WIN32
+  if (m_loader.alg->getLogger().isDebug())
+    m_loader.alg->getLogger().debug() << "Time to LoadBankFromDisk " << entry_name << " events " << startAt << " to "
+                                      << startAt + numEvents << " " << timer << "\n";
+#endif
+}
+
+/** Restrict the pixel ID range to the spectra requested, if any
+ * @return false if none of the requested spectra are in this bank
+ */
+bool LoadBankFromDiskTask::clipToSpectraToLoad() {
+  const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
+  const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
+  const auto emptyInt = static_cast<uint32_t>(EMPTY_INT());
+  // check that if a range of spectra were requested that these fit within
+  // this bank
+  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
+    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
+                                       // than the max of this bank
+      return false;
+    }
+    // the min spectra to load is higher than the min for this bank
+    m_min_id = minSpectraToLoad;
+  }
+  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
+    if (maxSpectraToLoad < m_min_id) {
+      // the maximum spectra to load is less than the minimum of this bank
+      return false;
+    }
+    // the max spectra to load is lower than the max for this bank
+    m_max_id = maxSpectraToLoad;
+  }
+  // if the min is now larger than the max, the entire block of spectra to load
+  // is outside this bank
+  return m_min_id <= m_max_id;
+}
+
 /**
  * Interpret the value describing the number of events. If the number is
  * positive return it unchanged.
@@ -1183,6 +1183,7 @@ void LoadEventNexus::loadEvents(API::Progress *const prog, const bool monitors)
 
   // Info reporting
   const std::size_t eventsLoaded = m_ws->getNumberEvents();
+  addCounter("Events", static_cast<double>(eventsLoaded));
   g_log.information() << "Read " << eventsLoaded << " events"
                       << ". Shortest TOF: " << shortest_tof << " microsec; longest TOF: " << longest_tof
                       << " microsec.\n";
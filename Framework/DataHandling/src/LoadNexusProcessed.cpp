@@ -67,6 +67,9 @@ namespace {
 // Helper typedef
 using IntArray = std::vector<int>;
 
+// Number of values of each dataset to read at a time when loading a whole workspace
+constexpr dimsize_t VALUES_PER_BLOCK = dimsize_t(1) << 20;
+
 // Struct to contain spectrum information.
 struct SpectraInfo {
   // Number of spectra
@@ -181,8 +184,8 @@ bool isMultiPeriodFile(int nWorkspaceEntries, const Workspace_sptr &sampleWS, Lo
 
 /// Default constructor
 LoadNexusProcessed::LoadNexusProcessed()
-    : m_shared_bins(false), m_xbins(0), m_axis1vals(), m_list(false), m_interval(false), m_spec_min(0),
-      m_spec_max(Mantid::EMPTY_INT()), m_spec_list(), m_filtered_spec_idxs(), m_nexusFile() {}
+    : m_shared_bins(false), m_xbins(0), m_previousX(nullptr), m_axis1vals(), m_list(false), m_interval(false),
+      m_spec_min(0), m_spec_max(Mantid::EMPTY_INT()), m_spec_list(), m_filtered_spec_idxs(), m_nexusFile() {}
 
 /// Destructor defined here so that Nexus::File can be forward declared
 /// in header
@@ -1669,6 +1672,12 @@ API::MatrixWorkspace_sptr LoadNexusProcessed::loadNonEventEntry(NXData &wksp_cls
   }
 
   int blocksize = 8;
+  if (!m_interval && !m_list) {
+    // Loading everything, so read as many spectra at a time as fit in a block
+    const auto spectraPerBlock = std::min<dimsize_t>(VALUES_PER_BLOCK / std::max<dimsize_t>(nchannels, 1), total_specs);
+    blocksize = static_cast<int>(std::max<dimsize_t>(spectraPerBlock, blocksize));
+  }
+  m_previousX = Kernel::cow_ptr<HistogramData::HistogramX>(nullptr);
   // const int fullblocks = nspectra / blocksize;
   // size of the workspace
   // have to cast down to int as later functions require ints
@@ -2223,60 +2232,8 @@ void LoadNexusProcessed::readBinMasking(const NXData &wksp_cls, const API::Matri
 void LoadNexusProcessed::loadBlock(NXDouble &data, NXDouble &errors, NXDouble &farea, bool hasFArea, NXDouble &xErrors,
                                    bool hasXErrors, int64_t blocksize, int64_t nchannels, int64_t &hist,
                                    const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
-  // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
-  // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
-  // otherwise nchannels. See #16298.
-  // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  int64_t final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(hist);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(hist);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(hist);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
-    if (hasXErrors) {
-      local_workspace->setSharedDx(hist, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start, xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
-    }
-
-    local_workspace->setSharedX(hist, m_xbins.cowData());
-    ++hist;
-  }
+  int64_t wsIndex = hist;
+  loadBlock(data, errors, farea, hasFArea, xErrors, hasXErrors, blocksize, nchannels, hist, wsIndex, local_workspace);
 }
 
 /**
@@ -2300,60 +2257,14 @@ void LoadNexusProcessed::loadBlock(NXDouble &data, NXDouble &errors, NXDouble &f
 void LoadNexusProcessed::loadBlock(NXDouble &data, NXDouble &errors, NXDouble &farea, bool hasFArea, NXDouble &xErrors,
                                    bool hasXErrors, int64_t blocksize, int64_t nchannels, int64_t &hist,
                                    int64_t &wsIndex, const API::MatrixWorkspace_sptr &local_workspace) {
-  data.load(blocksize, hist);
-  errors.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
-  // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
-  // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
-  // otherwise nchannels. See #16298.
-  // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  int64_t final(hist + blocksize);
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
-    if (hasXErrors) {
-      local_workspace->setSharedDx(wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start, xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
-    }
-    local_workspace->setSharedX(wsIndex, m_xbins.cowData());
-    ++hist;
-    ++wsIndex;
-  }
+  readBlock(data, errors, farea, hasFArea, xErrors, hasXErrors, blocksize, hist);
+  fillBlock(data, errors, farea, hasFArea, xErrors, hasXErrors, blocksize, nchannels, wsIndex, local_workspace);
+
+  // Every spectrum shares the one set of bin edges
+  for (int64_t i = 0; i < blocksize; ++i)
+    local_workspace->setSharedX(wsIndex + i, m_xbins.cowData());
+  hist += blocksize;
+  wsIndex += blocksize;
 }
 
 /**
@@ -2377,67 +2288,89 @@ void LoadNexusProcessed::loadBlock(NXDouble &data, NXDouble &errors, NXDouble &f
 void LoadNexusProcessed::loadBlock(NXDouble &data, NXDouble &errors, NXDouble &farea, bool hasFArea, NXDouble &xErrors,
                                    bool hasXErrors, NXDouble &xbins, int64_t blocksize, int64_t nchannels,
                                    int64_t &hist, int64_t &wsIndex, const API::MatrixWorkspace_sptr &local_workspace) {
+  readBlock(data, errors, farea, hasFArea, xErrors, hasXErrors, blocksize, hist);
+  xbins.load(blocksize, hist);
+  fillBlock(data, errors, farea, hasFArea, xErrors, hasXErrors, blocksize, nchannels, wsIndex, local_workspace);
+
+  // Spectra with the same bin edges as the one before them share its X
+  const auto nxbins = static_cast<size_t>(xbins.dim1());
+  const double *xbin_start = xbins();
+  const auto sameBins = [nxbins](const HistogramData::HistogramX &x, const double *bins) {
+    return x.size() == nxbins && std::equal(x.cbegin(), x.cend(), bins, [](const double lhs, const double rhs) {
+             return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+           });
+  };
+  for (int64_t i = 0; i < blocksize; ++i) {
+    if (!m_previousX || !sameBins(*m_previousX, xbin_start))
+      m_previousX = Kernel::make_cow<HistogramData::HistogramX>(xbin_start, xbin_start + nxbins);
+    local_workspace->setSharedX(wsIndex + i, m_previousX);
+    xbin_start += nxbins;
+  }
+  hist += blocksize;
+  wsIndex += blocksize;
+}
+
+/**
+ * Read a block of spectra from each of the datasets of a Workspace2D
+ * @param data :: The NXDataSet object of y values
+ * @param errors :: The NXDataSet object of error values
+ * @param farea :: The NXDataSet object of fraction area values
+ * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
+ * @param xErrors :: The NXDataSet object of xError values
+ * @param hasXErrors :: Flag to signal the File contains x errors
+ * @param blocksize :: The number of spectra to read
+ * @param hist :: The index in the file of the first spectrum to read
+ */
+void LoadNexusProcessed::readBlock(NXDouble &data, NXDouble &errors, NXDouble &farea, bool hasFArea,
+                                   NXDouble &xErrors, bool hasXErrors, int64_t blocksize, int64_t hist) {
   data.load(blocksize, hist);
-  double *data_start = data();
-  double *data_end = data_start + nchannels;
   errors.load(blocksize, hist);
-  double *err_start = errors();
-  double *err_end = err_start + nchannels;
-  double *farea_start = nullptr;
-  double *farea_end = nullptr;
-  double *xErrors_start = nullptr;
-  double *xErrors_end = nullptr;
-  size_t dx_increment = nchannels;
+  if (hasFArea)
+    farea.load(blocksize, hist);
+  if (hasXErrors)
+    xErrors.load(blocksize, hist);
+}
+
+/**
+ * Copy a block read by readBlock() into the Y, E, F and Dx of consecutive
+ * spectra, in parallel where the workspace allows it
+ * @param data :: The NXDataSet object of y values
+ * @param errors :: The NXDataSet object of error values
+ * @param farea :: The NXDataSet object of fraction area values
+ * @param hasFArea :: Flag to signal a RebinnedOutput workspace is in use
+ * @param xErrors :: The NXDataSet object of xError values
+ * @param hasXErrors :: Flag to signal the File contains x errors
+ * @param blocksize :: The number of spectra in the block
+ * @param nchannels :: The number of channels for the block
+ * @param wsIndex :: The workspace index of the first spectrum
+ * @param local_workspace :: A pointer to the workspace
+ */
+void LoadNexusProcessed::fillBlock(NXDouble &data, NXDouble &errors, NXDouble &farea, bool hasFArea,
+                                   NXDouble &xErrors, bool hasXErrors, int64_t blocksize, int64_t nchannels,
+                                   int64_t wsIndex, const API::MatrixWorkspace_sptr &local_workspace) {
+  const double *data_start = data();
+  const double *err_start = errors();
+  const double *farea_start = hasFArea ? farea() : nullptr;
+  const double *xErrors_start = hasXErrors ? xErrors() : nullptr;
   // NexusFileIO stores Dx data for all spectra (sharing not preserved) so dim0
   // is the histograms, dim1 is Dx length. For old files this is nchannels+1,
   // otherwise nchannels. See #16298.
   // WARNING: We are dropping the last Dx value for old files!
-  size_t dx_input_increment = xErrors.dim1();
-  RebinnedOutput_sptr rb_workspace;
-  if (hasFArea) {
-    farea.load(blocksize, hist);
-    farea_start = farea();
-    farea_end = farea_start + nchannels;
-    rb_workspace = std::dynamic_pointer_cast<RebinnedOutput>(local_workspace);
-  }
-  xbins.load(blocksize, hist);
-  const int64_t nxbins(xbins.dim1());
-  double *xbin_start = xbins();
-  double *xbin_end = xbin_start + nxbins;
-  int64_t final(hist + blocksize);
-
-  if (hasXErrors) {
-    xErrors.load(blocksize, hist);
-    xErrors_start = xErrors();
-    xErrors_end = xErrors_start + dx_increment;
-  }
-
-  while (hist < final) {
-    auto &Y = local_workspace->mutableY(wsIndex);
-    Y.assign(data_start, data_end);
-    data_start += nchannels;
-    data_end += nchannels;
-    auto &E = local_workspace->mutableE(wsIndex);
-    E.assign(err_start, err_end);
-    err_start += nchannels;
-    err_end += nchannels;
-    if (hasFArea) {
-      MantidVec &F = rb_workspace->dataF(wsIndex);
-      F.assign(farea_start, farea_end);
-      farea_start += nchannels;
-      farea_end += nchannels;
-    }
+  const int64_t dx_input_increment = xErrors.dim1();
+  const auto rb_workspace = hasFArea ? std::dynamic_pointer_cast<RebinnedOutput>(local_workspace) : nullptr;
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int64_t i = 0; i < blocksize; ++i) {
+    const auto index = static_cast<size_t>(wsIndex + i);
+    const int64_t offset = i * nchannels;
+    local_workspace->mutableY(index).assign(data_start + offset, data_start + offset + nchannels);
+    local_workspace->mutableE(index).assign(err_start + offset, err_start + offset + nchannels);
+    if (hasFArea)
+      rb_workspace->dataF(index).assign(farea_start + offset, farea_start + offset + nchannels);
     if (hasXErrors) {
-      local_workspace->setSharedDx(wsIndex, Kernel::make_cow<HistogramData::HistogramDx>(xErrors_start, xErrors_end));
-      xErrors_start += dx_input_increment;
-      xErrors_end += dx_input_increment;
+      const auto dx = xErrors_start + i * dx_input_increment;
+      local_workspace->setSharedDx(index, Kernel::make_cow<HistogramData::HistogramDx>(dx, dx + nchannels));
     }
-    auto &X = local_workspace->mutableX(wsIndex);
-    X.assign(xbin_start, xbin_end);
-    xbin_start += nxbins;
-    xbin_end += nxbins;
-    ++hist;
-    ++wsIndex;
   }
 }
 
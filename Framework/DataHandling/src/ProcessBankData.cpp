@@ -4,6 +4,7 @@
 //   NScD Oak Ridge National Laboratory, European Spallation Source,
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
+#include <algorithm>
 #include <utility>
 
 #include "MantidDataHandling/DefaultEventLoader.h"
@@ -59,9 +60,15 @@ void ProcessBankData::preCountAndReserveMem() {
     if (counts[pixelIndex] > 0) {
       const size_t wi = getWorkspaceIndexFromPixelID(pixID);
       // Find the workspace index corresponding to that pixel ID
-      // Allocate it
+      // Allocate it, on top of the events from earlier chunks of the bank
       if (wi < numEventLists) {
-        outputWS.reserveEventListAt(wi, counts[pixelIndex]);
+        const auto &eventList = outputWS.getSpectrum(wi);
+        const size_t needed = eventList.getNumberEvents() + counts[pixelIndex];
+        const size_t capacity = eventList.capacity();
+        // Grow at least geometrically so that a pixel filled over many chunks
+        // is not copied again for every chunk
+        if (needed > capacity)
+          outputWS.reserveEventListAt(wi, std::max(needed, 2 * capacity));
       }
       if ((wi % 20 == 0) && alg->getCancel())
         return; // User cancellation
@@ -23,6 +23,7 @@
 #include "MantidDataObjects/RebinnedOutput.h"
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidHistogramData/Histogram.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <filesystem>
 #include <memory>
@@ -204,6 +205,9 @@ namespace {
 
 const double _DEFAULT_FILL_VALUE(0.0);
 
+// Number of values to gather into one slab when writing a 2D dataset
+constexpr size_t _VALUES_PER_BLOCK(size_t(1) << 20);
+
 // Typedef for vector-accessor member functions with signatures like:
 //   `const HistogramData::HistogramY & Mantid::API::MatrixWorkspace::y 	( 	const size_t  	index	)
 //   const`
@@ -243,24 +247,22 @@ void _writeChunkedData(std::shared_ptr<Nexus::File> dest, // Must have open grou
   // (If compressionType == NXcompression::NONE, this just creates a non-compressed dataset.)
   dest->makeCompData(name, NXnumtype::FLOAT64, dims, compressionType, chunk_dims, true);
 
-  // Prepare a padding vector. (Unfortunately, NeXus-api does not access `setFillValue`.)
-  const bool pad_data(fillValue != _DEFAULT_FILL_VALUE);
-  const std::vector<double> vFill(pad_data ? chunk_size : 0, fillValue);
-
-  // Write the data.
-  Nexus::DimVector start{0, 0};
-  for (size_t n : indices) {
-    const auto &v = ((*src).*vData)(n);
-    const Nexus::DimVector data_dims = {1, v.size()};
-    dest->putSlab(_dataPointer<V>(v), start, data_dims);
-    if (pad_data && data_dims[1] != chunk_size) {
-      // Fill the remainder of the slab.
-      const Nexus::DimVector fill_dims = {1, chunk_size - data_dims[1]};
-      const Nexus::DimVector _start = {start[0], data_dims[1]};
-      dest->putSlab(vFill.data(), _start, fill_dims);
+  // Write the data as blocks of whole rows, gathered in parallel. Short rows are padded with the
+  // fill value. (Unfortunately, NeXus-api does not access `setFillValue`.)
+  const size_t block_rows = std::max(size_t(1), _VALUES_PER_BLOCK / std::max(chunk_size, size_t(1)));
+  std::vector<double> block(std::min(block_rows, N_chunk) * chunk_size);
+  for (size_t first = 0; first < N_chunk; first += block_rows) {
+    const size_t rows = std::min(block_rows, N_chunk - first);
+    PARALLEL_FOR_IF(Kernel::threadSafe(*src))
+    for (int64_t row = 0; row < static_cast<int64_t>(rows); ++row) {
+      const auto &v = ((*src).*vData)(indices[first + static_cast<size_t>(row)]);
+      const auto out = block.begin() + static_cast<size_t>(row) * chunk_size;
+      const auto end = std::copy(_dataPointer<V>(v), _dataPointer<V>(v) + v.size(), out);
+      std::fill(end, out + chunk_size, fillValue);
     }
-
-    ++start[0];
+    const Nexus::DimVector start = {first, 0};
+    const Nexus::DimVector data_dims = {rows, chunk_size};
+    dest->putSlab(block.data(), start, data_dims);
   }
 
   if (closeData)
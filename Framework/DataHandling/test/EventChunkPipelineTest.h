@@ -0,0 +1,272 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataHandling/EventChunkPipeline.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerMutexes.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using Mantid::DataHandling::EventChunkPipeline;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Records the order tasks are run in
+class RecordingTask : public Task {
+public:
+  RecordingTask(std::vector<int> &record, const int id) : m_record(record), m_id(id) {}
+  void run() override { m_record.emplace_back(m_id); }
+
+private:
+  std::vector<int> &m_record;
+  const int m_id;
+};
+
+/// Stands in for a read: holds its memory until it has run
+class ReadTask : public Task {
+public:
+  ReadTask(EventChunkPipeline &pipeline, const size_t bytes) : m_pipeline(pipeline), m_bytes(bytes) {}
+  void run() override { EventChunkPipeline::Reservation reservation(m_pipeline, m_bytes); }
+
+private:
+  EventChunkPipeline &m_pipeline;
+  const size_t m_bytes;
+};
+
+/// A read that returns its memory, then keeps its thread busy until the read
+/// that was held back for the memory has started on another thread
+class OverlappingReadTask : public Task {
+public:
+  OverlappingReadTask(EventChunkPipeline &pipeline, const size_t bytes, std::atomic<bool> &otherStarted,
+                      std::atomic<bool> &overlapped)
+      : m_pipeline(pipeline), m_bytes(bytes), m_otherStarted(otherStarted), m_overlapped(overlapped) {}
+
+  void run() override {
+    {
+      EventChunkPipeline::Reservation reservation(m_pipeline, m_bytes);
+      // Give idle threads the time to find the queue empty
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!m_otherStarted && std::chrono::steady_clock::now() < timeout)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    m_overlapped = m_otherStarted.load();
+  }
+
+private:
+  EventChunkPipeline &m_pipeline;
+  const size_t m_bytes;
+  std::atomic<bool> &m_otherStarted;
+  std::atomic<bool> &m_overlapped;
+};
+
+/// A read that only flags that it has started
+class FlaggingReadTask : public Task {
+public:
+  FlaggingReadTask(EventChunkPipeline &pipeline, const size_t bytes, std::atomic<bool> &started)
+      : m_pipeline(pipeline), m_bytes(bytes), m_started(started) {}
+
+  void run() override {
+    EventChunkPipeline::Reservation reservation(m_pipeline, m_bytes);
+    m_started = true;
+  }
+
+private:
+  EventChunkPipeline &m_pipeline;
+  const size_t m_bytes;
+  std::atomic<bool> &m_started;
+};
+
+/// Reads a chunk, queueing the next, then processes it in a stream
+class ChainedReadTask : public Task {
+public:
+  ChainedReadTask(EventChunkPipeline &pipeline, const size_t stream, const int chunk, const int numChunks,
+                  std::vector<int> &record, std::atomic<size_t> &maxInFlight)
+      : m_pipeline(pipeline), m_stream(stream), m_chunk(chunk), m_numChunks(numChunks), m_record(record),
+        m_maxInFlight(maxInFlight) {}
+
+  void run() override {
+    auto reservation = std::make_shared<EventChunkPipeline::Reservation>(m_pipeline, BYTES);
+    auto inFlight = m_pipeline.memoryInFlight();
+    auto previous = m_maxInFlight.load();
+    while (previous < inFlight && !m_maxInFlight.compare_exchange_weak(previous, inFlight)) {
+    }
+    // Nothing stops the next read overtaking this one, so hand over this chunk first
+    m_pipeline.scheduleInStream(m_stream, std::make_shared<RecordingTask>(m_record, m_chunk), reservation);
+    if (m_chunk + 1 < m_numChunks)
+      m_pipeline.scheduleRead(
+          std::make_shared<ChainedReadTask>(m_pipeline, m_stream, m_chunk + 1, m_numChunks, m_record, m_maxInFlight),
+          BYTES);
+  }
+
+  static constexpr size_t BYTES = 100;
+
+private:
+  EventChunkPipeline &m_pipeline;
+  const size_t m_stream;
+  const int m_chunk;
+  const int m_numChunks;
+  std::vector<int> &m_record;
+  std::atomic<size_t> &m_maxInFlight;
+};
+} // namespace
+
+class EventChunkPipelineTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventChunkPipelineTest *createSuite() { return new EventChunkPipelineTest(); }
+  static void destroySuite(EventChunkPipelineTest *suite) { delete suite; }
+
+  void test_reads_are_held_back_beyond_the_memory_limit() {
+    ThreadSchedulerFIFO scheduler;
+    EventChunkPipeline pipeline(scheduler, 250);
+
+    for (size_t i = 0; i < 4; ++i)
+      pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+    TS_ASSERT_EQUALS(scheduler.size(), 2);
+    TS_ASSERT_EQUALS(pipeline.numberOfWaitingReads(), 2);
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 200);
+
+    // Running a read frees its memory, letting the next one through
+    scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(scheduler.size(), 2);
+    TS_ASSERT_EQUALS(pipeline.numberOfWaitingReads(), 1);
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 200);
+
+    while (!scheduler.empty())
+      scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(pipeline.numberOfWaitingReads(), 0);
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 0);
+  }
+
+  void test_read_larger_than_the_limit_is_let_through_when_nothing_is_in_flight() {
+    ThreadSchedulerFIFO scheduler;
+    EventChunkPipeline pipeline(scheduler, 10);
+
+    pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+    pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+    TS_ASSERT_EQUALS(scheduler.size(), 1);
+
+    scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(scheduler.size(), 1);
+    scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 0);
+  }
+
+  void test_stream_runs_its_tasks_one_at_a_time_in_order() {
+    ThreadSchedulerFIFO scheduler;
+    EventChunkPipeline pipeline(scheduler, 1000);
+    const auto stream = pipeline.addStream();
+    const auto otherStream = pipeline.addStream();
+
+    std::vector<int> record;
+    for (int i = 0; i < 3; ++i)
+      pipeline.scheduleInStream(stream, std::make_shared<RecordingTask>(record, i), nullptr);
+    pipeline.scheduleInStream(otherStream, std::make_shared<RecordingTask>(record, 10), nullptr);
+    // Only the first task of each stream is runnable
+    TS_ASSERT_EQUALS(scheduler.size(), 2);
+
+    while (!scheduler.empty())
+      scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(record, std::vector<int>({0, 10, 1, 2}));
+  }
+
+  void test_memory_is_held_until_processing_is_done() {
+    ThreadSchedulerFIFO scheduler;
+    EventChunkPipeline pipeline(scheduler, 1000);
+    const auto stream = pipeline.addStream();
+
+    std::vector<int> record;
+    std::atomic<size_t> maxInFlight{0};
+    pipeline.scheduleRead(std::make_shared<ChainedReadTask>(pipeline, stream, 0, 1, record, maxInFlight),
+                          ChainedReadTask::BYTES);
+    scheduler.pop(0)->run();
+    // The chunk has been read but not processed
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), ChainedReadTask::BYTES);
+    scheduler.pop(0)->run();
+    TS_ASSERT_EQUALS(record, std::vector<int>({0}));
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 0);
+  }
+
+  void test_scheduler_knows_of_pending_work() {
+    ThreadSchedulerFIFO scheduler;
+    {
+      EventChunkPipeline pipeline(scheduler, 100);
+      const auto stream = pipeline.addStream();
+      TS_ASSERT(!scheduler.hasPendingWork());
+
+      pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+      pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+      TS_ASSERT(scheduler.hasPendingWork());
+      while (!scheduler.empty())
+        scheduler.pop(0)->run();
+      TS_ASSERT(!scheduler.hasPendingWork());
+
+      std::vector<int> record;
+      pipeline.scheduleInStream(stream, std::make_shared<RecordingTask>(record, 0), nullptr);
+      TS_ASSERT(scheduler.hasPendingWork());
+      scheduler.pop(0)->run();
+      TS_ASSERT(!scheduler.hasPendingWork());
+
+      // Work left behind is forgotten with the pipeline
+      pipeline.scheduleRead(std::make_shared<ReadTask>(pipeline, 100), 100);
+    }
+    TS_ASSERT(!scheduler.hasPendingWork());
+  }
+
+  void test_threads_wait_for_reads_held_back_by_a_small_memory_limit() {
+    auto scheduler = new ThreadSchedulerFIFO;
+    ThreadPool pool(scheduler, 2);
+    EventChunkPipeline pipeline(*scheduler, ChainedReadTask::BYTES);
+
+    std::atomic<bool> secondStarted{false};
+    std::atomic<bool> overlapped{false};
+    pipeline.scheduleRead(
+        std::make_shared<OverlappingReadTask>(pipeline, ChainedReadTask::BYTES, secondStarted, overlapped),
+        ChainedReadTask::BYTES);
+    pipeline.scheduleRead(std::make_shared<FlaggingReadTask>(pipeline, ChainedReadTask::BYTES, secondStarted),
+                          ChainedReadTask::BYTES);
+    TS_ASSERT_EQUALS(pipeline.numberOfWaitingReads(), 1);
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+
+    // The second read ran on the other thread while the first was still running
+    TS_ASSERT(secondStarted);
+    TS_ASSERT(overlapped);
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 0);
+  }
+
+  void test_chained_reads_in_thread_pool() {
+    auto scheduler = new ThreadSchedulerMutexes;
+    ThreadPool pool(scheduler, 4);
+    EventChunkPipeline pipeline(*scheduler, 3 * ChainedReadTask::BYTES);
+
+    const int numChunks = 50;
+    std::vector<std::vector<int>> records(3);
+    std::atomic<size_t> maxInFlight{0};
+    for (auto &record : records) {
+      const auto stream = pipeline.addStream();
+      pipeline.scheduleRead(std::make_shared<ChainedReadTask>(pipeline, stream, 0, numChunks, record, maxInFlight),
+                            ChainedReadTask::BYTES);
+    }
+    TS_ASSERT_THROWS_NOTHING(pool.joinAll());
+
+    std::vector<int> expected(numChunks);
+    std::iota(expected.begin(), expected.end(), 0);
+    for (const auto &record : records)
+      TS_ASSERT_EQUALS(record, expected);
+    TS_ASSERT_LESS_THAN_EQUALS(maxInFlight.load(), pipeline.memoryLimit());
+    TS_ASSERT_EQUALS(pipeline.memoryInFlight(), 0);
+  }
+};
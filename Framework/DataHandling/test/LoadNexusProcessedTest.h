@@ -1372,6 +1372,38 @@ public:
     doRaggedWorkspaceTest(raggedWS);
   }
 
+  void test_spectra_with_equal_bins_share_X_after_load() {
+    MatrixWorkspace_sptr ws = WorkspaceCreationHelper::create2DWorkspace(4, 2);
+    ws->setHistogram(0, Histogram(BinEdges{1., 2., 3.}, Counts{1., 2.}));
+    ws->setHistogram(1, Histogram(BinEdges{1., 2., 3.}, Counts{3., 4.}));
+    ws->setHistogram(2, Histogram(BinEdges{2., 4., 6.}, Counts{5., 6.}));
+    ws->setHistogram(3, Histogram(BinEdges{2., 4., 6.}, Counts{7., 8.}));
+
+    const std::string filename = "testSharedBinsAfterLoad.nxs";
+    SaveNexusProcessed save;
+    save.initialize();
+    save.setProperty("InputWorkspace", ws);
+    save.setPropertyValue("Filename", filename);
+    save.execute();
+
+    LoadNexusProcessed load;
+    load.setChild(true);
+    load.initialize();
+    load.setProperty("Filename", filename);
+    load.setProperty("OutputWorkspace", "dummy");
+    load.execute();
+    MatrixWorkspace_sptr loaded = load.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(&loaded->x(0), &loaded->x(1));
+    TS_ASSERT_DIFFERS(&loaded->x(1), &loaded->x(2));
+    TS_ASSERT_EQUALS(&loaded->x(2), &loaded->x(3));
+    TS_ASSERT_EQUALS(loaded->x(2).rawData(), ws->x(2).rawData());
+    TS_ASSERT_EQUALS(loaded->y(3).rawData(), ws->y(3).rawData());
+
+    if (std::filesystem::exists(filename))
+      std::filesystem::remove(filename);
+  }
+
 private:
   template <typename TYPE>
   void check_log(Mantid::API::MatrixWorkspace_sptr &workspace, const std::string &logName, const int noOfEntries,
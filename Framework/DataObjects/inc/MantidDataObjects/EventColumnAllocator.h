@@ -0,0 +1,62 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MappedFileArena.h"
+
+#include <memory>
+#include <type_traits>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** Allocator for the columns of EventColumns. Without an arena it allocates
+ * from the heap like std::allocator; with one, the column lives in the
+ * scratch files of a Kernel::MappedFileArena.
+ *
+ * The arena travels with the column on copy, move and swap, so a file-backed
+ * EventList stays file-backed when it is copied.
+ */
+template <typename T> class EventColumnAllocator {
+public:
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  EventColumnAllocator() noexcept = default;
+  /// @param arena :: the arena to allocate from, or nullptr for the heap
+  explicit EventColumnAllocator(std::shared_ptr<Kernel::MappedFileArena> arena) noexcept : m_arena(std::move(arena)) {}
+  template <typename U> EventColumnAllocator(const EventColumnAllocator<U> &other) noexcept : m_arena(other.arena()) {}
+
+  T *allocate(const std::size_t n) {
+    if (m_arena)
+      return static_cast<T *>(m_arena->allocate(n * sizeof(T)));
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, const std::size_t n) noexcept {
+    if (m_arena)
+      m_arena->deallocate(p, n * sizeof(T));
+    else
+      std::allocator<T>().deallocate(p, n);
+  }
+
+  /// The arena allocated from, or nullptr for the heap
+  const std::shared_ptr<Kernel::MappedFileArena> &arena() const noexcept { return m_arena; }
+
+  template <typename U> bool operator==(const EventColumnAllocator<U> &rhs) const noexcept {
+    return m_arena == rhs.arena();
+  }
+
+private:
+  std::shared_ptr<Kernel::MappedFileArena> m_arena;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,121 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/EventColumnAllocator.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** @class Mantid::DataObjects::EventColumns
+
+  Structure-of-arrays storage for the events of a single EventList.
+
+  Each property of an event lives in its own contiguous column so that passes
+  which only need the time-of-flight (histogramming, unit conversion, masking)
+  stream through 8 bytes per event rather than the full event struct. Columns
+  that are not meaningful for the current EventType are left empty:
+
+    - TOF: tof and pulse time (weights are implicitly 1)
+    - WEIGHTED: tof, pulse time, weight and error squared
+    - WEIGHTED_NOTIME: tof, weight and error squared
+
+  Pulse times are held as total nanoseconds, which is the internal
+  representation of Types::Core::DateAndTime.
+
+  Given a Kernel::MappedFileArena the columns are allocated in its scratch
+  files, which lets the operating system page them out to disk rather than
+  swap.
+*/
+class MANTID_DATAOBJECTS_DLL EventColumns {
+public:
+  /// A single column
+  template <typename T> using Column = std::vector<T, EventColumnAllocator<T>>;
+
+  EventColumns(const API::EventType eventType = API::EventType::TOF,
+               std::shared_ptr<Kernel::MappedFileArena> arena = nullptr);
+
+  void assign(const std::vector<Types::Event::TofEvent> &events);
+  void assign(const std::vector<WeightedEvent> &events);
+  void assign(const std::vector<WeightedEventNoTime> &events);
+
+  void copyInto(std::vector<Types::Event::TofEvent> &events) const;
+  void copyInto(std::vector<WeightedEvent> &events) const;
+  void copyInto(std::vector<WeightedEventNoTime> &events) const;
+
+  /// The type of event held in the columns
+  API::EventType getEventType() const { return m_eventType; }
+  void switchTo(const API::EventType newType);
+
+  /// Number of events held
+  size_t size() const { return m_tof.size(); }
+  /// True if there are no events
+  bool empty() const { return m_tof.empty(); }
+  void clear();
+  size_t getMemorySize() const;
+
+  /// True if the events carry a weight and error
+  bool hasWeights() const { return m_eventType != API::EventType::TOF; }
+  /// True if the events carry a pulse time
+  bool hasPulseTimes() const { return m_eventType != API::EventType::WEIGHTED_NOTIME; }
+  /// The arena the columns are allocated in, or nullptr if they are on the heap
+  std::shared_ptr<Kernel::MappedFileArena> arena() const { return m_tof.get_allocator().arena(); }
+
+  /// Time-of-flight column
+  const Column<double> &tofs() const { return m_tof; }
+  /// Pulse time column in nanoseconds, empty for WEIGHTED_NOTIME
+  const Column<int64_t> &pulseTimes() const { return m_pulseTime; }
+  /// Weight column, empty for TOF
+  const Column<float> &weights() const { return m_weight; }
+  /// Error squared column, empty for TOF
+  const Column<float> &errorSquareds() const { return m_errorSquared; }
+
+  /// Weight of a single event
+  double weight(const size_t i) const { return m_weight.empty() ? 1.0 : static_cast<double>(m_weight[i]); }
+  /// Error squared of a single event
+  double errorSquared(const size_t i) const {
+    return m_errorSquared.empty() ? 1.0 : static_cast<double>(m_errorSquared[i]);
+  }
+
+  void sortTof();
+  void reverse();
+
+  void convertTof(const double factor, const double offset);
+  void convertTof(const std::function<double(double)> &func);
+
+  size_t maskTof(const double tofMin, const double tofMax);
+  size_t maskCondition(const std::vector<bool> &mask);
+
+  void multiply(const double value, const double error);
+
+  bool operator==(const EventColumns &rhs) const;
+
+private:
+  template <typename Predicate> size_t removeIf(Predicate keep);
+
+  /// What type of event is held
+  API::EventType m_eventType;
+  /// Time-of-flight of each event
+  Column<double> m_tof;
+  /// Pulse time of each event, in nanoseconds
+  Column<int64_t> m_pulseTime;
+  /// Weight of each event
+  Column<float> m_weight;
+  /// Square of the error of each event
+  Column<float> m_errorSquared;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
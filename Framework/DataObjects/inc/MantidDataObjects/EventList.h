@@ -26,7 +26,9 @@ namespace Kernel {
 class Unit;
 } // namespace Kernel
 namespace DataObjects {
+class EventColumns;
 class EventWorkspaceMRU;
+class PackedEvents;
 
 /// How the event list is sorted.
 enum EventSortType {
@@ -38,6 +40,18 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// How the events of an event list are laid out in memory.
+enum EventStorageType {
+  /// One vector of event structs (the default)
+  ROW_STORAGE,
+  /// One vector per event property; see EventColumns
+  COLUMN_STORAGE,
+  /// Column storage in memory-mapped scratch files; see Kernel::MappedFileArena
+  FILE_BACKED_STORAGE,
+  /// Events sorted by time-of-flight and compressed; see PackedEvents
+  PACKED_STORAGE
+};
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -103,6 +117,9 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
+    if (m_columns || m_packed)
+      this->useRowStorage();
+    this->invalidateHistogram();
     this->events->emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
@@ -114,6 +131,9 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
+    if (m_columns || m_packed)
+      this->useRowStorage();
+    this->invalidateHistogram();
     this->weightedEvents->emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
@@ -125,6 +145,9 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
+    if (m_columns || m_packed)
+      this->useRowStorage();
+    this->invalidateHistogram();
     this->weightedEventsNoTime->emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
@@ -150,10 +173,15 @@ public:
 
   void setMRU(EventWorkspaceMRU *newMRU);
 
+  /// Version of the events, which changes whenever they are modified
+  uint64_t getDataVersion() const { return m_dataVersion; }
+
   void clearData() override;
 
   void reserve(size_t num) override;
 
+  size_t capacity() const;
+
   void sort(const EventSortType order) const;
 
   void setSortOrder(const EventSortType order) const;
@@ -168,6 +196,11 @@ public:
 
   EventSortType getSortType() const;
 
+  void setStorageType(const EventStorageType storage,
+                      std::shared_ptr<const std::vector<int64_t>> pulseTable = nullptr);
+
+  EventStorageType getStorageType() const;
+
   // X-vector accessors. These reset the MRU for this spectrum
   void setX(const Kernel::cow_ptr<HistogramData::HistogramX> &X) override;
   MantidVec &dataX() override;
@@ -338,15 +371,24 @@ private:
   /// List of WeightedEvent's
   mutable std::unique_ptr<std::vector<WeightedEventNoTime>> weightedEventsNoTime;
 
+  /// The events in column storage. When set, the event vector of the current type is empty.
+  mutable std::unique_ptr<EventColumns> m_columns;
+
+  /// The events in packed storage. When set, the event vector of the current type is empty.
+  mutable std::unique_ptr<PackedEvents> m_packed;
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
   /// Last sorting order
   mutable EventSortType order;
 
-  /// MRU lists of the parent EventWorkspace
+  /// Histogram cache of the parent EventWorkspace
   mutable EventWorkspaceMRU *mru;
 
+  /// Incremented whenever the events change, so cached histograms can be recognised as out of date
+  uint64_t m_dataVersion{0};
+
   /// Mutex that is locked while sorting an event list
   mutable std::mutex m_sortMutex;
 
@@ -360,7 +402,7 @@ private:
                                                                      const double &tofOffset) const;
 
   void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
-  void generateCountsHistogram(const double step, const MantidVec &X, MantidVec &Y) const;
+  void generateCountsHistogramUnsorted(const MantidVec &X, MantidVec &Y) const;
 
 public:
   static std::optional<size_t> findLinearBin(const MantidVec &X, const double tof, const double divisor,
@@ -380,6 +422,11 @@ private:
 
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void useRowStorage() const;
+  /// Mark any cached histogram of this list as out of date
+  void invalidateHistogram() { ++m_dataVersion; }
+  void generateAndCacheHistogram(Kernel::cow_ptr<HistogramData::HistogramY> &yData,
+                                 Kernel::cow_ptr<HistogramData::HistogramE> &eData) const;
   // should not be called externally
   void sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, const double seconds) const;
 
@@ -406,8 +453,18 @@ private:
   template <class T>
   static void histogramForWeightsHelper(const std::vector<T> &events, const MantidVec &X, MantidVec &Y, MantidVec &E);
   template <class T>
-  static void histogramForWeightsHelper(const std::vector<T> &events, const double step, const MantidVec &X,
-                                        MantidVec &Y, MantidVec &E);
+  static void histogramForWeightsUnsortedHelper(const std::vector<T> &events, const MantidVec &X, MantidVec &Y,
+                                                MantidVec &E);
+  static void histogramForColumnsHelper(const EventColumns &columns, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                        bool skipError);
+  static void histogramForColumnsUnsortedHelper(const EventColumns &columns, const MantidVec &X, MantidVec &Y,
+                                                MantidVec &E, bool skipError);
+  static void integrateColumnsHelper(const EventColumns &columns, const double minX, const double maxX,
+                                     const bool entireRange, double &sum, double &error);
+  static void histogramForPackedHelper(const PackedEvents &packed, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                       bool skipError);
+  static void integratePackedHelper(const PackedEvents &packed, const double minX, const double maxX,
+                                    const bool entireRange, double &sum, double &error);
   template <class T>
   static void integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
                               double &sum, double &error);
@@ -130,6 +130,8 @@ public:
   // Change the event type
   void switchEventType(const Mantid::API::EventType type);
 
+  void setStorageType(const EventStorageType storage);
+
   // Returns true always - an EventWorkspace always represents histogramm-able
   // data
   bool isHistogramData() const override;
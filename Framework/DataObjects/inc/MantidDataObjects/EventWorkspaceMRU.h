@@ -8,14 +8,15 @@
 
 #include "MantidDataObjects/DllConfig.h"
 #include "MantidHistogramData/HistogramE.h"
+#include "MantidHistogramData/HistogramX.h"
 #include "MantidHistogramData/HistogramY.h"
-#include "MantidKernel/Exception.h"
-#include "MantidKernel/MRUList.h"
 #include "MantidKernel/cow_ptr.h"
 
-#include "Poco/RWLock.h"
-
+#include <atomic>
 #include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace Mantid {
@@ -25,78 +26,87 @@ class EventList;
 
 //============================================================================
 //============================================================================
-/**
- * This little class holds data and an index marker that is used for uniqueness.
- * This is used in the MRUList.
- */
-template <class T> class TypeWithMarker {
-public:
-  /**
-   * Constructor.
-   * @param the_index :: unique index into the workspace of this data
-   */
-  TypeWithMarker(const uintptr_t the_index) : m_index(the_index) {}
-  TypeWithMarker(const TypeWithMarker &other) = delete;
-  TypeWithMarker &operator=(const TypeWithMarker &other) = delete;
-
-public:
-  /// Unique index value.
-  uintptr_t m_index;
-
-  /// Pointer to a vector of data
-  T m_data;
-
-  /// Function returns a unique index, used for hashing for MRU list
-  uintptr_t hashIndexFunction() const { return m_index; }
-
-  /// Set the unique index value.
-  void setIndex(const uintptr_t the_index) { m_index = the_index; }
-};
-
-//============================================================================
-//============================================================================
-/** This is a container for the MRU (most-recently-used) list
- * of generated histograms.
+/** This is a cache of the histograms generated from the EventLists of an
+ * EventWorkspace, with at most one entry per spectrum.
+ *
+ * Each entry remembers the bin edges and the version of the events it was made
+ * from (see EventList::getDataVersion()). An entry is only returned while both
+ * still match, so mutating an EventList through its own methods marks its
+ * histogram dirty without having to touch the cache. Events changed through a
+ * reference kept from a non-const accessor such as EventList::getEvents() are
+ * not seen, so code doing that must still call EventWorkspace::clearMRU().
+ *
+ * The Y and E held are kept within a memory budget, taken from the
+ * "EventWorkspace.HistogramCacheSizeMB" configuration key, by dropping the
+ * least recently used entries first. Large caches are split by spectrum into
+ * stripes, each with its own lock and an even share of the budget, so that
+ * threads reading different spectra rarely wait for each other.
  */
 class MANTID_DATAOBJECTS_DLL EventWorkspaceMRU {
 public:
+  using XType = Kernel::cow_ptr<HistogramData::HistogramX>;
   using YType = Kernel::cow_ptr<HistogramData::HistogramY>;
   using EType = Kernel::cow_ptr<HistogramData::HistogramE>;
-  using YWithMarker = TypeWithMarker<YType>;
-  using EWithMarker = TypeWithMarker<EType>;
-  // Typedef for a Most-Recently-Used list of Data objects.
-  using mru_listY = Kernel::MRUList<YWithMarker>;
-  using mru_listE = Kernel::MRUList<EWithMarker>;
 
-  ~EventWorkspaceMRU();
-
-  void ensureEnoughBuffersY(size_t thread_num) const;
-  void ensureEnoughBuffersE(size_t thread_num) const;
+  EventWorkspaceMRU();
+  EventWorkspaceMRU(const size_t memoryBudget);
 
   void clear();
 
-  YType findY(size_t thread_num, const EventList *index);
-  EType findE(size_t thread_num, const EventList *index);
-  void insertY(size_t thread_num, YType data, const EventList *index);
-  void insertE(size_t thread_num, EType data, const EventList *index);
+  YType findY(const EventList *index, const XType &x, const uint64_t version) const;
+  EType findE(const EventList *index, const XType &x, const uint64_t version) const;
+  void insert(const EventList *index, const XType &x, const uint64_t version, YType y, EType e);
 
   void deleteIndex(const EventList *index);
 
-  /** Return how many entries in the Y MRU list are used.
-   * Only used in tests. It only returns the 0-th MRU list size.
-   * @return :: number of entries in the MRU list. */
+  /** Return how many spectra have a cached histogram.
+   * @return :: number of entries in the cache. */
   size_t MRUSize() const;
 
-protected:
-  /// The most-recently-used list of dataY histograms
-  mutable std::vector<std::unique_ptr<mru_listY>> m_bufferedDataY;
-
-  /// The most-recently-used list of dataE histograms
-  mutable std::vector<std::unique_ptr<mru_listE>> m_bufferedDataE;
-
-  /// Mutex when adding entries in the MRU list
-  mutable Poco::RWLock m_changeMruListsMutexE;
-  mutable Poco::RWLock m_changeMruListsMutexY;
+  size_t getMemorySize() const;
+  size_t getMemoryBudget() const;
+  void setMemoryBudget(const size_t memoryBudget);
+
+private:
+  /// A cached histogram and what it was generated from
+  struct Entry {
+    /// Bin edges used to generate the histogram
+    XType x;
+    /// EventList::getDataVersion() when the histogram was generated
+    uint64_t version;
+    YType y;
+    EType e;
+    /// Bytes held by y and e
+    size_t memory;
+    /// Position in Stripe::recency
+    std::list<const EventList *>::iterator position;
+  };
+
+  /// The entries of a subset of the spectra, with their own lock and budget
+  struct Stripe {
+    /// The cached histograms, by spectrum
+    std::unordered_map<const EventList *, Entry> entries;
+    /// Spectra in the order their histograms were last used, least recent first
+    std::list<const EventList *> recency;
+    /// Bytes of Y and E currently cached
+    size_t memorySize{0};
+    /// Maximum bytes of Y and E to cache
+    size_t memoryBudget{0};
+    /// Mutex protecting the stripe. Finding an entry also updates its recency.
+    std::mutex mutex;
+
+    const Entry *findValid(const EventList *index, const XType &x, const uint64_t version);
+    void eraseEntry(std::unordered_map<const EventList *, Entry>::iterator entry);
+    void evictToBudget();
+    void clear();
+  };
+
+  Stripe &stripeFor(const EventList *index) const;
+
+  /// The stripes, each holding the spectra that hash to it
+  mutable std::vector<Stripe> m_stripes;
+  /// Maximum bytes of Y and E to cache, over all the stripes
+  std::atomic<size_t> m_memoryBudget;
 };
 
 } // namespace DataObjects
@@ -16,6 +16,7 @@
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
 #include "MantidKernel/ISaveable.h"
 #include "MantidKernel/VMD.h"
+#include <functional>
 #include <iosfwd>
 #include <mutex>
 
@@ -150,6 +151,14 @@ public:
                                               const bool *maskDim) const override;
   void transformDimensions(std::vector<double> &scaling, std::vector<double> &offset) override;
 
+  /// Describe this box to a level of detail: take boxes whole or get the leaves
+  void getBoxesAtLevelOfDetail(std::vector<MDBoxBase<MDE, nd> *> &leaves,
+                               const std::function<bool(const MDBoxBase<MDE, nd> &)> &takeWhole,
+                               Mantid::Geometry::MDImplicitFunction *function = nullptr,
+                               const std::vector<bool> *maskedBoxes = nullptr);
+  /// Find, by box ID, the boxes that are masked or have a masked box under them
+  bool findMaskedBoxes(std::vector<bool> &maskedBoxes) const;
+
   //-----------------------------------------------------------------------------------------------
   /** Set the extents of this box.
    * @param dim :: index of dimension
@@ -314,6 +323,11 @@ protected:
    * @param end :: iterator before end (not included)
    */
   template <typename EventIterator> void calcCaches(const EventIterator &begin, const EventIterator &end);
+  /// Go down the boxes for getBoxesAtLevelOfDetail()
+  void addBoxesAtLevelOfDetail(std::vector<MDBoxBase<MDE, nd> *> &leaves,
+                               const std::function<bool(const MDBoxBase<MDE, nd> &)> &takeWhole,
+                               Mantid::Geometry::MDImplicitFunction *function,
+                               const std::vector<bool> &maskedBoxes);
   /** Array of MDDimensionStats giving the extents and
    * other stats on the box dimensions.
    */
@@ -122,6 +122,100 @@ TMDE(std::vector<Mantid::Kernel::VMD> MDBoxBase)::getVertexes() const {
   return out;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Describe this box, and everything under it, to a level of detail. Going
+ * down from this box, each box is offered to takeWhole, which takes it, from
+ * its cached signal, error, centroid and number of events, if it is detailed
+ * enough for the caller. The boxes under a box taken are not visited. A leaf
+ * that is not taken is added to leaves. A box with any masked box under it is
+ * never offered, and a masked leaf is always added to leaves.
+ *
+ * This lets a coarse cut use O(boxes) cached moments instead of O(events).
+ *
+ * @param[out] leaves :: the leaves not taken whole are added to this
+ * @param takeWhole :: takes a box in place of the boxes under it and returns
+ *true, or returns false to go down into the box
+ * @param function :: if not nullptr, only boxes that touch it are visited
+ * @param maskedBoxes :: the boxes with a masked box under them, from
+ *findMaskedBoxes(). Found here if nullptr; pass them to reuse them across calls
+ */
+TMDE(void MDBoxBase)::getBoxesAtLevelOfDetail(std::vector<MDBoxBase<MDE, nd> *> &leaves,
+                                             const std::function<bool(const MDBoxBase<MDE, nd> &)> &takeWhole,
+                                             Mantid::Geometry::MDImplicitFunction *function,
+                                             const std::vector<bool> *maskedBoxes) {
+  if (maskedBoxes) {
+    this->addBoxesAtLevelOfDetail(leaves, takeWhole, function, *maskedBoxes);
+    return;
+  }
+  std::vector<bool> masked;
+  this->findMaskedBoxes(masked);
+  this->addBoxesAtLevelOfDetail(leaves, takeWhole, function, masked);
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Find the boxes that are masked, or have a masked box under them, visiting
+ * each box once.
+ *
+ * @param[out] maskedBoxes :: set true at the ID of each such box, and false at
+ *the IDs of the other boxes. Grown to fit the IDs.
+ * @return true if this box is masked or has a masked box under it
+ */
+TMDE(bool MDBoxBase)::findMaskedBoxes(std::vector<bool> &maskedBoxes) const {
+  const size_t numChildren = this->getNumChildren();
+  bool masked = false;
+  if (numChildren == 0) {
+    masked = this->getIsMasked();
+  } else {
+    for (size_t i = 0; i < numChildren; ++i) {
+      // Visit all the children to mark every box under this one
+      if (static_cast<const MDBoxBase<MDE, nd> *>(this->getChild(i))->findMaskedBoxes(maskedBoxes))
+        masked = true;
+    }
+  }
+  const size_t id = this->getID();
+  if (id >= maskedBoxes.size())
+    maskedBoxes.resize(id + 1, false);
+  maskedBoxes[id] = masked;
+  return masked;
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Go down the boxes for getBoxesAtLevelOfDetail()
+ *
+ * @param[out] leaves :: the leaves not taken whole are added to this
+ * @param takeWhole :: takes a box in place of the boxes under it
+ * @param function :: if not nullptr, only boxes that touch it are visited
+ * @param maskedBoxes :: the boxes with a masked box under them
+ */
+TMDE(void MDBoxBase)::addBoxesAtLevelOfDetail(std::vector<MDBoxBase<MDE, nd> *> &leaves,
+                                             const std::function<bool(const MDBoxBase<MDE, nd> &)> &takeWhole,
+                                             Mantid::Geometry::MDImplicitFunction *function,
+                                             const std::vector<bool> &maskedBoxes) {
+  if (function) {
+    size_t numVertexes = 0;
+    const auto vertexes = this->getVertexesArray(numVertexes);
+    const auto contact = function->boxContact(vertexes.get(), numVertexes);
+    if (contact == Mantid::Geometry::MDImplicitFunction::NOT_TOUCHING)
+      return;
+    // Everything under a box inside the function is inside it too
+    if (contact == Mantid::Geometry::MDImplicitFunction::CONTAINED)
+      function = nullptr;
+  }
+
+  const size_t id = this->getID();
+  const bool masked = id < maskedBoxes.size() ? maskedBoxes[id] : this->getIsMasked();
+  if (!masked && takeWhole(*this))
+    return;
+  const size_t numChildren = this->getNumChildren();
+  if (numChildren == 0) {
+    leaves.emplace_back(this);
+    return;
+  }
+  for (size_t i = 0; i < numChildren; ++i)
+    static_cast<MDBoxBase<MDE, nd> *>(this->getChild(i))
+        ->addBoxesAtLevelOfDetail(leaves, takeWhole, function, maskedBoxes);
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Return the vertices of every corner of the box, but as
  * a bare array of length numVertices * nd
@@ -0,0 +1,210 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IBoxControllerIO.h"
+#include "MantidAPI/IMDNode.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ProgressBase.h"
+
+#include <future>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** MDBoxSlabIO : saves and loads the events of all the boxes of an
+  MDEventWorkspace whose events are held in memory, in large slabs.
+
+  Saving box by box with MDBox::saveAt, or loading with
+  MDBox::loadAndAddFrom, makes one small read or write for every box. Each of
+  these takes the file lock of the IBoxControllerIO while the box converts its
+  events to or from the table of numbers in the file. Instead, runs of boxes
+  that are next to each other in the file are gathered into slabs of about
+  slabEvents events. The conversion of the boxes of a slab is done in parallel,
+  and each slab is written, or the next one read, by another thread while the
+  following one is being converted. The file then sees a few large
+  reads or writes and the conversion is no longer serialized behind it.
+
+  Saving takes the events straight from the boxes, so boxes that are already
+  file backed, e.g. by SaveMD with MakeFileBacked, are not put in the write
+  buffer of their DiskBuffer. Boxes whose events are only on file are not
+  loaded to be saved.
+
+  @tparam MDE :: the type of MDEvent
+  @tparam nd :: the number of dimensions
+*/
+template <typename MDE, size_t nd> class MDBoxSlabIO {
+public:
+  /// Default number of events in a slab
+  static constexpr uint64_t DEFAULT_SLAB_EVENTS = uint64_t{1} << 20;
+
+  /** Constructor
+   * @param io :: the opened file to save to or load from
+   * @param slabEvents :: the most events in one slab, unless one box has more
+   */
+  MDBoxSlabIO(const API::IBoxControllerIO &io, const uint64_t slabEvents = DEFAULT_SLAB_EVENTS)
+      : m_io(io), m_slabEvents(slabEvents) {}
+
+  /** Save the events of the boxes. Masked boxes are not saved, as in SaveMD.
+   * @param boxes :: all the boxes of the workspace, indexed by box ID
+   * @param eventIndex :: the file position and number of events of each box
+   * @param prog :: reports one step for each slab if not nullptr
+   */
+  void save(const std::vector<API::IMDNode *> &boxes, const std::vector<uint64_t> &eventIndex,
+            Kernel::ProgressBase *prog = nullptr) const {
+    const auto slabs = findSlabs(boxes, eventIndex, true);
+    if (prog)
+      prog->setNumSteps(static_cast<int64_t>(slabs.size()));
+    const size_t numColumns = numberOfColumns();
+
+    std::vector<coord_t> packed;
+    std::vector<coord_t> writing;
+    std::future<void> written;
+    for (const auto &slab : slabs) {
+      packed.resize(slab.numEvents * numColumns);
+      const auto first = static_cast<int64_t>(slab.firstBox);
+      const auto end = static_cast<int64_t>(slab.endBox);
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = first; i < end; ++i) {
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+        if (!box || eventIndex[2 * i + 1] == 0)
+          continue;
+        std::vector<coord_t> boxData;
+        size_t boxColumns;
+        box->getEventsData(boxData, boxColumns);
+        std::copy(boxData.cbegin(), boxData.cend(), packed.begin() + (eventIndex[2 * i] - slab.position) * numColumns);
+      }
+
+      // Only one write at a time: wait for the last slab before the next
+      if (written.valid())
+        written.get();
+      std::swap(packed, writing);
+      written = std::async(std::launch::async,
+                           [this, &writing, position = slab.position]() { m_io.saveBlock(writing, position); });
+      if (prog)
+        prog->report("Saving Box");
+    }
+    if (written.valid())
+      written.get();
+  }
+
+  /** Load the events of the boxes, adding them to any events already there
+   * @param boxes :: all the boxes of the workspace, indexed by box ID
+   * @param eventIndex :: the file position and number of events of each box
+   * @param prog :: reports one step for each slab if not nullptr
+   */
+  void load(const std::vector<API::IMDNode *> &boxes, const std::vector<uint64_t> &eventIndex,
+            Kernel::ProgressBase *prog = nullptr) const {
+    const auto slabs = findSlabs(boxes, eventIndex, false);
+    if (prog)
+      prog->setNumSteps(static_cast<int64_t>(slabs.size()));
+    const size_t numColumns = numberOfColumns();
+
+    std::vector<coord_t> packed;
+    std::vector<coord_t> reading;
+    std::future<void> read;
+    auto startReading = [this, &reading, &read, &slabs](const size_t slab) {
+      read = std::async(std::launch::async, [this, &reading, slab = slabs[slab]]() {
+        m_io.loadBlock(reading, slab.position, static_cast<size_t>(slab.numEvents));
+      });
+    };
+    if (!slabs.empty())
+      startReading(0);
+    for (size_t s = 0; s < slabs.size(); ++s) {
+      read.get();
+      std::swap(packed, reading);
+      // Read the next slab while this one is converted
+      if (s + 1 < slabs.size())
+        startReading(s + 1);
+
+      const auto &slab = slabs[s];
+      const auto first = static_cast<int64_t>(slab.firstBox);
+      const auto end = static_cast<int64_t>(slab.endBox);
+      PARALLEL_FOR_NO_WSP_CHECK()
+      for (int64_t i = first; i < end; ++i) {
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+        if (!box || eventIndex[2 * i + 1] == 0)
+          continue;
+        const auto begin = packed.cbegin() + (eventIndex[2 * i] - slab.position) * numColumns;
+        const std::vector<coord_t> boxData(begin, begin + eventIndex[2 * i + 1] * numColumns);
+        box->reserveMemoryForLoad(eventIndex[2 * i + 1]);
+        MDE::dataToEvents(boxData, box->getEvents(), false);
+        box->releaseEvents();
+      }
+      if (prog)
+        prog->report();
+    }
+  }
+
+private:
+  /// A run of boxes that are next to each other in the file
+  struct Slab {
+    /// Index of the first box
+    size_t firstBox;
+    /// One past the index of the last box
+    size_t endBox;
+    /// Position of the first event in the file
+    uint64_t position;
+    /// Number of events in the boxes
+    uint64_t numEvents;
+  };
+
+  /** Group the boxes into slabs
+   * @param boxes :: all the boxes of the workspace
+   * @param eventIndex :: the file position and number of events of each box
+   * @param skipMasked :: leave masked boxes out of the slabs
+   * @return the slabs, in the order of the boxes
+   */
+  std::vector<Slab> findSlabs(const std::vector<API::IMDNode *> &boxes, const std::vector<uint64_t> &eventIndex,
+                              const bool skipMasked) const {
+    std::vector<Slab> slabs;
+    bool open = false;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      const uint64_t position = eventIndex[2 * i];
+      const uint64_t numEvents = eventIndex[2 * i + 1];
+      if (skipMasked && boxes[i]->getIsMasked()) {
+        open = false;
+        continue;
+      }
+      if (numEvents == 0) {
+        if (open)
+          slabs.back().endBox = i + 1;
+        continue;
+      }
+      if (open) {
+        auto &slab = slabs.back();
+        if (position == slab.position + slab.numEvents && slab.numEvents + numEvents <= m_slabEvents) {
+          slab.endBox = i + 1;
+          slab.numEvents += numEvents;
+          continue;
+        }
+      }
+      slabs.emplace_back(Slab{i, i + 1, position, numEvents});
+      open = true;
+    }
+    return slabs;
+  }
+
+  /// @return the number of values stored for each event
+  static size_t numberOfColumns() {
+    std::vector<coord_t> data;
+    size_t numColumns;
+    double totalSignal, totalErrSq;
+    MDE::eventsToData(std::vector<MDE>(), data, numColumns, totalSignal, totalErrSq);
+    return numColumns;
+  }
+
+  /// The file to save to or load from
+  const API::IBoxControllerIO &m_io;
+  /// The most events in one slab
+  const uint64_t m_slabEvents;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
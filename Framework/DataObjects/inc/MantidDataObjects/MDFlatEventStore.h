@@ -0,0 +1,189 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDBoxBase.h"
+#include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** MDFlatEventStore : a read-only copy of the events of an MDEventWorkspace
+  held in one contiguous array, with the box structure kept as an implicit
+  index of offset ranges into that array.
+
+  The boxes of the tree are numbered in depth-first (pre-)order, which is the
+  order MDEventTreeBuilder lays out the Morton-sorted events in. The events of
+  every box, leaf or not, are then one contiguous range of the array and the
+  boxes under a box are one contiguous range of box numbers, so finding the
+  boxes in a region and reading their events are linear scans of flat arrays
+  instead of chasing pointers through MDGridBox and MDBox.
+
+  The copy is made in bulk: the box table is built in one walk of the tree and
+  the events of the leaves are then copied into place in parallel. It does not
+  follow later changes to the workspace. As it doubles the memory held by the
+  events, it only pays off when it is built once and read many times; it is
+  not worth making for a single pass over the events.
+
+  @tparam MDE :: the type of MDEvent
+  @tparam nd :: the number of dimensions
+*/
+template <typename MDE, size_t nd> class MDFlatEventStore {
+public:
+  /** Copy the events and box structure of a tree of boxes
+   * @param root :: the top box of the tree, usually MDEventWorkspace::getBox()
+   */
+  explicit MDFlatEventStore(MDBoxBase<MDE, nd> &root) {
+    std::vector<MDBox<MDE, nd> *> leaves;
+    size_t numEvents = 0;
+    addBox(root, leaves, numEvents);
+
+    m_events.resize(numEvents);
+    const auto numLeaves = static_cast<int64_t>(leaves.size());
+    const auto *bc = root.getBoxController();
+    // Boxes on file share one file handle so cannot be read in parallel
+    const bool parallel = !(bc && bc->isFileBacked());
+    PARALLEL_FOR_IF(parallel)
+    for (int64_t i = 0; i < numLeaves; ++i) {
+      auto *leaf = leaves[i];
+      const auto &events = leaf->getConstEvents();
+      std::copy(events.cbegin(), events.cend(), m_events.begin() + m_eventBegin[m_leafBoxes[i]]);
+      leaf->releaseEvents();
+    }
+  }
+
+  /// Number of boxes, leaves and grid boxes
+  size_t getNumBoxes() const { return m_subtreeEnd.size(); }
+  /// Number of events in all boxes
+  size_t getNPoints() const { return m_events.size(); }
+  /// True if the box has no boxes under it
+  bool isLeaf(const size_t box) const { return m_subtreeEnd[box] == box + 1; }
+  /// One past the number of the last box under a box
+  size_t getSubtreeEnd(const size_t box) const { return m_subtreeEnd[box]; }
+  /// Number of events in a box and all the boxes under it
+  size_t getNPoints(const size_t box) const { return m_eventEnd[box] - m_eventBegin[box]; }
+  /// First event of a box
+  const MDE *eventsBegin(const size_t box) const { return m_events.data() + m_eventBegin[box]; }
+  /// One past the last event of a box
+  const MDE *eventsEnd(const size_t box) const { return m_events.data() + m_eventEnd[box]; }
+  /// Total signal of the box, as cached in the tree
+  signal_t getSignal(const size_t box) const { return m_signal[box]; }
+  /// Total squared error of the box, as cached in the tree
+  signal_t getErrorSquared(const size_t box) const { return m_errorSquared[box]; }
+  /// True if the box was masked
+  bool getIsMasked(const size_t box) const { return m_masked[box] != 0; }
+  /// Minimum of the box in a dimension
+  coord_t getMin(const size_t box, const size_t d) const { return m_min[box * nd + d]; }
+  /// Maximum of the box in a dimension
+  coord_t getMax(const size_t box, const size_t d) const { return m_max[box * nd + d]; }
+
+  /** Get the 2^nd vertexes of a box, in the order of
+   * MDBoxBase::getVertexesArray
+   * @param box :: number of the box
+   * @param[out] vertexes :: nd coordinates for each vertex
+   * @return the number of vertexes
+   */
+  size_t getVertexes(const size_t box, std::vector<coord_t> &vertexes) const {
+    const size_t numVertexes = size_t{1} << nd;
+    vertexes.resize(numVertexes * nd);
+    for (size_t i = 0; i < numVertexes; ++i) {
+      for (size_t d = 0; d < nd; ++d)
+        vertexes[i * nd + d] = (i & (size_t{1} << d)) ? getMax(box, d) : getMin(box, d);
+    }
+    return numVertexes;
+  }
+
+  /** Get the leaves that touch an implicit function, in depth-first order,
+   * as MDGridBox::getBoxes does for the tree
+   * @param[out] leaves :: numbers of the leaf boxes
+   * @param function :: the region to look in, or nullptr for all leaves
+   */
+  void getLeaves(std::vector<size_t> &leaves, Geometry::MDImplicitFunction *function) const {
+    std::vector<coord_t> vertexes;
+    size_t box = 0;
+    while (box < getNumBoxes()) {
+      auto contact = Geometry::MDImplicitFunction::CONTAINED;
+      if (function) {
+        const size_t numVertexes = getVertexes(box, vertexes);
+        contact = function->boxContact(vertexes.data(), numVertexes);
+      }
+      if (contact == Geometry::MDImplicitFunction::NOT_TOUCHING) {
+        box = getSubtreeEnd(box);
+      } else if (contact == Geometry::MDImplicitFunction::CONTAINED) {
+        for (size_t under = box; under < getSubtreeEnd(box); ++under) {
+          if (isLeaf(under))
+            leaves.emplace_back(under);
+        }
+        box = getSubtreeEnd(box);
+      } else {
+        if (isLeaf(box))
+          leaves.emplace_back(box);
+        ++box;
+      }
+    }
+  }
+
+private:
+  /** Add a box and the boxes under it to the table, in depth-first order
+   * @param box :: the box to add
+   * @param leaves :: the leaves added so far
+   * @param numEvents :: the number of events in the leaves added so far
+   */
+  void addBox(MDBoxBase<MDE, nd> &box, std::vector<MDBox<MDE, nd> *> &leaves, size_t &numEvents) {
+    const size_t index = m_subtreeEnd.size();
+    m_subtreeEnd.emplace_back(0);
+    m_eventBegin.emplace_back(numEvents);
+    m_eventEnd.emplace_back(0);
+    m_signal.emplace_back(box.getSignal());
+    m_errorSquared.emplace_back(box.getErrorSquared());
+    m_masked.emplace_back(box.getIsMasked());
+    for (size_t d = 0; d < nd; ++d) {
+      m_min.emplace_back(box.getExtents(d).getMin());
+      m_max.emplace_back(box.getExtents(d).getMax());
+    }
+
+    if (auto *leaf = dynamic_cast<MDBox<MDE, nd> *>(&box)) {
+      m_leafBoxes.emplace_back(index);
+      leaves.emplace_back(leaf);
+      numEvents += leaf->getNPoints();
+    } else {
+      for (size_t i = 0; i < box.getNumChildren(); ++i)
+        addBox(*dynamic_cast<MDBoxBase<MDE, nd> *>(box.getChild(i)), leaves, numEvents);
+    }
+    m_subtreeEnd[index] = m_subtreeEnd.size();
+    m_eventEnd[index] = numEvents;
+  }
+
+  /// The events of all the leaves, in depth-first order
+  std::vector<MDE> m_events;
+  /// For each box, one past the number of the last box under it
+  std::vector<size_t> m_subtreeEnd;
+  /// For each box, index of its first event
+  std::vector<size_t> m_eventBegin;
+  /// For each box, one past the index of its last event
+  std::vector<size_t> m_eventEnd;
+  /// For each box, the cached total signal
+  std::vector<signal_t> m_signal;
+  /// For each box, the cached total squared error
+  std::vector<signal_t> m_errorSquared;
+  /// For each box, whether it is masked
+  std::vector<char> m_masked;
+  /// For each box, nd minimum coordinates
+  std::vector<coord_t> m_min;
+  /// For each box, nd maximum coordinates
+  std::vector<coord_t> m_max;
+  /// Number of the box of each leaf, in depth-first order
+  std::vector<size_t> m_leafBoxes;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
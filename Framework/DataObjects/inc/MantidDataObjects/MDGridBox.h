@@ -187,12 +187,9 @@ public:
                              "(as its meaning for MDbox is dubious too)"));
   }
   //-------------------------------------------------------------------------
-  /** The function used to satisfy IMDNode interface but the physical meaning is
-   * unclear */
-  coord_t *getCentroid() const override {
-    throw(std::runtime_error("This function should not be called on MDGridBox "
-                             "(as its meaning for MDbox is dubious too)"));
-  }
+  /** @return the signal-weighted centroid of the boxes within, as cached by
+   * refreshCache() or calculateGridCaches() */
+  coord_t *getCentroid() const override { return this->m_centroid; }
 
 public:
   /// Typedef for a shared pointer to a MDGridBox
@@ -235,7 +232,9 @@ private:
   size_t getLinearIndex(size_t *indices) const;
 
   size_t computeSizesFromSplit();
+  void calculateCentroidFromChildren() const;
   void fillBoxShell(const size_t tot, const coord_t ChildInverseVolume);
+  void distributeEvents(const std::vector<MDE> &events);
   /**private default copy constructor as the only correct constructor is the one
    * with box controller */
   MDGridBox(const MDGridBox<MDE, nd> &box);
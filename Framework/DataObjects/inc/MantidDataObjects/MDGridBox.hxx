@@ -9,6 +9,7 @@
 #include "MantidDataObjects/MDEvent.h"
 #include "MantidDataObjects/MDGridBox.h"
 #include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadPool.h"
@@ -103,10 +104,7 @@ TMDE(MDGridBox)::MDGridBox(MDBox<MDE, nd> *box)
 
   // Prepare to distribute the events that were in the box before, this will
   // load missing events from HDD in file based ws if there are some.
-  const std::vector<MDE> &events = box->getConstEvents();
-  // just add event to the existing internal box
-  for (const auto &evnt : events)
-    addEvent(evnt);
+  distributeEvents(box->getConstEvents());
 
   // Copy the cached numbers from the incoming box. This is quick - don't need
   // to refresh cache
@@ -164,6 +162,39 @@ void MDGridBox<MDE, nd>::fillBoxShell(const size_t tot, const coord_t ChildInver
   } // for each box
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add the events of the box being split to the new children, as addEvent
+ * would. The child of every event is found first, in parallel for a big box,
+ * so that each child reserves its memory once and then takes its events
+ * without locking.
+ * @param events :: the events of the box being split
+ */
+TMDE(void MDGridBox)::distributeEvents(const std::vector<MDE> &events) {
+  const auto numEvents = static_cast<int64_t>(events.size());
+  std::vector<size_t> childIndex(events.size());
+  PARALLEL_FOR_IF(events.size() >= this->m_BoxController->getAddingEvents_eventsPerTask())
+  for (int64_t i = 0; i < numEvents; ++i) {
+    // Events on the upper boundary of the last child go in the last child,
+    // and any beyond are dropped, as in addEvent
+    const size_t cindex = calculateChildIndex(events[i]);
+    childIndex[i] = cindex == numBoxes ? numBoxes - 1 : cindex;
+  }
+
+  std::vector<size_t> childEvents(numBoxes, 0);
+  for (const auto cindex : childIndex) {
+    if (cindex < numBoxes)
+      ++childEvents[cindex];
+  }
+  for (size_t i = 0; i < numBoxes; ++i) {
+    if (childEvents[i] > 0)
+      static_cast<MDBox<MDE, nd> *>(m_Children[i])->reserveMemoryForLoad(childEvents[i]);
+  }
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (childIndex[i] < numBoxes)
+      m_Children[childIndex[i]]->addEventUnsafe(events[i]);
+  }
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Copy constructor
  * @param other :: MDGridBox to copy
@@ -361,6 +392,9 @@ TMDE(void MDGridBox)::refreshCache(Kernel::ThreadScheduler *ts) {
       this->m_errorSquared += ibox->getErrorSquared();
       this->m_totalWeight += ibox->getTotalWeight();
     }
+#ifdef MDBOX_TRACK_CENTROID
+    calculateCentroidFromChildren();
+#endif
   } else {
     //---------- Parallel refresh --------------
     throw std::runtime_error("Not implemented");
@@ -391,6 +425,31 @@ TMDE(void MDGridBox)::calculateGridCaches() {
     this->m_errorSquared += ibox->getErrorSquared();
     this->m_totalWeight += ibox->getTotalWeight();
   }
+#ifdef MDBOX_TRACK_CENTROID
+  calculateCentroidFromChildren();
+#endif
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Set the cached centroid to the signal-weighted average of the centroids
+ * of the boxes within, which must have their caches up to date.
+ */
+TMDE(void MDGridBox)::calculateCentroidFromChildren() const {
+  std::fill_n(this->m_centroid, nd, 0.0f);
+  // Keep 0.0 if the signal is null. This avoids dividing by 0.0
+  if (this->m_signal == 0)
+    return;
+  for (const MDBoxBase<MDE, nd> *ibox : m_Children) {
+    const auto signal = static_cast<coord_t>(ibox->getSignal());
+    if (signal == 0)
+      continue;
+    const coord_t *centroid = ibox->getCentroid();
+    for (size_t d = 0; d < nd; ++d)
+      this->m_centroid[d] += centroid[d] * signal;
+  }
+  const coord_t reciprocal = 1.0f / static_cast<coord_t>(this->m_signal);
+  for (size_t d = 0; d < nd; ++d)
+    this->m_centroid[d] *= reciprocal;
 }
 //-----------------------------------------------------------------------------------------------
 /** Allocate and return a vector with a copy of all events contained
@@ -675,7 +734,8 @@ TMDE(void MDGridBox)::splitContents(size_t index, Kernel::ThreadScheduler *ts) {
 
   if (ts) {
     // Create a task to split the newly created MDGridBox.
-    ts->push(std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitAllIfNeeded, &*gridbox, ts)));
+    ts->push(std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitAllIfNeeded, &*gridbox, ts),
+                                                    static_cast<double>(gridbox->getNPoints())));
   } else {
     gridbox->splitAllIfNeeded(nullptr);
   }
@@ -726,8 +786,8 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
           // ------ Perform split in parallel (using ThreadPool) ------
           // So we create a task to split this MDBox,
           // Task is : this->splitContents(i, ts);
-          ts->push(
-              std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitContents, &*this, i, ts)));
+          ts->push(std::make_shared<Kernel::FunctionTask>(
+              std::bind(&MDGridBox<MDE, nd>::splitContents, &*this, i, ts), static_cast<double>(box->getNPoints())));
         }
       } else {
         // This box does NOT have enough events to be worth splitting, if it do
@@ -750,11 +810,12 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
           // Go serially if there are only a few points contained (less
           // overhead).
           gridBox->splitAllIfNeeded(ts);
-        else
+        else {
           // Go parallel if this is a big enough gridbox.
           // Task is : gridBox->splitAllIfNeeded(ts);
-          ts->push(
-              std::make_shared<Kernel::FunctionTask>(std::bind(&MDGridBox<MDE, nd>::splitAllIfNeeded, &*gridBox, ts)));
+          auto task = std::bind(&MDGridBox<MDE, nd>::splitAllIfNeeded, &*gridBox, ts);
+          ts->push(std::make_shared<Kernel::FunctionTask>(task, static_cast<double>(gridBox->getNPoints())));
+        }
       }
     }
   }
@@ -0,0 +1,135 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** @class Mantid::DataObjects::PackedEvents
+
+  Compressed, read-only storage for the events of a single EventList, which
+  packs them sorted by time-of-flight. The encoding is lossless and keeps the
+  events in the order given:
+
+    - Times-of-flight are stored as the difference from the previous event,
+      as a variable-length integer. The difference is taken between the bit
+      patterns of the values, as 32-bit floats when every value is exactly a
+      float (as for events loaded from NeXus) and as doubles otherwise, so
+      closely spaced events need one or two bytes each.
+    - Pulse times are stored as variable-length indices into a table of the
+      distinct pulse times. Shared between all the lists of a workspace, the
+      table costs little and most indices need two or three bytes.
+    - Weights and errors, if there are any, are stored as floats as in the
+      event structs.
+
+  For sorted, unweighted events that is typically 4-5 bytes per event rather
+  than 16. The events are decoded as they are visited by forEach(), which
+  is enough to histogram and integrate; anything else converts the list
+  back to rows.
+*/
+class MANTID_DATAOBJECTS_DLL PackedEvents {
+public:
+  /// Distinct pulse times in nanoseconds, in ascending order
+  using PulseTable = std::vector<int64_t>;
+
+  PackedEvents(const std::vector<Types::Event::TofEvent> &events,
+               std::shared_ptr<const PulseTable> pulseTable = nullptr);
+  PackedEvents(const std::vector<WeightedEvent> &events, std::shared_ptr<const PulseTable> pulseTable = nullptr);
+  explicit PackedEvents(const std::vector<WeightedEventNoTime> &events);
+
+  static std::shared_ptr<const PulseTable> makePulseTable(std::vector<int64_t> pulseTimes);
+
+  void copyInto(std::vector<Types::Event::TofEvent> &events) const;
+  void copyInto(std::vector<WeightedEvent> &events) const;
+  void copyInto(std::vector<WeightedEventNoTime> &events) const;
+
+  /// The type of event held
+  API::EventType getEventType() const { return m_eventType; }
+  /// Number of events held
+  size_t size() const { return m_size; }
+  /// True if there are no events
+  bool empty() const { return m_size == 0; }
+  size_t getMemorySize() const;
+  /// True if the events carry a weight and error
+  bool hasWeights() const { return m_eventType != API::EventType::TOF; }
+  /// The table the pulse times index, or nullptr for WEIGHTED_NOTIME
+  const std::shared_ptr<const PulseTable> &pulseTable() const { return m_pulseTable; }
+
+  /** Decode the events in order of time-of-flight, passing each to a visitor
+   * @param visitor :: called as visitor(tof, weight, errorSquared); return
+   * false to stop
+   */
+  template <typename Visitor> void forEach(Visitor &&visitor) const {
+    const uint8_t *tofs = m_tofs.data();
+    uint64_t key = 0;
+    for (size_t i = 0; i < m_size; ++i) {
+      key += unzigzag(readVarint(tofs));
+      const double weight = m_weight.empty() ? 1.0 : static_cast<double>(m_weight[i]);
+      const double errorSquared = m_errorSquared.empty() ? 1.0 : static_cast<double>(m_errorSquared[i]);
+      if (!visitor(tofFromKey(key), weight, errorSquared))
+        return;
+    }
+  }
+
+private:
+  void packTofs(const std::vector<double> &tofs);
+  void packPulseTimes(const std::vector<int64_t> &pulseTimes, std::shared_ptr<const PulseTable> pulseTable);
+  std::vector<double> unpackTofs() const;
+  std::vector<int64_t> unpackPulseTimes() const;
+
+  /// Read a variable-length integer and move past it
+  static uint64_t readVarint(const uint8_t *&data) {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      const uint8_t byte = *data++;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+        return value;
+    }
+  }
+
+  /// Undo the zigzag mapping of signed to unsigned integers
+  static uint64_t unzigzag(const uint64_t value) { return (value >> 1) ^ (~(value & 1) + 1); }
+
+  /// Recover a time-of-flight from its order-preserving key
+  double tofFromKey(const uint64_t key) const {
+    if (m_singlePrecision) {
+      const auto floatKey = static_cast<uint32_t>(key);
+      return static_cast<double>(std::bit_cast<float>(floatKey & 0x80000000u ? floatKey ^ 0x80000000u : ~floatKey));
+    }
+    return std::bit_cast<double>(key & 0x8000000000000000ull ? key ^ 0x8000000000000000ull : ~key);
+  }
+
+  /// What type of event is held
+  API::EventType m_eventType;
+  /// Number of events held
+  size_t m_size{0};
+  /// Whether the times-of-flight are encoded as floats
+  bool m_singlePrecision{true};
+  /// Differences between the times-of-flight
+  std::vector<uint8_t> m_tofs;
+  /// Index of the pulse time of each event in m_pulseTable
+  std::vector<uint8_t> m_pulseIndices;
+  /// Distinct pulse times, possibly shared with other lists
+  std::shared_ptr<const PulseTable> m_pulseTable;
+  /// Weight of each event
+  std::vector<float> m_weight;
+  /// Square of the error of each event
+  std::vector<float> m_errorSquared;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
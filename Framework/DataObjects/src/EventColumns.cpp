@@ -0,0 +1,310 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventColumns.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace Mantid::DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+using namespace Mantid::API;
+
+namespace {
+/// Reorder a column in place so that column[i] = column[order[i]]
+template <typename T> void applyPermutation(EventColumns::Column<T> &column, const std::vector<size_t> &order) {
+  if (column.empty())
+    return;
+  EventColumns::Column<T> sorted(column.get_allocator());
+  sorted.reserve(column.size());
+  std::transform(order.cbegin(), order.cend(), std::back_inserter(sorted), [&column](size_t i) { return column[i]; });
+  column.swap(sorted);
+}
+
+/// Release the memory held by a column
+template <typename T> void releaseColumn(EventColumns::Column<T> &column) {
+  EventColumns::Column<T>(column.get_allocator()).swap(column);
+}
+} // namespace
+
+/** Constructor
+ * @param eventType :: the type of event that will be held
+ * @param arena :: file-backed arena to allocate the columns in, or nullptr to
+ * use the heap
+ */
+EventColumns::EventColumns(const EventType eventType, std::shared_ptr<Kernel::MappedFileArena> arena)
+    : m_eventType(eventType), m_tof(EventColumnAllocator<double>(arena)),
+      m_pulseTime(EventColumnAllocator<int64_t>(arena)), m_weight(EventColumnAllocator<float>(arena)),
+      m_errorSquared(EventColumnAllocator<float>(std::move(arena))) {}
+
+/** Fill the columns from a vector of TofEvent. Replaces any existing events.
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<TofEvent> &events) {
+  this->clear();
+  m_eventType = TOF;
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+  }
+}
+
+/** Fill the columns from a vector of WeightedEvent. Replaces any existing
+ * events.
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEvent> &events) {
+  this->clear();
+  m_eventType = WEIGHTED;
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Fill the columns from a vector of WeightedEventNoTime. Replaces any
+ * existing events.
+ * @param events :: the events to copy
+ */
+void EventColumns::assign(const std::vector<WeightedEventNoTime> &events) {
+  this->clear();
+  m_eventType = WEIGHTED_NOTIME;
+  m_tof.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events) {
+    m_tof.emplace_back(event.tof());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+}
+
+/** Write the events back out as TofEvent's
+ * @param events :: vector to fill; any existing contents are replaced
+ * @throw std::runtime_error if the columns hold weighted events
+ */
+void EventColumns::copyInto(std::vector<TofEvent> &events) const {
+  if (m_eventType != TOF)
+    throw std::runtime_error("EventColumns::copyInto() cannot write weighted events to TofEvent's");
+  events.clear();
+  events.reserve(this->size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], DateAndTime(m_pulseTime[i]));
+}
+
+/** Write the events back out as WeightedEvent's
+ * @param events :: vector to fill; any existing contents are replaced
+ * @throw std::runtime_error if the columns have no pulse times
+ */
+void EventColumns::copyInto(std::vector<WeightedEvent> &events) const {
+  if (!this->hasPulseTimes())
+    throw std::runtime_error("EventColumns::copyInto() cannot write events without pulse times to WeightedEvent's");
+  events.clear();
+  events.reserve(this->size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], DateAndTime(m_pulseTime[i]), this->weight(i), this->errorSquared(i));
+}
+
+/** Write the events back out as WeightedEventNoTime's
+ * @param events :: vector to fill; any existing contents are replaced
+ */
+void EventColumns::copyInto(std::vector<WeightedEventNoTime> &events) const {
+  events.clear();
+  events.reserve(this->size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], this->weight(i), this->errorSquared(i));
+}
+
+/** Switch the columns to hold a different type of event. This follows the
+ * same rules as EventList::switchTo(): weights can be added and pulse times
+ * can be dropped, but neither can be recovered.
+ * @param newType :: EventType to switch to
+ */
+void EventColumns::switchTo(const EventType newType) {
+  if (newType == m_eventType)
+    return;
+
+  switch (newType) {
+  case TOF:
+    throw std::runtime_error("EventColumns::switchTo() called on columns with weights to go down to TofEvent's. "
+                             "This would remove weight information and therefore is not possible.");
+  case WEIGHTED:
+    if (m_eventType == WEIGHTED_NOTIME)
+      throw std::runtime_error("EventColumns::switchTo() called on columns without pulse times. "
+                               "They can't go back to WeightedEvent's.");
+    m_weight.assign(m_tof.size(), 1.0f);
+    m_errorSquared.assign(m_tof.size(), 1.0f);
+    break;
+  case WEIGHTED_NOTIME:
+    if (m_eventType == TOF) {
+      m_weight.assign(m_tof.size(), 1.0f);
+      m_errorSquared.assign(m_tof.size(), 1.0f);
+    }
+    releaseColumn(m_pulseTime);
+    break;
+  }
+  m_eventType = newType;
+}
+
+/// Remove all events and release their memory
+void EventColumns::clear() {
+  releaseColumn(m_tof);
+  releaseColumn(m_pulseTime);
+  releaseColumn(m_weight);
+  releaseColumn(m_errorSquared);
+}
+
+/** Memory used by the columns. As with EventList this reports the capacity
+ * of the vectors rather than their size.
+ * @return :: the memory used, in bytes.
+ */
+size_t EventColumns::getMemorySize() const {
+  return m_tof.capacity() * sizeof(double) + m_pulseTime.capacity() * sizeof(int64_t) +
+         m_weight.capacity() * sizeof(float) + m_errorSquared.capacity() * sizeof(float) + sizeof(EventColumns);
+}
+
+/** Sort all columns by time-of-flight. The sort is stable so events with equal
+ * time-of-flight keep their relative order.
+ */
+void EventColumns::sortTof() {
+  if (std::is_sorted(m_tof.cbegin(), m_tof.cend()))
+    return;
+
+  std::vector<size_t> order(m_tof.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) { return m_tof[lhs] < m_tof[rhs]; });
+
+  applyPermutation(m_tof, order);
+  applyPermutation(m_pulseTime, order);
+  applyPermutation(m_weight, order);
+  applyPermutation(m_errorSquared, order);
+}
+
+/// Reverse the order of the events in all columns
+void EventColumns::reverse() {
+  std::reverse(m_tof.begin(), m_tof.end());
+  std::reverse(m_pulseTime.begin(), m_pulseTime.end());
+  std::reverse(m_weight.begin(), m_weight.end());
+  std::reverse(m_errorSquared.begin(), m_errorSquared.end());
+}
+
+/** Convert the time-of-flight by tof' = tof * factor + offset. This does not
+ * reverse the events if the factor is negative.
+ * @param factor :: multiply by this
+ * @param offset :: add this
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  std::transform(m_tof.cbegin(), m_tof.cend(), m_tof.begin(),
+                 [factor, offset](const double tof) { return tof * factor + offset; });
+}
+
+/** Convert the time-of-flight with an arbitrary function
+ * @param func :: function applied to each time-of-flight
+ */
+void EventColumns::convertTof(const std::function<double(double)> &func) {
+  std::transform(m_tof.cbegin(), m_tof.cend(), m_tof.begin(), func);
+}
+
+/** Remove the events for which keep(i) returns false, compacting every
+ * populated column in a single pass.
+ * @param keep :: predicate on the event index
+ * @return the number of events removed
+ */
+template <typename Predicate> size_t EventColumns::removeIf(Predicate keep) {
+  const size_t numOrig = m_tof.size();
+  size_t out = 0;
+  for (size_t in = 0; in < numOrig; ++in) {
+    if (!keep(in))
+      continue;
+    if (out != in) {
+      m_tof[out] = m_tof[in];
+      if (!m_pulseTime.empty())
+        m_pulseTime[out] = m_pulseTime[in];
+      if (!m_weight.empty()) {
+        m_weight[out] = m_weight[in];
+        m_errorSquared[out] = m_errorSquared[in];
+      }
+    }
+    ++out;
+  }
+  m_tof.resize(out);
+  if (!m_pulseTime.empty())
+    m_pulseTime.resize(out);
+  if (!m_weight.empty()) {
+    m_weight.resize(out);
+    m_errorSquared.resize(out);
+  }
+  return numOrig - out;
+}
+
+/** Remove the events with tofMin <= tof <= tofMax. The columns must already be
+ * sorted by time-of-flight.
+ * @param tofMin :: lower bound of TOF to filter out
+ * @param tofMax :: upper bound of TOF to filter out
+ * @return the number of events removed
+ */
+size_t EventColumns::maskTof(const double tofMin, const double tofMax) {
+  if (m_tof.empty() || tofMin > m_tof.back() || tofMax < m_tof.front())
+    return 0;
+
+  const auto first = std::lower_bound(m_tof.cbegin(), m_tof.cend(), tofMin);
+  if (first == m_tof.cend() || *first >= tofMax)
+    return 0;
+  const auto last = std::upper_bound(first, m_tof.cend(), tofMax);
+
+  const auto begin = static_cast<size_t>(std::distance(m_tof.cbegin(), first));
+  const auto end = static_cast<size_t>(std::distance(m_tof.cbegin(), last));
+  return this->removeIf([begin, end](size_t i) { return i < begin || i >= end; });
+}
+
+/** Remove the events for which the mask is false
+ * @param mask :: one entry per event, true to keep the event
+ * @return the number of events removed
+ */
+size_t EventColumns::maskCondition(const std::vector<bool> &mask) {
+  if (mask.size() != m_tof.size())
+    throw std::invalid_argument("EventColumns::maskCondition: mask size must match the number of events");
+  return this->removeIf([&mask](size_t i) { return mask[i]; });
+}
+
+/** Multiply the weights by a scalar with an error, switching to weighted
+ * events if needed. See EventList::multiply() for the error propagation.
+ * @param value :: multiply all weights by this amount.
+ * @param error :: error on 'value'. Can be 0.
+ */
+void EventColumns::multiply(const double value, const double error) {
+  if (m_eventType == TOF)
+    this->switchTo(WEIGHTED);
+
+  const double valueSquared = value * value;
+  const double errorSquared = error * error;
+  for (size_t i = 0; i < m_weight.size(); ++i) {
+    const double weight = m_weight[i];
+    m_errorSquared[i] = static_cast<float>(m_errorSquared[i] * valueSquared + errorSquared * weight * weight);
+    m_weight[i] *= static_cast<float>(value);
+  }
+}
+
+/** Equality operator
+ * @param rhs :: other EventColumns to compare
+ * @return :: true if the event type and all columns are equal.
+ */
+bool EventColumns::operator==(const EventColumns &rhs) const {
+  return m_eventType == rhs.m_eventType && m_tof == rhs.m_tof && m_pulseTime == rhs.m_pulseTime &&
+         m_weight == rhs.m_weight && m_errorSquared == rhs.m_errorSquared;
+}
+
+} // namespace Mantid::DataObjects
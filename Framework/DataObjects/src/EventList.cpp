@@ -6,11 +6,16 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventColumns.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
+#include "MantidDataObjects/PackedEvents.h"
+#include "MantidKernel/BinEdgeSearch.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MappedFileArena.h"
 #include "MantidKernel/TimeROI.h"
 #include "MantidKernel/Unit.h"
 
@@ -26,9 +31,12 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <filesystem>
 #include <functional>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
 
 using std::ostream;
 using std::runtime_error;
@@ -44,6 +52,33 @@ namespace {
 
 constexpr double SEC_TO_NANO{1.e9};
 
+/// Copy the events held in columns or packed storage into a vector and append them to a list
+template <typename T, typename Storage> void appendFromStorage(EventList &list, const Storage &storage) {
+  std::vector<T> events;
+  storage.copyInto(events);
+  list += events;
+}
+
+/** The arena shared by all file-backed event lists. It is created when first
+ * needed, in the directory given by the "EventWorkspace.ScratchDirectory"
+ * configuration key or the system temporary directory, and released when the
+ * last file-backed list has gone.
+ */
+std::shared_ptr<Kernel::MappedFileArena> scratchArena() {
+  static std::mutex mutex;
+  static std::weak_ptr<Kernel::MappedFileArena> current;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto arena = current.lock();
+  if (!arena) {
+    auto directory = Kernel::ConfigService::Instance().getString("EventWorkspace.ScratchDirectory");
+    if (directory.empty())
+      directory = std::filesystem::temp_directory_path().string();
+    arena = std::make_shared<Kernel::MappedFileArena>(directory);
+    current = arena;
+  }
+  return arena;
+}
+
 // minimum event vector length to use tbb::parallel_sort
 // this is 4x what parallel_sort uses in the indidividual blocks
 constexpr size_t MIN_VEC_LENGTH_PARALLEL_SORT{2000};
@@ -250,6 +285,8 @@ EventList::~EventList() {
   this->events.reset();
   this->weightedEvents.reset();
   this->weightedEventsNoTime.reset();
+  this->m_columns.reset();
+  this->m_packed.reset();
 }
 
 /// Copy data from another EventList, via ISpectrum reference.
@@ -257,6 +294,7 @@ void EventList::copyDataFrom(const ISpectrum &source) { source.copyDataInto(*thi
 
 /// Used by copyDataFrom for dynamic dispatch for its `source`.
 void EventList::copyDataInto(EventList &sink) const {
+  sink.invalidateHistogram();
   sink.m_histogram = m_histogram;
   if (events)
     sink.events = std::make_unique<std::vector<Types::Event::TofEvent>>(events->cbegin(), events->cend());
@@ -272,6 +310,14 @@ void EventList::copyDataInto(EventList &sink) const {
                                                                                    weightedEventsNoTime->cend());
   else if (sink.weightedEventsNoTime)
     sink.weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+  if (m_columns)
+    sink.m_columns = std::make_unique<EventColumns>(*m_columns);
+  else
+    sink.m_columns.reset();
+  if (m_packed)
+    sink.m_packed = std::make_unique<PackedEvents>(*m_packed);
+  else
+    sink.m_packed.reset();
 
   sink.eventType = eventType;
   sink.order = order;
@@ -294,6 +340,7 @@ void EventList::copyDataInto(Histogram1D &sink) const { sink.setHistogram(histog
  */
 void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros, bool GenerateMultipleEvents,
                                     int MaxEventsPerBin) {
+  this->invalidateHistogram();
   // Fresh start
   this->clear(true);
 
@@ -307,6 +354,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
   // Copy detector IDs and spectra
   this->copyInfoFrom(*inSpec);
   // We need weights but have no way to set the time. So use weighted, no time
+  this->useRowStorage();
   this->switchTo(WEIGHTED_NOTIME);
   if (GenerateZeros)
     this->weightedEventsNoTime->reserve(Y.size());
@@ -387,6 +435,8 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
+  this->invalidateHistogram();
+  this->useRowStorage();
 
   switch (this->eventType) {
   case TOF:
@@ -415,6 +465,8 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more_events) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -449,6 +501,8 @@ EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   this->switchTo(WEIGHTED);
   this->weightedEvents->emplace_back(event);
   this->order = UNSORTED;
@@ -464,6 +518,8 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -496,6 +552,8 @@ EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events)
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -523,19 +581,39 @@ EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_ev
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   if (!more_events.empty()) {
-    // We'll let the += operator for the given vector of event lists handle it
+    // We'll let the += operator for the given vector of event lists handle it.
+    // Events in columns or packed are copied out, leaving the other list where it is.
+    const auto &columns = more_events.m_columns;
+    const auto &packed = more_events.m_packed;
     switch (more_events.getEventType()) {
     case TOF:
-      this->operator+=(*more_events.events);
+      if (columns)
+        appendFromStorage<TofEvent>(*this, *columns);
+      else if (packed)
+        appendFromStorage<TofEvent>(*this, *packed);
+      else
+        this->operator+=(*more_events.events);
       break;
 
     case WEIGHTED:
-      this->operator+=(*more_events.weightedEvents);
+      if (columns)
+        appendFromStorage<WeightedEvent>(*this, *columns);
+      else if (packed)
+        appendFromStorage<WeightedEvent>(*this, *packed);
+      else
+        this->operator+=(*more_events.weightedEvents);
       break;
 
     case WEIGHTED_NOTIME:
-      this->operator+=(*more_events.weightedEventsNoTime);
+      if (columns)
+        appendFromStorage<WeightedEventNoTime>(*this, *columns);
+      else if (packed)
+        appendFromStorage<WeightedEventNoTime>(*this, *packed);
+      else
+        this->operator+=(*more_events.weightedEventsNoTime);
       break;
     }
 
@@ -584,6 +662,9 @@ template <class T1, class T2> void EventList::minusHelper(std::vector<T1> &event
  * @return reference to this
  * */
 EventList &EventList::operator-=(const EventList &more_events) {
+  this->invalidateHistogram();
+  this->useRowStorage();
+  more_events.useRowStorage();
   if (this == &more_events) {
     // Special case, ticket #3844 part 2.
     // When doing this = this - this,
@@ -663,6 +744,10 @@ bool EventList::operator==(const EventList &rhs) const {
     return false;
   if (this->empty())
     return true;
+  if (m_columns && rhs.m_columns)
+    return (*m_columns == *rhs.m_columns);
+  this->useRowStorage();
+  rhs.useRowStorage();
   // Check all event lists; The empty ones will compare equal
   if (!vectorPtrEquals(events, rhs.events))
     return false;
@@ -690,6 +775,8 @@ bool EventList::equals(const EventList &rhs, const double tolTof, const double t
     return false;
   if (this->empty())
     return true;
+  this->useRowStorage();
+  rhs.useRowStorage();
 
   // loop over the events
   switch (this->eventType) {
@@ -748,6 +835,13 @@ EventType EventList::getEventType() const { return eventType; }
  * WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
+  // Packed events cannot change type in place
+  if (m_packed)
+    this->useRowStorage();
+  // The column storage applies the same rules and throws for the same cases
+  if (m_columns)
+    m_columns->switchTo(newType);
+
   switch (newType) {
   case TOF:
     if (eventType != TOF)
@@ -846,6 +940,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  this->useRowStorage();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events->at(event_number));
@@ -872,6 +967,7 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  this->useRowStorage();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList that has weights. Use getWeightedEvents() "
                              "or getWeightedEventsNoTime().");
@@ -885,9 +981,14 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * NOTE! This should be used for testing purposes only, as much as possible. The EventList
  * may contain weighted events, requiring use of getWeightedEvents() instead.
  *
+ * Histograms cached after this call do not see changes made later through the
+ * returned reference; call EventWorkspace::clearMRU() once they are done.
+ *
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  this->invalidateHistogram();
+  this->useRowStorage();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList that has weights. Use getWeightedEvents() "
                              "or getWeightedEventsNoTime().");
@@ -902,9 +1003,14 @@ std::vector<TofEvent> &EventList::getEvents() {
  *EventList
  * may contain un-weighted events, requiring use of getEvents() instead.
  *
+ * Histograms cached after this call do not see changes made later through the
+ * returned reference; call EventWorkspace::clearMRU() once they are done.
+ *
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  this->invalidateHistogram();
+  this->useRowStorage();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
@@ -922,6 +1028,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  this->useRowStorage();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
@@ -934,9 +1041,14 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
 /** Return the list of WeightedEvent contained.
  * NOTE! This should be used for testing purposes only, as much as possible.
  *
+ * Histograms cached after this call do not see changes made later through the
+ * returned reference; call EventWorkspace::clearMRU() once they are done.
+ *
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  this->invalidateHistogram();
+  this->useRowStorage();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an EventList not of type "
                              "WeightedEventNoTime. Use getEvents() or getWeightedEvents().");
@@ -952,6 +1064,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() const {
+  this->useRowStorage();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an EventList not of type "
                              "WeightedEventNoTime. Use getEvents() or getWeightedEvents().");
@@ -965,6 +1078,7 @@ const std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() con
  * associated detector ID's.
  * */
 void EventList::clear(const bool removeDetIDs) {
+  this->invalidateHistogram();
   if (mru) {
     try {
       mru->deleteIndex(this);
@@ -974,6 +1088,11 @@ void EventList::clear(const bool removeDetIDs) {
   }
   // clear representations that aren't for the current type
   this->clearUnused();
+  // column storage stays selected, but without any events
+  if (m_columns)
+    m_columns->clear();
+  // packed storage cannot hold new events, so goes back to rows
+  m_packed.reset();
 
   // release unused memory or allocate new vector
   // rather than creating a new object, reset existing pointer
@@ -1028,6 +1147,7 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  * @param num :: number of events that will be in this EventList
  */
 void EventList::reserve(size_t num) {
+  this->useRowStorage();
   switch (this->eventType) {
   case TOF:
     this->events->reserve(num);
@@ -1041,6 +1161,24 @@ void EventList::reserve(size_t num) {
   }
 }
 
+/** Number of events the event list can hold before its vector has to be
+ * reallocated.
+ *
+ * @return the capacity of the vector of the current eventType
+ */
+size_t EventList::capacity() const {
+  this->useRowStorage();
+  switch (this->eventType) {
+  case TOF:
+    return this->events->capacity();
+  case WEIGHTED:
+    return this->weightedEvents->capacity();
+  case WEIGHTED_NOTIME:
+    return this->weightedEventsNoTime->capacity();
+  }
+  throw std::runtime_error("EventList: invalid event type value was found.");
+}
+
 // ==============================================================================================
 // --- Sorting functions -----------------------------------------------------
 // ==============================================================================================
@@ -1113,6 +1251,17 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT) // cppcheck-suppress identicalConditionAfterEarlyExit
     return;
 
+  if (m_columns) {
+    m_columns->sortTof();
+    this->order = TOF_SORT;
+    return;
+  }
+  // packed events are always sorted
+  if (m_packed) {
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     switchable_sort(events->begin(), events->end());
@@ -1138,6 +1287,9 @@ void EventList::sortTof() const {
  * resort using forceResort = true. False by default.
  */
 void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift, bool forceResort) const {
+  // Pulse time sorting is only done in row storage
+  this->useRowStorage();
+
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1170,6 +1322,9 @@ void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  // Pulse time sorting is only done in row storage
+  this->useRowStorage();
+
   if (this->order == PULSETIME_SORT || this->order == PULSETIMETOF_SORT)
     return; // nothing to do
 
@@ -1200,6 +1355,9 @@ void EventList::sortPulseTime() const {
  * (the absolute time)
  */
 void EventList::sortPulseTimeTOF() const {
+  // Pulse time sorting is only done in row storage
+  this->useRowStorage();
+
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered
 
@@ -1233,6 +1391,9 @@ void EventList::sortPulseTimeTOF() const {
  * @param seconds The tolerance of pulse time in seconds.
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, const double seconds) const {
+  // Pulse time sorting is only done in row storage
+  this->useRowStorage();
+
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1261,6 +1422,136 @@ bool EventList::isSortedByTof() const { return (this->order == TOF_SORT); }
 /** Return the type of sorting used in this event list */
 EventSortType EventList::getSortType() const { return this->order; }
 
+// --------------------------------------------------------------------------
+/** Select how the events are laid out in memory. Column storage keeps each
+ * event property in its own vector so that operations which only need the
+ * time-of-flight (histogramming, integrating, unit conversion and masking)
+ * touch less memory. Any operation that needs whole events, such as access
+ * to the event vectors or anything involving pulse times, moves the list back
+ * into row storage first.
+ *
+ * File-backed storage is column storage held in memory-mapped scratch files
+ * rather than on the heap, so that workspaces larger than RAM can be reduced
+ * by the column operations above with the operating system paging the events
+ * to and from disk. Leaving column storage for rows brings the events back
+ * onto the heap.
+ *
+ * Packed storage sorts the events by time-of-flight and compresses them, see
+ * PackedEvents, for lists that are kept to be histogrammed or integrated
+ * again and again. Anything else unpacks them.
+ *
+ * @param storage :: the storage to use
+ * @param pulseTable :: for packed storage, a table of pulse times to share
+ * with other lists, which must hold those of the events; by default the list
+ * makes its own
+ */
+void EventList::setStorageType(const EventStorageType storage,
+                               std::shared_ptr<const std::vector<int64_t>> pulseTable) {
+  if (storage == this->getStorageType())
+    return;
+
+  if (storage == ROW_STORAGE) {
+    this->useRowStorage();
+    return;
+  }
+
+  if (storage == PACKED_STORAGE) {
+    this->useRowStorage();
+    this->sortTof();
+    switch (eventType) {
+    case TOF:
+      m_packed = std::make_unique<PackedEvents>(std::as_const(*this).getEvents(), std::move(pulseTable));
+      std::vector<TofEvent>().swap(*this->events);
+      break;
+    case WEIGHTED:
+      m_packed = std::make_unique<PackedEvents>(std::as_const(*this).getWeightedEvents(), std::move(pulseTable));
+      std::vector<WeightedEvent>().swap(*this->weightedEvents);
+      break;
+    case WEIGHTED_NOTIME:
+      m_packed = std::make_unique<PackedEvents>(std::as_const(*this).getWeightedEventsNoTime());
+      std::vector<WeightedEventNoTime>().swap(*this->weightedEventsNoTime);
+      break;
+    }
+    return;
+  }
+
+  // Columns cannot move between the heap and the disk, so go through rows
+  this->useRowStorage();
+  auto columns = std::make_unique<EventColumns>(eventType, storage == FILE_BACKED_STORAGE ? scratchArena() : nullptr);
+  switch (eventType) {
+  case TOF:
+    if (this->events) {
+      columns->assign(*this->events);
+      std::vector<TofEvent>().swap(*this->events);
+    }
+    break;
+  case WEIGHTED:
+    if (this->weightedEvents) {
+      columns->assign(*this->weightedEvents);
+      std::vector<WeightedEvent>().swap(*this->weightedEvents);
+    }
+    break;
+  case WEIGHTED_NOTIME:
+    if (this->weightedEventsNoTime) {
+      columns->assign(*this->weightedEventsNoTime);
+      std::vector<WeightedEventNoTime>().swap(*this->weightedEventsNoTime);
+    }
+    break;
+  }
+  m_columns = std::move(columns);
+}
+
+// --------------------------------------------------------------------------
+/** Return how the events are laid out in memory */
+EventStorageType EventList::getStorageType() const {
+  if (m_packed)
+    return PACKED_STORAGE;
+  if (!m_columns)
+    return ROW_STORAGE;
+  return m_columns->arena() ? FILE_BACKED_STORAGE : COLUMN_STORAGE;
+}
+
+// --------------------------------------------------------------------------
+/** Move the events from column or packed storage back into the event vector
+ * of the current type. Does nothing if the list is already in row storage.
+ */
+void EventList::useRowStorage() const {
+  if (!m_columns && !m_packed)
+    return;
+
+  // Avoid converting from multiple threads
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  // If the list was converted while waiting for the lock, return.
+  if (!m_columns && !m_packed) // cppcheck-suppress identicalConditionAfterEarlyExit
+    return;
+
+  const auto copyInto = [this](auto &events) {
+    if (m_columns)
+      m_columns->copyInto(events);
+    else
+      m_packed->copyInto(events);
+  };
+  switch (eventType) {
+  case TOF:
+    if (!this->events)
+      this->events = std::make_unique<std::vector<TofEvent>>();
+    copyInto(*this->events);
+    break;
+  case WEIGHTED:
+    if (!this->weightedEvents)
+      this->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
+    copyInto(*this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    if (!this->weightedEventsNoTime)
+      this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+    copyInto(*this->weightedEventsNoTime);
+    break;
+  }
+  m_columns.reset();
+  m_packed.reset();
+}
+
 // --------------------------------------------------------------------------
 /** Reverse the histogram boundaries and the associated events if they are
  * sorted
@@ -1272,8 +1563,14 @@ void EventList::reverse() {
   MantidVec &x = dataX();
   std::reverse(x.begin(), x.end());
 
+  // packed events can only be decoded in ascending order
+  if (m_packed)
+    this->useRowStorage();
+
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  if (this->isSortedByTof() && m_columns) {
+    m_columns->reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events->begin(), this->events->end());
@@ -1299,6 +1596,11 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_columns)
+    return m_columns->size();
+  if (m_packed)
+    return m_packed->size();
+
   switch (eventType) {
   case TOF:
     return (this->events) ? this->events->size() : 0;
@@ -1314,6 +1616,11 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_columns)
+    return m_columns->empty();
+  if (m_packed)
+    return m_packed->empty();
+
   switch (eventType) {
   case TOF:
     if (this->events)
@@ -1342,6 +1649,11 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (m_columns)
+    return m_columns->getMemorySize() + sizeof(EventList);
+  if (m_packed)
+    return m_packed->getMemorySize() + sizeof(EventList);
+
   switch (eventType) {
   case TOF:
     return this->events->capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1474,60 +1786,51 @@ const HistogramData::HistogramE &EventList::e() const {
   return *sharedE();
 }
 Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
-  // This is the thread number from which this function was called.
-  const int thread = PARALLEL_THREAD_NUMBER;
-
   Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
 
-  // Is the data in the mrulist?
-  if (mru) {
-    mru->ensureEnoughBuffersY(static_cast<size_t>(thread));
-    yData = mru->findY(static_cast<size_t>(thread), this);
-  }
+  // Is there an up-to-date histogram in the cache?
+  if (mru)
+    yData = mru->findY(this, m_histogram.ptrX(), m_dataVersion);
 
   if (!yData) {
-    MantidVec Y;
-    MantidVec E;
-    this->generateHistogram(readX(), Y, E);
-
-    // Create the MRU object
-    yData = Kernel::make_cow<HistogramData::HistogramY>(std::move(Y));
-
-    // Lets save it in the MRU
-    if (mru) {
-      mru->insertY(thread, yData, this);
-      auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-      mru->ensureEnoughBuffersE(thread);
-      mru->insertE(thread, eData, this);
-    }
+    Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
+    this->generateAndCacheHistogram(yData, eData);
   }
   return yData;
 }
 Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
-  // This is the thread number from which this function was called.
-  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
-
   Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
 
-  // Is the data in the mrulist?
-  if (mru) {
-    mru->ensureEnoughBuffersE(thread);
-    eData = mru->findE(thread, this);
-  }
+  // Is there an up-to-date histogram in the cache?
+  if (mru)
+    eData = mru->findE(this, m_histogram.ptrX(), m_dataVersion);
 
   if (!eData) {
-    // Now use that to get E -- Y values are generated from another function
-    MantidVec Y_ignored;
-    MantidVec E;
-    this->generateHistogram(readX(), Y_ignored, E);
-    eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-
-    // Lets save it in the MRU
-    if (mru)
-      mru->insertE(thread, eData, this);
+    Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
+    this->generateAndCacheHistogram(yData, eData);
   }
   return eData;
 }
+
+/** Generate the Y and E histograms for the current X and, if this list belongs
+ * to a workspace, store them in its histogram cache. Y and E are always
+ * generated together so that a later request for the other is a cache hit.
+ *
+ * @param yData :: set to the generated Y
+ * @param eData :: set to the generated E
+ */
+void EventList::generateAndCacheHistogram(Kernel::cow_ptr<HistogramData::HistogramY> &yData,
+                                          Kernel::cow_ptr<HistogramData::HistogramE> &eData) const {
+  const auto xData = m_histogram.ptrX();
+  MantidVec Y;
+  MantidVec E;
+  this->generateHistogram(xData->rawData(), Y, E);
+
+  yData = Kernel::make_cow<HistogramData::HistogramY>(std::move(Y));
+  eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
+  if (mru)
+    mru->insert(this, xData, m_dataVersion, yData, eData);
+}
 /** Look in the MRU to see if the Y histogram has been generated before.
  * If so, return that. If not, calculate, cache and return it.
  *
@@ -1828,6 +2131,9 @@ inline void EventList::compressFatEventsHelper(const std::vector<T> &events, std
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  this->useRowStorage();
+  destination->useRowStorage();
+  destination->invalidateHistogram();
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
@@ -1925,6 +2231,9 @@ inline void EventList::processWeightedEvents(const std::vector<T> &events, std::
 
 void EventList::compressEvents(double tolerance, EventList *destination,
                                const std::shared_ptr<std::vector<double>> histogram_bin_edges) {
+  this->useRowStorage();
+  destination->useRowStorage();
+  destination->invalidateHistogram();
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
@@ -1987,6 +2296,9 @@ void EventList::compressEvents(double tolerance, EventList *destination,
 
 void EventList::compressFatEvents(const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
                                   const double seconds, EventList *destination) {
+  this->useRowStorage();
+  destination->useRowStorage();
+  destination->invalidateHistogram();
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED)
@@ -2201,19 +2513,17 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const Ma
 /** Generates both the Y and E (error) histograms
  * for an EventList with WeightedEvents.
  *
- * This histograms without sorting the events first by using the bin step size to estimate the bin number. This only
- * works for logarithmic or linear binning.
+ * This histograms without sorting the events first, finding the bin of each event with Kernel::BinEdgeSearch.
  *
  * @param events: vector of events (with weights)
- * @param step: bin step size
  * @param X: X-bins supplied
  * @param Y: counts returned
  * @param E: errors returned
  * @throw runtime_error if the EventList does not have weighted events
  */
 template <class T>
-void EventList::histogramForWeightsHelper(const std::vector<T> &events, const double step, const MantidVec &X,
-                                          MantidVec &Y, MantidVec &E) {
+void EventList::histogramForWeightsUnsortedHelper(const std::vector<T> &events, const MantidVec &X, MantidVec &Y,
+                                                  MantidVec &E) {
   size_t x_size = X.size();
 
   if (x_size <= 1) {
@@ -2235,17 +2545,10 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
   if (events.empty())
     return;
 
-  const auto xmin = X.front();
-  const auto xmax = X.back();
-
-  auto findBin = FindBin(step, xmin);
+  const Kernel::BinEdgeSearch findBin(X);
 
   for (const T &ev : events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
-
-    std::optional<size_t> n_bin = findBin(X, tof, true);
+    const std::optional<size_t> n_bin = findBin.find(ev.tof());
 
     if (n_bin) {
       Y[n_bin.value()] += ev.weight();
@@ -2257,6 +2560,147 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
   std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
 }
 
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms for an EventList in column
+ * storage. Only the time-of-flight column, and the weight columns if there are
+ * weights, are read.
+ *
+ * @param columns: the events, sorted by TOF
+ * @param X: X-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ */
+void EventList::histogramForColumnsHelper(const EventColumns &columns, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                          bool skipError) {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  const size_t n_bins = x_size - 1;
+  Y.assign(n_bins, 0.0);
+  const bool weighted = columns.hasWeights();
+  if (weighted || !skipError)
+    E.assign(n_bins, 0.0);
+
+  const auto &tofs = columns.tofs();
+  // Iterate through all events (sorted by tof) starting from the first in range
+  auto first = std::lower_bound(tofs.cbegin(), tofs.cend(), X.front());
+  size_t bin = 0;
+  for (auto i = static_cast<size_t>(std::distance(tofs.cbegin(), first)); i < tofs.size(); ++i) {
+    const double tof = tofs[i];
+    // Since both events and X are sorted the bin can only move forward
+    while (bin < n_bins && tof >= X[bin + 1])
+      ++bin;
+    if (bin == n_bins)
+      break;
+    if (weighted) {
+      // convert to double before adding, to preserve precision
+      Y[bin] += double(columns.weights()[i]);
+      E[bin] += double(columns.errorSquareds()[i]); // square of error
+    } else {
+      ++Y[bin];
+    }
+  }
+
+  if (weighted)
+    std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+  else if (!skipError)
+    std::transform(Y.cbegin(), Y.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
+
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms for an EventList in column
+ * storage without sorting the events, finding the bin of each event with
+ * Kernel::BinEdgeSearch.
+ *
+ * @param columns: the events
+ * @param X: X-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ */
+void EventList::histogramForColumnsUnsortedHelper(const EventColumns &columns, const MantidVec &X, MantidVec &Y,
+                                                  MantidVec &E, bool skipError) {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  Y.assign(x_size - 1, 0.0);
+  const bool weighted = columns.hasWeights();
+  if (weighted || !skipError)
+    E.assign(x_size - 1, 0.0);
+
+  const Kernel::BinEdgeSearch findBin(X);
+
+  const auto &tofs = columns.tofs();
+  for (size_t i = 0; i < tofs.size(); ++i) {
+    const std::optional<size_t> n_bin = findBin.find(tofs[i]);
+    if (!n_bin)
+      continue;
+    if (weighted) {
+      Y[n_bin.value()] += double(columns.weights()[i]);
+      E[n_bin.value()] += double(columns.errorSquareds()[i]);
+    } else {
+      ++Y[n_bin.value()];
+    }
+  }
+
+  if (weighted)
+    std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+  else if (!skipError)
+    std::transform(Y.cbegin(), Y.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
+
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms for an EventList in packed
+ * storage, decoding the events as it goes.
+ *
+ * @param packed: the events, which are sorted by TOF
+ * @param X: X-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error for unweighted events
+ */
+void EventList::histogramForPackedHelper(const PackedEvents &packed, const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                         bool skipError) {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  const size_t n_bins = x_size - 1;
+  Y.assign(n_bins, 0.0);
+  const bool weighted = packed.hasWeights();
+  if (weighted || !skipError)
+    E.assign(n_bins, 0.0);
+
+  size_t bin = 0;
+  packed.forEach([&](const double tof, const double weight, const double errorSquared) {
+    if (tof < X.front())
+      return true;
+    // Since both events and X are sorted the bin can only move forward
+    while (bin < n_bins && tof >= X[bin + 1])
+      ++bin;
+    if (bin == n_bins)
+      return false;
+    Y[bin] += weight;
+    if (weighted)
+      E[bin] += errorSquared; // square of error
+    return true;
+  });
+
+  if (weighted)
+    std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+  else if (!skipError)
+    std::transform(Y.cbegin(), Y.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
+
 // --------------------------------------------------------------------------
 /** Generates both the Y and E (error) histograms w.r.t Pulse Time
  * for an EventList with or without WeightedEvents.
@@ -2268,6 +2712,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events, const do
  *        events; you can just ignore the returned E vector.
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError) const {
+  this->useRowStorage();
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2301,6 +2746,7 @@ void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y, Man
  */
 void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y, MantidVec &E, const double &tofFactor,
                                               const double &tofOffset, bool skipError) const {
+  this->useRowStorage();
   // All types of weights need to be sorted by time at sample
   this->sortTimeAtSample(tofFactor, tofOffset);
 
@@ -2336,6 +2782,15 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E
 
   this->sortTof();
 
+  if (m_columns) {
+    histogramForColumnsHelper(*m_columns, X, Y, E, skipError);
+    return;
+  }
+  if (m_packed) {
+    histogramForPackedHelper(*m_packed, X, Y, E, skipError);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     // Make the single ones
@@ -2358,11 +2813,11 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E
 /** Generates both the Y and E (error) histograms w.r.t TOF for an EventList with or without WeightedEvents.
  *  This will zero out the Y array as part of the process.
  *
- * This calculates histogram without sorting the events by using the step size to estimate the bin number. This has been
- * made to only work for logarithmic or linear binning. This falls back to using the sorted histogram method if the
- * events are already sorted, as that will be faster.
+ * This calculates histogram without sorting the events. Linear and logarithmic bins are found with a closed-form
+ * index and other bins with a branchless search, see Kernel::BinEdgeSearch. This falls back to using the sorted
+ * histogram method if the events are already sorted, as that will be faster.
  *
- * @param step: bin step size
+ * @param step: bin step size. The binning is deduced from X, so this is no longer needed.
  * @param X: x-bins supplied
  * @param Y: counts returned
  * @param E: errors returned
@@ -2371,23 +2826,29 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E
  */
 void EventList::generateHistogram(const double step, const MantidVec &X, MantidVec &Y, MantidVec &E,
                                   bool skipError) const {
+  UNUSED_ARG(step);
   // if events are already sorted, use faster sorted histogram method
-  if (isSortedByTof() || empty())
+  if (isSortedByTof() || m_packed || empty())
     return generateHistogram(X, Y, E, skipError);
 
+  if (m_columns) {
+    histogramForColumnsUnsortedHelper(*m_columns, X, Y, E, skipError);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
-    this->generateCountsHistogram(step, X, Y);
+    this->generateCountsHistogramUnsorted(X, Y);
     if (!skipError)
       this->generateErrorsHistogram(Y, E);
     break;
 
   case WEIGHTED:
-    histogramForWeightsHelper(*this->weightedEvents, step, X, Y, E);
+    histogramForWeightsUnsortedHelper(*this->weightedEvents, X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
-    histogramForWeightsHelper(*this->weightedEventsNoTime, step, X, Y, E);
+    histogramForWeightsUnsortedHelper(*this->weightedEventsNoTime, X, Y, E);
     break;
   }
 }
@@ -2475,6 +2936,7 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &
  */
 void EventList::generateCountsHistogramPulseTime(const double &xMin, const double &xMax, MantidVec &Y,
                                                  const double TOF_min, const double TOF_max) const {
+  this->useRowStorage();
 
   if (this->events->empty())
     return;
@@ -2685,14 +3147,12 @@ size_t EventList::findExactBin(const MantidVec &X, const double tof, const size_
 /** Fill a histogram given specified histogram bounds. Does not modify
  * the eventlist (const method).
  *
- * This histogram without sorting the events by using the step size to estimate the bin number. This only works for
- * logarithmic or linear binning.
+ * This histograms without sorting the events, finding the bin of each event with Kernel::BinEdgeSearch.
  *
- * @param step :: bin step size
  * @param X :: The x bins
  * @param Y :: The generated counts histogram
  */
-void EventList::generateCountsHistogram(const double step, const MantidVec &X, MantidVec &Y) const {
+void EventList::generateCountsHistogramUnsorted(const MantidVec &X, MantidVec &Y) const {
   // For slight speed=up.
   size_t x_size = X.size();
 
@@ -2713,17 +3173,10 @@ void EventList::generateCountsHistogram(const double step, const MantidVec &X, M
   if (this->events->empty())
     return;
 
-  const auto xmin = X.front();
-  const auto xmax = X.back();
-
-  auto findBin = FindBin(step, xmin);
+  const Kernel::BinEdgeSearch findBin(X);
 
   for (const TofEvent &ev : *this->events) {
-    const double tof = ev.tof();
-    if (tof < xmin || tof >= xmax)
-      continue;
-
-    const std::optional<size_t> n_bin = findBin(X, tof, true);
+    const std::optional<size_t> n_bin = findBin.find(ev.tof());
 
     if (n_bin)
       Y[n_bin.value()]++;
@@ -2793,6 +3246,84 @@ void EventList::integrateHelper(std::vector<T> &events, const double minX, const
   error = std::sqrt(error);
 }
 
+// --------------------------------------------------------------------------
+/** Integrate the events in column storage between a range of X values, or
+ * all events.
+ *
+ * @param columns :: the events, sorted by TOF unless entireRange is set
+ * @param minX :: minimum X bin to use in integrating.
+ * @param maxX :: maximum X bin to use in integrating.
+ * @param entireRange :: set to true to use the entire range. minX and maxX are
+ *then ignored!
+ * @param sum :: reference to a double to put the sum in.
+ * @param error :: reference to a double to put the error in.
+ */
+void EventList::integrateColumnsHelper(const EventColumns &columns, const double minX, const double maxX,
+                                       const bool entireRange, double &sum, double &error) {
+  sum = 0;
+  error = 0;
+  const auto &tofs = columns.tofs();
+  if (tofs.empty())
+    return;
+
+  size_t low = 0;
+  size_t high = tofs.size();
+  if (!entireRange) {
+    // If a silly range was given, return 0.
+    if (maxX < minX)
+      return;
+    low = static_cast<size_t>(std::distance(tofs.cbegin(), std::lower_bound(tofs.cbegin(), tofs.cend(), minX)));
+    high = static_cast<size_t>(std::distance(tofs.cbegin(), std::upper_bound(tofs.cbegin(), tofs.cend(), maxX)));
+    if (high <= low)
+      return;
+  }
+
+  if (columns.hasWeights()) {
+    for (size_t i = low; i < high; ++i) {
+      sum += columns.weights()[i];
+      error += columns.errorSquareds()[i];
+    }
+  } else {
+    sum = static_cast<double>(high - low);
+    error = sum;
+  }
+  error = std::sqrt(error);
+}
+
+// --------------------------------------------------------------------------
+/** Integrate the events of an EventList in packed storage between a range of
+ * X values, or all events, decoding them as it goes.
+ *
+ * @param packed :: the events, which are sorted by TOF
+ * @param minX :: minimum X bin to use in integrating.
+ * @param maxX :: maximum X bin to use in integrating.
+ * @param entireRange :: set to true to use the entire range. minX and maxX are
+ *then ignored!
+ * @param sum :: reference to a double to put the sum in.
+ * @param error :: reference to a double to put the error in.
+ */
+void EventList::integratePackedHelper(const PackedEvents &packed, const double minX, const double maxX,
+                                      const bool entireRange, double &sum, double &error) {
+  sum = 0;
+  error = 0;
+  // If a silly range was given, return 0.
+  if (!entireRange && maxX < minX)
+    return;
+
+  packed.forEach([&](const double tof, const double weight, const double errorSquared) {
+    if (!entireRange) {
+      if (tof < minX)
+        return true;
+      if (tof > maxX)
+        return false;
+    }
+    sum += weight;
+    error += errorSquared;
+    return true;
+  });
+  error = std::sqrt(error);
+}
+
 // --------------------------------------------------------------------------
 /** Integrate the events between a range of X values, or all events.
  *
@@ -2826,6 +3357,15 @@ void EventList::integrate(const double minX, const double maxX, const bool entir
     this->sortTof();
   }
 
+  if (m_columns) {
+    integrateColumnsHelper(*m_columns, minX, maxX, entireRange, sum, error);
+    return;
+  }
+  if (m_packed) {
+    integratePackedHelper(*m_packed, minX, maxX, entireRange, sum, error);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2854,6 +3394,9 @@ void EventList::integrate(const double minX, const double maxX, const bool entir
  * positive = unchanged, negative = reverse.
  */
 void EventList::convertTof(std::function<double(double)> func, const int sorting) {
+  this->invalidateHistogram();
+  if (m_packed)
+    this->useRowStorage();
   // fix the histogram parameter
   MantidVec &x = dataX();
   transform(x.cbegin(), x.cend(), x.begin(), func);
@@ -2868,6 +3411,11 @@ void EventList::convertTof(std::function<double(double)> func, const int sorting
   if (this->getNumberEvents() == 0)
     return;
 
+  if (m_columns) {
+    m_columns->convertTof(func);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2899,6 +3447,9 @@ template <class T> void EventList::convertTofHelper(std::vector<T> &events, cons
  * @param offset :: The value to shift the time-of-flight by
  */
 void EventList::convertTof(const double factor, const double offset) {
+  this->invalidateHistogram();
+  if (m_packed)
+    this->useRowStorage();
   // fix the histogram parameter
   auto &x = mutableX();
   x *= factor;
@@ -2910,6 +3461,11 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() == 0)
     return;
 
+  if (m_columns) {
+    m_columns->convertTof(factor, offset);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2989,6 +3545,7 @@ template <class T> void EventList::addPulsetimesHelper(std::vector<T> &events, c
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->useRowStorage();
   if (this->getNumberEvents() == 0)
     return;
 
@@ -3014,6 +3571,7 @@ void EventList::addPulsetime(const double seconds) {
  * @param seconds :: A set of values to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetimes(const std::vector<double> &seconds) {
+  this->useRowStorage();
   if (this->getNumberEvents() == 0)
     return;
   if (this->getNumberEvents() != seconds.size()) {
@@ -3082,6 +3640,7 @@ std::size_t EventList::maskTofHelper(std::vector<T> &events, const double tofMin
  * @param tofMax :: upper bound of TOF to filter out
  */
 void EventList::maskTof(const double tofMin, const double tofMax) {
+  this->invalidateHistogram();
   if (tofMax <= tofMin)
     throw std::runtime_error("EventList::maskTof: tofMax must be > tofMin");
 
@@ -3091,23 +3650,30 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
 
   // Start by sorting by tof
   this->sortTof();
+  if (m_packed)
+    this->useRowStorage();
 
   // Convert the list
   size_t numOrig = 0;
   size_t numDel = 0;
-  switch (eventType) {
-  case TOF:
-    numOrig = this->events->size();
-    numDel = this->maskTofHelper(*this->events, tofMin, tofMax);
-    break;
-  case WEIGHTED:
-    numOrig = this->weightedEvents->size();
-    numDel = this->maskTofHelper(*this->weightedEvents, tofMin, tofMax);
-    break;
-  case WEIGHTED_NOTIME:
-    numOrig = this->weightedEventsNoTime->size();
-    numDel = this->maskTofHelper(*this->weightedEventsNoTime, tofMin, tofMax);
-    break;
+  if (m_columns) {
+    numOrig = m_columns->size();
+    numDel = m_columns->maskTof(tofMin, tofMax);
+  } else {
+    switch (eventType) {
+    case TOF:
+      numOrig = this->events->size();
+      numDel = this->maskTofHelper(*this->events, tofMin, tofMax);
+      break;
+    case WEIGHTED:
+      numOrig = this->weightedEvents->size();
+      numDel = this->maskTofHelper(*this->weightedEvents, tofMin, tofMax);
+      break;
+    case WEIGHTED_NOTIME:
+      numOrig = this->weightedEventsNoTime->size();
+      numDel = this->maskTofHelper(*this->weightedEventsNoTime, tofMin, tofMax);
+      break;
+    }
   }
 
   if (numDel >= numOrig)
@@ -3150,6 +3716,7 @@ template <class T> std::size_t EventList::maskConditionHelper(std::vector<T> &ev
  * @param mask :: condition vector
  */
 void EventList::maskCondition(const std::vector<bool> &mask) {
+  this->invalidateHistogram();
 
   // mask size must match the number of events
   if (this->getNumberEvents() != mask.size())
@@ -3159,9 +3726,20 @@ void EventList::maskCondition(const std::vector<bool> &mask) {
   if (this->getNumberEvents() == 0)
     return;
 
+  if (m_packed)
+    this->useRowStorage();
+
   // Convert the list
   size_t numOrig = 0;
   size_t numDel = 0;
+  if (m_columns) {
+    numOrig = m_columns->size();
+    numDel = m_columns->maskCondition(mask);
+    if (numDel >= numOrig)
+      this->clear(false);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     numOrig = this->events->size();
@@ -3200,6 +3778,19 @@ void EventList::getTofs(std::vector<double> &tofs) const {
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
+  if (m_columns) {
+    tofs.assign(m_columns->tofs().cbegin(), m_columns->tofs().cend());
+    return;
+  }
+  if (m_packed) {
+    tofs.clear();
+    m_packed->forEach([&tofs](const double tof, double, double) {
+      tofs.emplace_back(tof);
+      return true;
+    });
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -3244,6 +3835,24 @@ void EventList::getWeights(std::vector<double> &weights) const {
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
+  if (m_columns && m_columns->hasWeights()) {
+    weights.assign(m_columns->weights().cbegin(), m_columns->weights().cend());
+    return;
+  }
+  if (m_packed) {
+    weights.clear();
+    m_packed->forEach([&weights](double, const double weight, double) {
+      weights.emplace_back(weight);
+      return true;
+    });
+    return;
+  }
+  // not a weighted event type, return 1.0 for all.
+  if (m_columns) {
+    weights.assign(this->getNumberEvents(), 1.0);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case WEIGHTED:
@@ -3290,6 +3899,27 @@ void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
+  if (m_columns && m_columns->hasWeights()) {
+    const auto &errorSquareds = m_columns->errorSquareds();
+    weightErrors.resize(errorSquareds.size());
+    std::transform(errorSquareds.cbegin(), errorSquareds.cend(), weightErrors.begin(),
+                   [](const float errorSquared) { return std::sqrt(double(errorSquared)); });
+    return;
+  }
+  if (m_packed) {
+    weightErrors.clear();
+    m_packed->forEach([&weightErrors](double, double, const double errorSquared) {
+      weightErrors.emplace_back(std::sqrt(errorSquared));
+      return true;
+    });
+    return;
+  }
+  // not a weighted event type, return 1.0 for all.
+  if (m_columns) {
+    weightErrors.assign(this->getNumberEvents(), 1.0);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case WEIGHTED:
@@ -3322,6 +3952,7 @@ std::vector<double> EventList::getWeightErrors() const {
  */
 template <typename UnaryOperation>
 std::vector<DateAndTime> EventList::eventTimesCalculator(const UnaryOperation &timesCalc) const {
+  this->useRowStorage();
   std::vector<DateAndTime> times;
   switch (eventType) {
   case TOF:
@@ -3391,6 +4022,19 @@ double EventList::getTofMin() const {
   if (this->empty())
     return tMin;
 
+  if (m_columns) {
+    const auto &tofs = m_columns->tofs();
+    return (this->order == TOF_SORT) ? tofs.front() : *std::min_element(tofs.cbegin(), tofs.cend());
+  }
+  // packed events are sorted, so the first is the smallest
+  if (m_packed) {
+    m_packed->forEach([&tMin](const double tof, double, double) {
+      tMin = tof;
+      return false;
+    });
+    return tMin;
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3433,6 +4077,19 @@ double EventList::getTofMax() const {
   if (this->empty())
     return tMax;
 
+  if (m_columns) {
+    const auto &tofs = m_columns->tofs();
+    return (this->order == TOF_SORT) ? tofs.back() : *std::max_element(tofs.cbegin(), tofs.cend());
+  }
+  // packed events are sorted, but only decode forwards
+  if (m_packed) {
+    m_packed->forEach([&tMax](const double tof, double, double) {
+      tMax = tof;
+      return true;
+    });
+    return tMax;
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3485,6 +4142,7 @@ template <class T> DateAndTime getPulseMaximumHelper(const std::vector<T> &event
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  this->useRowStorage();
   // no events is a soft error
   if (this->empty())
     return DateAndTime::maximum();
@@ -3518,6 +4176,7 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  this->useRowStorage();
   // no events is a soft error
   if (this->empty())
     return DateAndTime::minimum();
@@ -3549,6 +4208,7 @@ DateAndTime EventList::getPulseTimeMax() const {
 
 void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
                                    Mantid::Types::Core::DateAndTime &tMax) const {
+  this->useRowStorage();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3599,6 +4259,7 @@ void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
 }
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double &tofOffset) const {
+  this->useRowStorage();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3640,6 +4301,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double
 }
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor, const double &tofOffset) const {
+  this->useRowStorage();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3705,6 +4367,8 @@ template <class T> void EventList::setTofsHelper(std::vector<T> &events, const s
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   this->order = UNSORTED;
 
   // Convert the list
@@ -3803,10 +4467,21 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  this->invalidateHistogram();
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
 
+  if (m_packed)
+    this->useRowStorage();
+  if (m_columns) {
+    // Switch to weights if needed.
+    if (eventType == TOF)
+      this->switchTo(WEIGHTED);
+    m_columns->multiply(value, error);
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3928,6 +4603,8 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events, const MantidVec
  * @throw invalid_argument if the sizes of X, Y, E are not consistent.
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y, const MantidVec &E) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -4065,6 +4742,8 @@ void EventList::divideHistogramHelper(std::vector<T> &events, const MantidVec &X
  * @throw invalid_argument if the sizes of X, Y, E are not consistent.
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y, const MantidVec &E) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -4112,6 +4791,7 @@ EventList &EventList::operator/=(const double value) {
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 void EventList::divide(const double value, const double error) {
+  this->invalidateHistogram();
   if (value == 0.0)
     throw std::invalid_argument("EventList::divide() called with value of 0.0. Cannot divide by zero.");
   // Do nothing if dividing by exactly 1.0, no error
@@ -4141,6 +4821,7 @@ void EventList::divide(const double value, const double error) {
  */
 void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::DateAndTime stop,
                                   EventList &output) const {
+  this->useRowStorage();
   if (this == &output) {
     throw std::invalid_argument("In-place filtering is not allowed");
   }
@@ -4149,6 +4830,7 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
   this->sortPulseTime();
   // Clear the output
   output.clear();
+  output.useRowStorage();
   // Has to match the given type
   output.switchTo(eventType);
   output.setDetectorIDs(this->getDetectorIDs());
@@ -4183,11 +4865,13 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
  * @throws std::invalid_argument If output is a reference to this EventList
  */
 void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *output) const {
+  this->useRowStorage();
 
   this->sortPulseTime();
   // Clear the output
 
   output->clear();
+  output->useRowStorage();
   output->setDetectorIDs(this->getDetectorIDs());
   output->setHistogram(m_histogram);
   // Has to match the given type
@@ -4279,6 +4963,8 @@ void EventList::filterByTimeROIHelper(std::vector<T> &events, const std::vector<
  * @param timeRoi :: a TimeROI that will be used to filter events
  */
 void EventList::filterInPlace(Kernel::TimeROI const *timeRoi) {
+  this->invalidateHistogram();
+  this->useRowStorage();
   if (timeRoi == nullptr) {
     throw std::runtime_error("TimeROI can not be a nullptr\n");
   }
@@ -4476,6 +5162,7 @@ void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events, Mantid
  * @param toUnit :: the Unit describing the output unit. Must be initialized.
  */
 void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid::Kernel::Unit const *toUnit) {
+  this->invalidateHistogram();
   // Check for initialized
   if (!fromUnit || !toUnit)
     throw std::runtime_error("EventList::convertUnitsViaTof(): one of the units is NULL!");
@@ -4484,6 +5171,13 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid:
   if (!toUnit->isInitialized())
     throw std::runtime_error("EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  if (m_packed)
+    this->useRowStorage();
+  if (m_columns) {
+    m_columns->convertTof([fromUnit, toUnit](const double x) { return toUnit->singleFromTOF(fromUnit->singleToTOF(x)); });
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(*this->events, fromUnit, toUnit);
@@ -4519,6 +5213,14 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events, const
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  this->invalidateHistogram();
+  if (m_packed)
+    this->useRowStorage();
+  if (m_columns) {
+    m_columns->convertTof([factor, power](const double x) { return factor * std::pow(x, power); });
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(*this->events, factor, power);
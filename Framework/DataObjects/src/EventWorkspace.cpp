@@ -14,6 +14,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidDataObjects/PackedEvents.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/CPUTimer.h"
@@ -466,27 +467,64 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
     eventList->switchTo(type);
 }
 
+/** Change the in-memory layout of the events of all spectra. Packed spectra
+ * share one table of the pulse times of the whole workspace.
+ * @param storage :: the layout to use; see EventList::setStorageType()
+ */
+void EventWorkspace::setStorageType(const EventStorageType storage) {
+  const auto numberOfSpectra = static_cast<int>(this->data.size());
+  std::shared_ptr<const PackedEvents::PulseTable> pulseTable;
+  if (storage == PACKED_STORAGE) {
+    // Find the distinct pulse times of each spectrum, then of them all
+    std::vector<std::vector<int64_t>> pulseTimes(this->data.size());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numberOfSpectra; ++i) {
+      if (this->data[i]->getEventType() == Mantid::API::WEIGHTED_NOTIME)
+        continue;
+      auto &times = pulseTimes[i];
+      for (const auto &pulseTime : this->data[i]->getPulseTimes())
+        times.emplace_back(pulseTime.totalNanoseconds());
+      std::sort(times.begin(), times.end());
+      times.erase(std::unique(times.begin(), times.end()), times.end());
+    }
+    std::vector<int64_t> allPulseTimes;
+    for (auto &times : pulseTimes) {
+      allPulseTimes.insert(allPulseTimes.end(), times.cbegin(), times.cend());
+      std::vector<int64_t>().swap(times);
+    }
+    pulseTable = PackedEvents::makePulseTable(std::move(allPulseTimes));
+  }
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < numberOfSpectra; ++i)
+    this->data[i]->setStorageType(storage, pulseTable);
+}
+
 /// Returns true always - an EventWorkspace always represents histogramm-able
 /// data
 /// @returns If the data is a histogram - always true for an eventWorkspace
 bool EventWorkspace::isHistogramData() const { return true; }
 
-/** Return how many entries in the Y MRU list are used.
- * Only used in tests. It only returns the 0-th MRU list size.
- * @return :: number of entries in the MRU list.
+/** Return how many spectra have a cached histogram.
+ * Only used in tests.
+ * @return :: number of entries in the histogram cache.
  */
 size_t EventWorkspace::MRUSize() const { return mru->MRUSize(); }
 
-/** Clears the MRU lists */
+/** Clears the histogram cache. Changes made through the EventList methods are
+ * seen by the cache, but this must still be called after changing events
+ * through references kept from EventList::getEvents() and the like.
+ */
 void EventWorkspace::clearMRU() const { mru->clear(); }
 
 /// Returns the amount of memory used in bytes
 size_t EventWorkspace::getMemorySize() const {
-  // TODO: Add the MRU buffer
+  // Start with the cached histograms
+  size_t total = mru->getMemorySize();
 
   // Add the memory from all the event lists
-  size_t total = std::accumulate(data.begin(), data.end(), size_t{0},
-                                 [](size_t total, auto &list) { return total + list->getMemorySize(); });
+  total = std::accumulate(data.begin(), data.end(), total,
+                          [](size_t sum, auto &list) { return sum + list->getMemorySize(); });
 
   total += run().getMemorySize();
 
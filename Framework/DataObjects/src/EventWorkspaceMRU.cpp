@@ -5,166 +5,214 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/ConfigService.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 
 namespace Mantid::DataObjects {
 
-EventWorkspaceMRU::~EventWorkspaceMRU() {
-  // Make sure you free up the memory in the MRUs
-  {
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
-  }
-  Poco::ScopedWriteRWLock _lock2(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
-  }
+namespace {
+/// Budget used if none is set in the configuration
+constexpr int DEFAULT_BUDGET_MB = 256;
+/// Most stripes the cache is split into
+constexpr size_t MAX_STRIPES = 16;
+/// Smallest share of the budget worth giving a stripe of its own
+constexpr size_t MIN_STRIPE_BUDGET = 16 * 1024 * 1024;
+
+/// Read the memory budget from the ConfigService
+size_t budgetFromConfig() {
+  const auto budgetMB =
+      Kernel::ConfigService::Instance().getValue<int>("EventWorkspace.HistogramCacheSizeMB").value_or(DEFAULT_BUDGET_MB);
+  return static_cast<size_t>(std::max(budgetMB, 0)) * 1024 * 1024;
 }
 
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for E for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+/// Number of stripes to split a budget into. Small budgets get a single stripe
+/// so that the least recently used entry over the whole cache is dropped.
+size_t stripeCount(const size_t memoryBudget) {
+  return std::clamp(memoryBudget / MIN_STRIPE_BUDGET, size_t{1}, MAX_STRIPES);
+}
+} // namespace
+
+/// Constructor taking the memory budget from the configuration
+EventWorkspaceMRU::EventWorkspaceMRU() : EventWorkspaceMRU(budgetFromConfig()) {}
+
+/** Constructor. The number of stripes is fixed here from the budget.
+ * @param memoryBudget :: maximum bytes of Y and E to hold. 0 disables the cache.
  */
-void EventWorkspaceMRU::ensureEnoughBuffersE(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  if (m_bufferedDataE.size() <= thread_num) {
-    m_bufferedDataE.resize(thread_num + 1);
-    // Replaces empty data with an MRU list with this many entries.
-    std::transform(m_bufferedDataE.begin(), m_bufferedDataE.end(), m_bufferedDataE.begin(),
-                   [](auto &data) { return data ? std::move(data) : std::move(std::make_unique<mru_listE>(50)); });
-  }
+EventWorkspaceMRU::EventWorkspaceMRU(const size_t memoryBudget)
+    : m_stripes(stripeCount(memoryBudget)), m_memoryBudget(memoryBudget) {
+  for (auto &stripe : m_stripes)
+    stripe.memoryBudget = memoryBudget / m_stripes.size();
 }
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for Y for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+
+/** Find the stripe holding the entry of a spectrum
+ * @param index :: the EventList of the spectrum
+ * @return the stripe
  */
-void EventWorkspaceMRU::ensureEnoughBuffersY(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-  if (m_bufferedDataY.size() <= thread_num) {
-    m_bufferedDataY.resize(thread_num + 1);
-    // Replaces empty data with an MRU list with this many entries.
-    std::transform(m_bufferedDataY.begin(), m_bufferedDataY.end(), m_bufferedDataY.begin(),
-                   [](auto &data) { return data ? std::move(data) : std::move(std::make_unique<mru_listY>(50)); });
-  }
+EventWorkspaceMRU::Stripe &EventWorkspaceMRU::stripeFor(const EventList *index) const {
+  if (m_stripes.size() == 1)
+    return m_stripes.front();
+  // Fibonacci hashing, as the low bits of the addresses are mostly alignment
+  const auto key = static_cast<uint64_t>(reinterpret_cast<std::uintptr_t>(index));
+  return m_stripes[((key * 11400714819323198485ULL) >> 32) % m_stripes.size()];
 }
 
 //---------------------------------------------------------------------------
-/// Clear all the data in the MRU buffers
+/// Clear all the cached histograms
 void EventWorkspaceMRU::clear() {
-  {
-    // Make sure you free up the memory in the MRUs
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
+  for (auto &stripe : m_stripes) {
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    stripe.clear();
   }
+}
 
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
-  }
+/// Clear the entries of the stripe. The caller must hold its lock.
+void EventWorkspaceMRU::Stripe::clear() {
+  entries.clear();
+  recency.clear();
+  memorySize = 0;
 }
 
 //---------------------------------------------------------------------------
-/** Find a Y histogram in the MRU
+/** Find the entry for a spectrum if it is still valid, marking it as the most
+ * recently used. The caller must hold the lock of the stripe.
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: the EventList of the spectrum
+ * @param x :: the current bin edges of the spectrum
+ * @param version :: the current data version of the EventList
+ * @return the entry, or nullptr if there is none or it is out of date.
  */
-Kernel::cow_ptr<HistogramData::HistogramY> EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto result = m_bufferedDataY[thread_num]->find(reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
-  return YType(nullptr);
+const EventWorkspaceMRU::Entry *EventWorkspaceMRU::Stripe::findValid(const EventList *index, const XType &x,
+                                                                     const uint64_t version) {
+  const auto it = entries.find(index);
+  if (it == entries.end())
+    return nullptr;
+  const auto &entry = it->second;
+  if (entry.version != version || !(entry.x == x || (entry.x && x && entry.x->rawData() == x->rawData())))
+    return nullptr;
+  recency.splice(recency.end(), recency, entry.position);
+  return &entry;
 }
 
-/** Find a Y histogram in the MRU
+/** Find a Y histogram in the cache
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: the EventList of the spectrum
+ * @param x :: the current bin edges of the spectrum
+ * @param version :: the current data version of the EventList
+ * @return the Y histogram; NULL if not found or out of date.
  */
-Kernel::cow_ptr<HistogramData::HistogramE> EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto result = m_bufferedDataE[thread_num]->find(reinterpret_cast<std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
-  return EType(nullptr);
+EventWorkspaceMRU::YType EventWorkspaceMRU::findY(const EventList *index, const XType &x,
+                                                  const uint64_t version) const {
+  auto &stripe = stripeFor(index);
+  std::lock_guard<std::mutex> lock(stripe.mutex);
+  const auto entry = stripe.findValid(index, x, version);
+  return entry ? entry->y : YType(nullptr);
 }
 
-/** Insert a new histogram into the MRU
+/** Find an E histogram in the cache
  *
- * @param thread_num :: thread being accessed
- * @param data :: the new data
- * @param index :: index of the data to insert
+ * @param index :: the EventList of the spectrum
+ * @param x :: the current bin edges of the spectrum
+ * @param version :: the current data version of the EventList
+ * @return the E histogram; NULL if not found or out of date.
  */
-void EventWorkspaceMRU::insertY(size_t thread_num, YType data, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto yWithMarker = std::make_shared<TypeWithMarker<YType>>(reinterpret_cast<std::uintptr_t>(index));
-  yWithMarker->m_data = std::move(data);
-  m_bufferedDataY[thread_num]->insert(yWithMarker);
-  // the memory is cleared automatically due to being a smart_ptr
+EventWorkspaceMRU::EType EventWorkspaceMRU::findE(const EventList *index, const XType &x,
+                                                  const uint64_t version) const {
+  auto &stripe = stripeFor(index);
+  std::lock_guard<std::mutex> lock(stripe.mutex);
+  const auto entry = stripe.findValid(index, x, version);
+  return entry ? entry->e : EType(nullptr);
 }
 
-/** Insert a new histogram into the MRU
+/** Insert a newly generated histogram, replacing any previous one for the
+ * same spectrum. The least recently used entries of its stripe are dropped if
+ * this goes over the budget.
  *
- * @param thread_num :: thread being accessed
- * @param data :: the new data
- * @param index :: index of the data to insert
+ * @param index :: the EventList of the spectrum
+ * @param x :: the bin edges the histogram was generated with
+ * @param version :: the data version of the EventList it was generated from
+ * @param y :: the Y histogram
+ * @param e :: the E histogram
+ */
+void EventWorkspaceMRU::insert(const EventList *index, const XType &x, const uint64_t version, YType y, EType e) {
+  const size_t memory = (y->size() + e->size()) * sizeof(double);
+
+  auto &stripe = stripeFor(index);
+  std::lock_guard<std::mutex> lock(stripe.mutex);
+  if (memory > stripe.memoryBudget)
+    return;
+  const auto existing = stripe.entries.find(index);
+  if (existing != stripe.entries.end())
+    stripe.eraseEntry(existing);
+
+  stripe.recency.emplace_back(index);
+  stripe.entries.emplace(index, Entry{x, version, std::move(y), std::move(e), memory, std::prev(stripe.recency.end())});
+  stripe.memorySize += memory;
+  stripe.evictToBudget();
+}
+
+/** Remove an entry. The caller must hold the lock of the stripe.
+ * @param entry :: iterator to the entry to remove
  */
-void EventWorkspaceMRU::insertE(size_t thread_num, EType data, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto eWithMarker = std::make_shared<TypeWithMarker<EType>>(reinterpret_cast<std::uintptr_t>(index));
-  eWithMarker->m_data = std::move(data);
-  m_bufferedDataE[thread_num]->insert(eWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
+void EventWorkspaceMRU::Stripe::eraseEntry(std::unordered_map<const EventList *, Entry>::iterator entry) {
+  memorySize -= entry->second.memory;
+  recency.erase(entry->second.position);
+  entries.erase(entry);
 }
 
-/** Delete any entries in the MRU at the given index
+/// Drop the least recently used entries until the stripe fits its budget. The
+/// caller must hold the lock of the stripe.
+void EventWorkspaceMRU::Stripe::evictToBudget() {
+  while (memorySize > memoryBudget && !recency.empty())
+    eraseEntry(entries.find(recency.front()));
+}
+
+/** Delete any entry for the given spectrum
  *
  * @param index :: index to delete.
  */
 void EventWorkspaceMRU::deleteIndex(const EventList *index) {
-  // acquire lock if the buffer isn't empty
-  if (!m_bufferedDataE.empty()) {
-    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexE);
-    for (auto &data : m_bufferedDataE) {
-      if (data) {
-        data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
-      }
-    }
+  auto &stripe = stripeFor(index);
+  std::lock_guard<std::mutex> lock(stripe.mutex);
+  const auto entry = stripe.entries.find(index);
+  if (entry != stripe.entries.end())
+    stripe.eraseEntry(entry);
+}
+
+size_t EventWorkspaceMRU::MRUSize() const {
+  size_t size = 0;
+  for (auto &stripe : m_stripes) {
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    size += stripe.entries.size();
   }
-  // acquire lock if the buffer isn't empty
-  if ((!m_bufferedDataY.empty())) {
-    Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->deleteIndex(reinterpret_cast<std::uintptr_t>(index));
-      }
-    }
+  return size;
+}
+
+/// @return the bytes of Y and E currently cached
+size_t EventWorkspaceMRU::getMemorySize() const {
+  size_t memory = 0;
+  for (auto &stripe : m_stripes) {
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    memory += stripe.memorySize;
   }
+  return memory;
 }
 
-size_t EventWorkspaceMRU::MRUSize() const {
-  if (m_bufferedDataY.empty()) {
-    return 0;
-  } else {
-    return this->m_bufferedDataY.front()->size();
+/// @return the maximum bytes of Y and E that will be cached
+size_t EventWorkspaceMRU::getMemoryBudget() const { return m_memoryBudget; }
+
+/** Change the memory budget, dropping the least recently used entries if they
+ * no longer fit. The budget is shared evenly between the existing stripes.
+ * @param memoryBudget :: maximum bytes of Y and E to hold. 0 disables the cache.
+ */
+void EventWorkspaceMRU::setMemoryBudget(const size_t memoryBudget) {
+  m_memoryBudget = memoryBudget;
+  for (auto &stripe : m_stripes) {
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    stripe.memoryBudget = memoryBudget / m_stripes.size();
+    stripe.evictToBudget();
   }
 }
 
@@ -0,0 +1,232 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/PackedEvents.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace Mantid::DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+using namespace Mantid::API;
+
+namespace {
+/// Append a variable-length integer: seven bits per byte, high bit set on all but the last
+void writeVarint(std::vector<uint8_t> &data, uint64_t value) {
+  while (value >= 0x80) {
+    data.emplace_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  data.emplace_back(static_cast<uint8_t>(value));
+}
+
+/// Map signed integers to unsigned so that small magnitudes stay small
+uint64_t zigzag(const uint64_t value) {
+  return (value << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(value) >> 63);
+}
+
+/// Map a float to an unsigned key whose order is the order of the values
+uint64_t keyOf(const float value) {
+  const auto bits = std::bit_cast<uint32_t>(value);
+  return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+}
+
+/// Map a double to an unsigned key whose order is the order of the values
+uint64_t keyOf(const double value) {
+  const auto bits = std::bit_cast<uint64_t>(value);
+  return (bits & 0x8000000000000000ull) ? ~bits : bits | 0x8000000000000000ull;
+}
+
+/// Append the differences between successive keys
+template <typename T> void packKeys(const std::vector<double> &tofs, std::vector<uint8_t> &data) {
+  uint64_t previous = 0;
+  for (const double tof : tofs) {
+    const uint64_t key = keyOf(static_cast<T>(tof));
+    // Wraps around for a decrease, which zigzag turns back into a small number
+    writeVarint(data, zigzag(key - previous));
+    previous = key;
+  }
+}
+
+template <typename T> std::vector<double> tofsOf(const std::vector<T> &events) {
+  std::vector<double> tofs;
+  tofs.reserve(events.size());
+  std::transform(events.cbegin(), events.cend(), std::back_inserter(tofs), [](const T &event) { return event.tof(); });
+  return tofs;
+}
+
+template <typename T> std::vector<int64_t> pulseTimesOf(const std::vector<T> &events) {
+  std::vector<int64_t> pulseTimes;
+  pulseTimes.reserve(events.size());
+  std::transform(events.cbegin(), events.cend(), std::back_inserter(pulseTimes),
+                 [](const T &event) { return event.pulseTime().totalNanoseconds(); });
+  return pulseTimes;
+}
+} // namespace
+
+/** Pack TofEvent's
+ * @param events :: the events, best sorted by time-of-flight
+ * @param pulseTable :: the pulse times to index, which must include those of
+ * the events; by default a table of just those is made
+ * @throw std::invalid_argument if a pulse time is not in the table
+ */
+PackedEvents::PackedEvents(const std::vector<TofEvent> &events, std::shared_ptr<const PulseTable> pulseTable)
+    : m_eventType(TOF), m_size(events.size()) {
+  packTofs(tofsOf(events));
+  packPulseTimes(pulseTimesOf(events), std::move(pulseTable));
+}
+
+/** Pack WeightedEvent's
+ * @param events :: the events, best sorted by time-of-flight
+ * @param pulseTable :: the pulse times to index, which must include those of
+ * the events; by default a table of just those is made
+ * @throw std::invalid_argument if a pulse time is not in the table
+ */
+PackedEvents::PackedEvents(const std::vector<WeightedEvent> &events, std::shared_ptr<const PulseTable> pulseTable)
+    : m_eventType(WEIGHTED), m_size(events.size()) {
+  packTofs(tofsOf(events));
+  packPulseTimes(pulseTimesOf(events), std::move(pulseTable));
+  m_weight.reserve(m_size);
+  m_errorSquared.reserve(m_size);
+  for (const auto &event : events) {
+    m_weight.emplace_back(static_cast<float>(event.weight()));
+    m_errorSquared.emplace_back(static_cast<float>(event.errorSquared()));
+  }
+}
+
+/** Pack WeightedEventNoTime's
+ * @param events :: the events, best sorted by time-of-flight
+ */
+PackedEvents::PackedEvents(const std::vector<WeightedEventNoTime> &events)
+    : m_eventType(WEIGHTED_NOTIME), m_size(events.size()) {
+  packTofs(tofsOf(events));
+  m_weight.reserve(m_size);
+  m_errorSquared.reserve(m_size);
+  for (const auto &event : events) {
+    m_weight.emplace_back(static_cast<float>(event.weight()));
+    m_errorSquared.emplace_back(static_cast<float>(event.errorSquared()));
+  }
+}
+
+/** Make a table of pulse times that packed lists can share
+ * @param pulseTimes :: pulse times in nanoseconds, in any order and with repeats
+ * @return the distinct pulse times in ascending order
+ */
+std::shared_ptr<const PackedEvents::PulseTable> PackedEvents::makePulseTable(std::vector<int64_t> pulseTimes) {
+  std::sort(pulseTimes.begin(), pulseTimes.end());
+  pulseTimes.erase(std::unique(pulseTimes.begin(), pulseTimes.end()), pulseTimes.end());
+  pulseTimes.shrink_to_fit();
+  return std::make_shared<const PulseTable>(std::move(pulseTimes));
+}
+
+/// Encode the times-of-flight, as floats if that loses nothing
+void PackedEvents::packTofs(const std::vector<double> &tofs) {
+  m_singlePrecision = std::all_of(tofs.cbegin(), tofs.cend(),
+                                  [](const double tof) { return static_cast<double>(static_cast<float>(tof)) == tof; });
+  m_tofs.reserve(tofs.size() * 2);
+  if (m_singlePrecision)
+    packKeys<float>(tofs, m_tofs);
+  else
+    packKeys<double>(tofs, m_tofs);
+  m_tofs.shrink_to_fit();
+}
+
+/// Encode the pulse times as indices into a table
+void PackedEvents::packPulseTimes(const std::vector<int64_t> &pulseTimes,
+                                  std::shared_ptr<const PulseTable> pulseTable) {
+  m_pulseTable = pulseTable ? std::move(pulseTable) : makePulseTable(pulseTimes);
+  const auto &table = *m_pulseTable;
+  m_pulseIndices.reserve(pulseTimes.size() * 3);
+  for (const auto pulseTime : pulseTimes) {
+    const auto found = std::lower_bound(table.cbegin(), table.cend(), pulseTime);
+    if (found == table.cend() || *found != pulseTime)
+      throw std::invalid_argument("PackedEvents: a pulse time is missing from the pulse table");
+    writeVarint(m_pulseIndices, static_cast<uint64_t>(std::distance(table.cbegin(), found)));
+  }
+  m_pulseIndices.shrink_to_fit();
+}
+
+/// @return the times-of-flight decoded
+std::vector<double> PackedEvents::unpackTofs() const {
+  std::vector<double> tofs;
+  tofs.reserve(m_size);
+  this->forEach([&tofs](const double tof, double, double) {
+    tofs.emplace_back(tof);
+    return true;
+  });
+  return tofs;
+}
+
+/// @return the pulse times decoded, in nanoseconds
+std::vector<int64_t> PackedEvents::unpackPulseTimes() const {
+  std::vector<int64_t> pulseTimes;
+  pulseTimes.reserve(m_size);
+  const uint8_t *indices = m_pulseIndices.data();
+  for (size_t i = 0; i < m_size; ++i)
+    pulseTimes.emplace_back((*m_pulseTable)[readVarint(indices)]);
+  return pulseTimes;
+}
+
+/** Write the events back out as TofEvent's
+ * @param events :: vector to fill; any existing contents are replaced
+ * @throw std::runtime_error if the events are weighted
+ */
+void PackedEvents::copyInto(std::vector<TofEvent> &events) const {
+  if (m_eventType != TOF)
+    throw std::runtime_error("PackedEvents::copyInto() cannot write weighted events to TofEvent's");
+  const auto tofs = unpackTofs();
+  const auto pulseTimes = unpackPulseTimes();
+  events.clear();
+  events.reserve(m_size);
+  for (size_t i = 0; i < m_size; ++i)
+    events.emplace_back(tofs[i], DateAndTime(pulseTimes[i]));
+}
+
+/** Write the events back out as WeightedEvent's
+ * @param events :: vector to fill; any existing contents are replaced
+ * @throw std::runtime_error if the events have no pulse times
+ */
+void PackedEvents::copyInto(std::vector<WeightedEvent> &events) const {
+  if (m_eventType == WEIGHTED_NOTIME)
+    throw std::runtime_error("PackedEvents::copyInto() cannot write events without pulse times to WeightedEvent's");
+  const auto tofs = unpackTofs();
+  const auto pulseTimes = unpackPulseTimes();
+  events.clear();
+  events.reserve(m_size);
+  for (size_t i = 0; i < m_size; ++i) {
+    if (m_weight.empty())
+      events.emplace_back(tofs[i], DateAndTime(pulseTimes[i]), 1.0, 1.0);
+    else
+      events.emplace_back(tofs[i], DateAndTime(pulseTimes[i]), m_weight[i], m_errorSquared[i]);
+  }
+}
+
+/** Write the events back out as WeightedEventNoTime's
+ * @param events :: vector to fill; any existing contents are replaced
+ */
+void PackedEvents::copyInto(std::vector<WeightedEventNoTime> &events) const {
+  events.clear();
+  events.reserve(m_size);
+  this->forEach([&events](const double tof, const double weight, const double errorSquared) {
+    events.emplace_back(tof, weight, errorSquared);
+    return true;
+  });
+}
+
+/** @return the memory used in bytes. A shared pulse table is divided between
+ * the lists sharing it.
+ */
+size_t PackedEvents::getMemorySize() const {
+  size_t tableSize = 0;
+  if (m_pulseTable)
+    tableSize = m_pulseTable->capacity() * sizeof(int64_t) / static_cast<size_t>(m_pulseTable.use_count());
+  return m_tofs.capacity() + m_pulseIndices.capacity() + m_weight.capacity() * sizeof(float) +
+         m_errorSquared.capacity() * sizeof(float) + tableSize + sizeof(PackedEvents);
+}
+
+} // namespace Mantid::DataObjects
@@ -526,6 +526,14 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
   if (this->empty())
     return;
 
+  // Split a copy of file-backed or packed events rather than pulling the input onto the heap
+  if (events.getStorageType() == FILE_BACKED_STORAGE || events.getStorageType() == PACKED_STORAGE) {
+    EventList rows(events);
+    rows.setStorageType(ROW_STORAGE);
+    this->splitEventList(rows, partials, pulseTof, tofCorrect, factor, shift);
+    return;
+  }
+
   // sort the input EventList in-place
   const EventSortType sortOrder = pulseTof ? EventSortType::PULSETIMETOF_SORT
                                            : EventSortType::PULSETIME_SORT; // this will be used to set order on outputs
@@ -0,0 +1,190 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidKernel/MappedFileArena.h"
+#include <cxxtest/TestSuite.h>
+
+#include <filesystem>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+using std::vector;
+using Tofs = EventColumns::Column<double>;
+using PulseTimes = EventColumns::Column<int64_t>;
+
+class EventColumnsTest : public CxxTest::TestSuite {
+private:
+  vector<TofEvent> makeTofEvents() {
+    vector<TofEvent> events;
+    events.emplace_back(100., DateAndTime(200));
+    events.emplace_back(3.5, DateAndTime(400));
+    events.emplace_back(50., DateAndTime(60));
+    events.emplace_back(3.5, DateAndTime(10));
+    return events;
+  }
+
+public:
+  void test_assign_and_copyInto_TofEvent() {
+    EventColumns columns;
+    const auto events = makeTofEvents();
+    columns.assign(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), TOF);
+    TS_ASSERT_EQUALS(columns.size(), 4);
+    TS_ASSERT(columns.hasPulseTimes());
+    TS_ASSERT(!columns.hasWeights());
+    TS_ASSERT(columns.weights().empty());
+    TS_ASSERT_EQUALS(columns.weight(0), 1.0);
+    TS_ASSERT_EQUALS(columns.pulseTimes()[1], 400);
+
+    vector<TofEvent> out;
+    columns.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_assign_and_copyInto_WeightedEvent() {
+    vector<WeightedEvent> events;
+    events.emplace_back(100., DateAndTime(200), 2.0, 3.0);
+    events.emplace_back(3.5, DateAndTime(400), 4.0, 5.0);
+    EventColumns columns;
+    columns.assign(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(columns.weight(1), 4.0);
+    TS_ASSERT_EQUALS(columns.errorSquared(1), 5.0);
+
+    vector<WeightedEvent> out;
+    columns.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+    vector<TofEvent> tofOut;
+    TS_ASSERT_THROWS(columns.copyInto(tofOut), const std::runtime_error &);
+  }
+
+  void test_assign_and_copyInto_WeightedEventNoTime() {
+    vector<WeightedEventNoTime> events;
+    events.emplace_back(100., 2.0, 3.0);
+    events.emplace_back(3.5, 4.0, 5.0);
+    EventColumns columns;
+    columns.assign(events);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT(!columns.hasPulseTimes());
+    TS_ASSERT(columns.pulseTimes().empty());
+
+    vector<WeightedEventNoTime> out;
+    columns.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+    vector<WeightedEvent> weightedOut;
+    TS_ASSERT_THROWS(columns.copyInto(weightedOut), const std::runtime_error &);
+  }
+
+  void test_switchTo() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    columns.switchTo(WEIGHTED);
+    TS_ASSERT_EQUALS(columns.weights().size(), 4);
+    TS_ASSERT_EQUALS(columns.errorSquared(2), 1.0);
+    TS_ASSERT_THROWS(columns.switchTo(TOF), const std::runtime_error &);
+
+    columns.switchTo(WEIGHTED_NOTIME);
+    TS_ASSERT(columns.pulseTimes().empty());
+    TS_ASSERT_EQUALS(columns.size(), 4);
+    TS_ASSERT_THROWS(columns.switchTo(WEIGHTED), const std::runtime_error &);
+  }
+
+  void test_sortTof_is_stable_and_moves_all_columns() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    columns.sortTof();
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({3.5, 3.5, 50., 100.}));
+    // the two events at 3.5 keep their original order
+    TS_ASSERT_EQUALS(columns.pulseTimes(), PulseTimes({400, 10, 60, 200}));
+
+    columns.reverse();
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({100., 50., 3.5, 3.5}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(), PulseTimes({200, 60, 10, 400}));
+  }
+
+  void test_convertTof() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    columns.convertTof(2.0, 1.0);
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({201., 8., 101., 8.}));
+    columns.convertTof([](double tof) { return tof - 1.0; });
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({200., 7., 100., 7.}));
+  }
+
+  void test_maskTof() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    columns.switchTo(WEIGHTED);
+    columns.sortTof();
+    TS_ASSERT_EQUALS(columns.maskTof(3.5, 50.), 3);
+    TS_ASSERT_EQUALS(columns.size(), 1);
+    TS_ASSERT_EQUALS(columns.tofs()[0], 100.);
+    TS_ASSERT_EQUALS(columns.pulseTimes()[0], 200);
+    TS_ASSERT_EQUALS(columns.weights().size(), 1);
+    TS_ASSERT_EQUALS(columns.maskTof(200., 300.), 0);
+  }
+
+  void test_maskCondition() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    TS_ASSERT_EQUALS(columns.maskCondition({true, false, true, false}), 2);
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({100., 50.}));
+    TS_ASSERT_EQUALS(columns.pulseTimes(), PulseTimes({200, 60}));
+    TS_ASSERT_THROWS(columns.maskCondition({true}), const std::invalid_argument &);
+  }
+
+  void test_multiply_switches_to_weighted() {
+    EventColumns columns;
+    columns.assign(makeTofEvents());
+    columns.multiply(2.0, 0.5);
+    TS_ASSERT_EQUALS(columns.getEventType(), WEIGHTED);
+    TS_ASSERT_DELTA(columns.weight(0), 2.0, 1e-6);
+    // errorSquared = 1 * 2^2 + 0.5^2 * 1^2
+    TS_ASSERT_DELTA(columns.errorSquared(0), 4.25, 1e-6);
+  }
+
+  void test_equality_and_clear() {
+    EventColumns lhs, rhs;
+    lhs.assign(makeTofEvents());
+    rhs.assign(makeTofEvents());
+    TS_ASSERT(lhs == rhs);
+    rhs.switchTo(WEIGHTED);
+    TS_ASSERT(!(lhs == rhs));
+
+    const size_t memory = lhs.getMemorySize();
+    lhs.clear();
+    TS_ASSERT(lhs.empty());
+    TS_ASSERT_LESS_THAN(lhs.getMemorySize(), memory);
+  }
+
+  void test_columns_in_arena_stay_there() {
+    auto arena = std::make_shared<Kernel::MappedFileArena>(std::filesystem::temp_directory_path().string(), 4096);
+    EventColumns columns(TOF, arena);
+    columns.assign(makeTofEvents());
+    columns.switchTo(WEIGHTED);
+    columns.sortTof();
+    TS_ASSERT_EQUALS(columns.arena(), arena);
+    TS_ASSERT_EQUALS(columns.tofs(), Tofs({3.5, 3.5, 50., 100.}));
+    TS_ASSERT_LESS_THAN(0, arena->getAllocatedSize());
+
+    // A copy shares the arena
+    EventColumns copy(columns);
+    TS_ASSERT_EQUALS(copy.arena(), arena);
+    TS_ASSERT(copy == columns);
+
+    copy.clear();
+    columns.clear();
+    TS_ASSERT_EQUALS(columns.arena(), arena);
+    TS_ASSERT_EQUALS(arena->getAllocatedSize(), 0);
+  }
+};
@@ -318,6 +318,18 @@ public:
     TS_ASSERT_EQUALS(rel[5].tof(), 50);
   }
 
+  void test_reserve_and_capacity() {
+    EventList el;
+    el.reserve(10);
+    TS_ASSERT_LESS_THAN_EQUALS(10, el.capacity());
+    el.switchTo(WEIGHTED);
+    el.reserve(20);
+    TS_ASSERT_LESS_THAN_EQUALS(20, el.capacity());
+    el.switchTo(WEIGHTED_NOTIME);
+    el.reserve(30);
+    TS_ASSERT_LESS_THAN_EQUALS(30, el.capacity());
+  }
+
   void test_DetectorIDs() {
     EventList el1;
     el1.addDetectorID(14);
@@ -1373,6 +1385,149 @@ public:
     }
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_columnStorage_histogram_matches_row_storage_allTypes() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+      EventList columnar(el);
+      columnar.setStorageType(COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(columnar.getStorageType(), COLUMN_STORAGE);
+      TS_ASSERT_EQUALS(columnar.getNumberEvents(), el.getNumberEvents());
+
+      MantidVec rowY, rowE, colY, colE;
+      el.generateHistogram(el.readX(), rowY, rowE);
+      columnar.generateHistogram(el.readX(), colY, colE);
+      TS_ASSERT_EQUALS(rowY, colY);
+      TS_ASSERT_EQUALS(rowE, colE);
+      TS_ASSERT_DELTA(columnar.integrate(0., MAX_TOF, false), el.integrate(0., MAX_TOF, false), 1e-8);
+    }
+  }
+
+  void test_columnStorage_maskTof_and_convertTof_allTypes() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      EventList columnar(el);
+      columnar.setStorageType(COLUMN_STORAGE);
+
+      el.maskTof(MAX_TOF * 0.25, MAX_TOF * 0.5);
+      columnar.maskTof(MAX_TOF * 0.25, MAX_TOF * 0.5);
+      el.convertTof(2.5, 1.);
+      columnar.convertTof(2.5, 1.);
+      TS_ASSERT_EQUALS(columnar.getTofs(), el.getTofs());
+      TS_ASSERT_EQUALS(columnar.getWeights(), el.getWeights());
+      TS_ASSERT_EQUALS(columnar.getTofMin(), el.getTofMin());
+      TS_ASSERT_EQUALS(columnar.getTofMax(), el.getTofMax());
+
+      // Going back to rows restores exactly the same events
+      columnar.setStorageType(ROW_STORAGE);
+      TS_ASSERT_EQUALS(columnar.getStorageType(), ROW_STORAGE);
+      TS_ASSERT(columnar == el);
+    }
+  }
+
+  void test_columnStorage_falls_back_to_rows_for_pulse_time_access() {
+    this->fake_uniform_data();
+    EventList columnar(el);
+    columnar.setStorageType(COLUMN_STORAGE);
+    TS_ASSERT_EQUALS(columnar.getPulseTimes(), el.getPulseTimes());
+    TS_ASSERT_EQUALS(columnar.getStorageType(), ROW_STORAGE);
+
+    columnar.setStorageType(COLUMN_STORAGE);
+    columnar += TofEvent(1.0, 2);
+    TS_ASSERT_EQUALS(columnar.getStorageType(), ROW_STORAGE);
+    TS_ASSERT_EQUALS(columnar.getNumberEvents(), el.getNumberEvents() + 1);
+  }
+
+  void test_fileBackedStorage_matches_row_storage_allTypes() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+      EventList fileBacked(el);
+      fileBacked.setStorageType(FILE_BACKED_STORAGE);
+      TS_ASSERT_EQUALS(fileBacked.getStorageType(), FILE_BACKED_STORAGE);
+
+      MantidVec rowY, rowE, fileY, fileE;
+      el.generateHistogram(el.readX(), rowY, rowE);
+      fileBacked.generateHistogram(el.readX(), fileY, fileE);
+      TS_ASSERT_EQUALS(rowY, fileY);
+      TS_ASSERT_EQUALS(rowE, fileE);
+
+      // Copies stay on disk
+      EventList copy(fileBacked);
+      TS_ASSERT_EQUALS(copy.getStorageType(), FILE_BACKED_STORAGE);
+
+      fileBacked.setStorageType(ROW_STORAGE);
+      TS_ASSERT(fileBacked == el);
+    }
+  }
+
+  void test_adding_fileBacked_list_leaves_it_on_disk() {
+    this->fake_uniform_data();
+    EventList fileBacked(el);
+    fileBacked.setStorageType(FILE_BACKED_STORAGE);
+
+    EventList sum;
+    sum += fileBacked;
+    TS_ASSERT_EQUALS(fileBacked.getStorageType(), FILE_BACKED_STORAGE);
+    TS_ASSERT_EQUALS(sum.getStorageType(), ROW_STORAGE);
+    TS_ASSERT_EQUALS(sum.getNumberEvents(), el.getNumberEvents());
+  }
+
+  void test_packedStorage_matches_row_storage_allTypes() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      this->test_setX();
+      EventList packed(el);
+      packed.setStorageType(PACKED_STORAGE);
+      TS_ASSERT_EQUALS(packed.getStorageType(), PACKED_STORAGE);
+      TS_ASSERT_EQUALS(packed.getNumberEvents(), el.getNumberEvents());
+      TS_ASSERT_LESS_THAN(packed.getMemorySize(), el.getMemorySize());
+
+      MantidVec rowY, rowE, packedY, packedE;
+      el.generateHistogram(el.readX(), rowY, rowE);
+      packed.generateHistogram(el.readX(), packedY, packedE);
+      TS_ASSERT_EQUALS(rowY, packedY);
+      TS_ASSERT_EQUALS(rowE, packedE);
+      TS_ASSERT_DELTA(packed.integrate(0., MAX_TOF, false), el.integrate(0., MAX_TOF, false), 1e-8);
+      TS_ASSERT_DELTA(packed.integrate(0., 0., true), el.integrate(0., 0., true), 1e-8);
+      TS_ASSERT_EQUALS(packed.getTofs(), el.getTofs());
+      TS_ASSERT_EQUALS(packed.getWeights(), el.getWeights());
+      TS_ASSERT_EQUALS(packed.getTofMin(), el.getTofMin());
+      TS_ASSERT_EQUALS(packed.getTofMax(), el.getTofMax());
+      TS_ASSERT_EQUALS(packed.getStorageType(), PACKED_STORAGE);
+
+      // Going back to rows restores exactly the same events
+      packed.setStorageType(ROW_STORAGE);
+      TS_ASSERT(packed == el);
+    }
+  }
+
+  void test_packedStorage_unpacks_to_modify() {
+    this->fake_uniform_data();
+    el.sortTof();
+    EventList packed(el);
+    packed.setStorageType(PACKED_STORAGE);
+    el.convertTof(2.5, 1.);
+    packed.convertTof(2.5, 1.);
+    TS_ASSERT_EQUALS(packed.getStorageType(), ROW_STORAGE);
+    TS_ASSERT(packed == el);
+
+    packed.setStorageType(PACKED_STORAGE);
+    EventList sum;
+    sum += packed;
+    TS_ASSERT_EQUALS(packed.getStorageType(), PACKED_STORAGE);
+    TS_ASSERT_EQUALS(sum.getNumberEvents(), el.getNumberEvents());
+
+    packed += TofEvent(1.0, 2);
+    TS_ASSERT_EQUALS(packed.getStorageType(), ROW_STORAGE);
+    TS_ASSERT_EQUALS(packed.getNumberEvents(), el.getNumberEvents() + 1);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_getTofs_and_setTofs() {
     // Go through each possible EventType as the input
@@ -2882,10 +3037,10 @@ public:
 
     TS_ASSERT(!e.isSortedByTof());
 
-    // setting step size to 0.001 will cause findLinearBin to get bin out of range of X
+    // the bins are found from X, so a step size that does not match X makes no difference
     TS_ASSERT_THROWS_NOTHING(e.generateHistogram(0.01, X, Y, E));
 
-    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 101, 1e-8);
+    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 1000, 1e-8);
   }
 
   void test_generateHistogramUnsortedLinear_WEIGHTED_bad_params() {
@@ -2898,10 +3053,10 @@ public:
 
     TS_ASSERT(!e.isSortedByTof());
 
-    // setting step size to 0.001 will cause findLinearBin to get bin out of range of X
+    // the bins are found from X, so a step size that does not match X makes no difference
     TS_ASSERT_THROWS_NOTHING(e.generateHistogram(0.01, X, Y, E));
 
-    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 101, 1e-8);
+    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 1000, 1e-8);
   }
 
   void test_generateHistogramUnsortedLog_bad_params() {
@@ -2914,10 +3069,10 @@ public:
 
     TS_ASSERT(!e.isSortedByTof());
 
-    // setting step size to -0.001 will cause findLogBin to get bin out of range of X
+    // the bins are found from X, so a step size that does not match X makes no difference
     TS_ASSERT_THROWS_NOTHING(e.generateHistogram(-0.0001, X, Y, E));
 
-    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 10, 1e-8);
+    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 96, 1e-8);
   }
 
   void run_generateHistogramUnsortedTest(EventList e, std::vector<double> rebinParams,
@@ -9,9 +9,23 @@
 #include "MantidKernel/Timer.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidHistogramData/LinearGenerator.h"
 
 using namespace Mantid::DataObjects;
+using namespace Mantid::HistogramData;
+using Mantid::Kernel::make_cow;
+
+namespace {
+const size_t NUM_BINS = 10;
+/// Bytes used by the Y and E of one cached histogram
+const size_t ENTRY_MEMORY = 2 * NUM_BINS * sizeof(double);
+
+EventWorkspaceMRU::XType makeX() { return make_cow<HistogramX>(NUM_BINS + 1, LinearGenerator(0., 1.)); }
+EventWorkspaceMRU::YType makeY(const double value) { return make_cow<HistogramY>(NUM_BINS, value); }
+EventWorkspaceMRU::EType makeE(const double value) { return make_cow<HistogramE>(NUM_BINS, value); }
+} // namespace
 
 class EventWorkspaceMRUTest : public CxxTest::TestSuite {
 public:
@@ -20,4 +34,103 @@ public:
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
   }
+
+  void test_find_returns_what_was_inserted() {
+    EventWorkspaceMRU mru(100 * ENTRY_MEMORY);
+    const EventList spectrum;
+    const auto x = makeX();
+    mru.insert(&spectrum, x, 3, makeY(2.), makeE(1.));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), ENTRY_MEMORY);
+    TS_ASSERT_EQUALS((*mru.findY(&spectrum, x, 3))[0], 2.);
+    TS_ASSERT_EQUALS((*mru.findE(&spectrum, x, 3))[0], 1.);
+
+    // Inserting again replaces the entry
+    mru.insert(&spectrum, x, 4, makeY(5.), makeE(6.));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), ENTRY_MEMORY);
+    TS_ASSERT_EQUALS((*mru.findY(&spectrum, x, 4))[0], 5.);
+
+    mru.deleteIndex(&spectrum);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), 0);
+  }
+
+  void test_out_of_date_entries_are_not_found() {
+    EventWorkspaceMRU mru(100 * ENTRY_MEMORY);
+    const EventList spectrum;
+    const auto x = makeX();
+    mru.insert(&spectrum, x, 3, makeY(2.), makeE(1.));
+    // The events changed
+    TS_ASSERT(!mru.findY(&spectrum, x, 4));
+    TS_ASSERT(!mru.findE(&spectrum, x, 4));
+    // The bins changed
+    TS_ASSERT(!mru.findY(&spectrum, make_cow<HistogramX>(NUM_BINS + 1, LinearGenerator(0., 2.)), 3));
+    // Equal bins held elsewhere can reuse the histogram
+    TS_ASSERT(mru.findY(&spectrum, makeX(), 3));
+  }
+
+  void test_memory_budget_drops_oldest_entries() {
+    EventWorkspaceMRU mru(3 * ENTRY_MEMORY);
+    const std::vector<EventList> spectra(5);
+    const auto x = makeX();
+    for (const auto &spectrum : spectra)
+      mru.insert(&spectrum, x, 0, makeY(1.), makeE(1.));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 3);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), 3 * ENTRY_MEMORY);
+    TS_ASSERT(!mru.findY(&spectra[0], x, 0));
+    TS_ASSERT(!mru.findY(&spectra[1], x, 0));
+    TS_ASSERT(mru.findY(&spectra[4], x, 0));
+
+    mru.setMemoryBudget(ENTRY_MEMORY);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+    TS_ASSERT(mru.findY(&spectra[4], x, 0));
+
+    mru.setMemoryBudget(0);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    mru.insert(&spectra[0], x, 0, makeY(1.), makeE(1.));
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+  }
+
+  void test_memory_budget_drops_least_recently_used_entries() {
+    EventWorkspaceMRU mru(3 * ENTRY_MEMORY);
+    const std::vector<EventList> spectra(4);
+    const auto x = makeX();
+    for (size_t i = 0; i < 3; ++i)
+      mru.insert(&spectra[i], x, 0, makeY(1.), makeE(1.));
+    // Using the oldest entry keeps it in the cache
+    TS_ASSERT(mru.findY(&spectra[0], x, 0));
+    mru.insert(&spectra[3], x, 0, makeY(1.), makeE(1.));
+    TS_ASSERT(mru.findE(&spectra[0], x, 0));
+    TS_ASSERT(!mru.findY(&spectra[1], x, 0));
+    TS_ASSERT(mru.findY(&spectra[2], x, 0));
+    TS_ASSERT(mru.findY(&spectra[3], x, 0));
+  }
+
+  void test_large_budget_is_shared_between_stripes() {
+    const size_t budget = 256 * 1024 * 1024;
+    EventWorkspaceMRU mru(budget);
+    const std::vector<EventList> spectra(1000);
+    const auto x = makeX();
+    for (const auto &spectrum : spectra)
+      mru.insert(&spectrum, x, 0, makeY(1.), makeE(1.));
+    TS_ASSERT_EQUALS(mru.MRUSize(), spectra.size());
+    TS_ASSERT_EQUALS(mru.getMemorySize(), spectra.size() * ENTRY_MEMORY);
+    TS_ASSERT_EQUALS(mru.getMemoryBudget(), budget);
+    for (const auto &spectrum : spectra)
+      TS_ASSERT(mru.findY(&spectrum, x, 0));
+
+    mru.clear();
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), 0);
+  }
+
+  void test_clear() {
+    EventWorkspaceMRU mru(100 * ENTRY_MEMORY);
+    const EventList spectrum;
+    mru.insert(&spectrum, makeX(), 0, makeY(1.), makeE(1.));
+    mru.clear();
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.getMemorySize(), 0);
+  }
 };
@@ -27,6 +27,7 @@
 #include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidHistogramData/LinearGenerator.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/Timer.h"
 #include "PropertyManagerHelper.h"
@@ -352,7 +353,7 @@ public:
   }
 
   void test_histogram_cache() {
-    // Try caching and most-recently-used MRU list.
+    // Try the histogram cache.
     EventWorkspace_const_sptr ew2 = std::dynamic_pointer_cast<const EventWorkspace>(ew);
 
     // Are the returned arrays the right size?
@@ -379,34 +380,44 @@ public:
     data1 = ew2->dataY(0);
     TS_ASSERT_DELTA(ew2->dataY(0)[1], 2.0, 1e-6);
     TS_ASSERT_DELTA(data1[1], 2.0, 1e-6);
-    // Cache should now be full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    // Every spectrum read is cached while within the memory budget
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 100);
 
     int last = 100;
     // Read more;
     for (int i = last; i < last + 100; i++)
       data1 = ew2->dataY(i);
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 200);
 
-    // Cache should now be full still
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
-
-    // Do it some more
-    last = 200;
-    for (int i = last; i < last + 100; i++)
+    // Reading them again hits the cache
+    for (int i = 0; i < last + 100; i++)
       data1 = ew2->dataY(i);
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 200);
+    TS_ASSERT_LESS_THAN(200 * 2 * (NUMBINS - 1) * sizeof(double) - 1, ew2->getMemorySize());
 
     //----- Now we test that setAllX clears the memory ----
-
-    // Yes, our eventworkspace MRU is full
-    TS_ASSERT_EQUALS(ew->MRUSize(), 50);
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
     ew->setAllX(BinEdges(10, LinearGenerator(0.0, BIN_DELTA)));
 
-    // MRU should have been cleared now
+    // Cache should have been cleared now
     TS_ASSERT_EQUALS(ew->MRUSize(), 0);
     TS_ASSERT_EQUALS(ew2->MRUSize(), 0);
   }
 
+  void test_histogram_cache_is_invalidated_by_changing_events() {
+    const auto &spectrum = ew->getSpectrum(0);
+    const double before = ew->y(0)[1];
+    TS_ASSERT_EQUALS(ew->MRUSize(), 1);
+
+    // Add an event in bin 1 without clearing the cache
+    ew->getSpectrum(0) += TofEvent(1.5 * BIN_DELTA, 0);
+    TS_ASSERT_DELTA(ew->y(0)[1], before + 1.0, 1e-6);
+    TS_ASSERT_DELTA(spectrum.e()[1], std::sqrt(before + 1.0), 1e-6);
+
+    ew->getSpectrum(0).maskTof(0., 2. * BIN_DELTA);
+    TS_ASSERT_DELTA(ew->y(0)[1], 0.0, 1e-6);
+    TS_ASSERT_EQUALS(ew->MRUSize(), 1);
+  }
+
   void test_histogram_cache_dataE() {
     // Try caching and most-recently-used MRU list.
     EventWorkspace_const_sptr ew2 = ew;
@@ -556,27 +567,29 @@ public:
   }
 
   void test_droppingOffMRU() {
-    // Try caching and most-recently-used MRU list.
-    EventWorkspace_const_sptr ew2 = std::dynamic_pointer_cast<const EventWorkspace>(ew);
+    // A 1 MB cache holds the Y and E of 64 spectra of 1024 bins
+    auto &config = ConfigService::Instance();
+    const auto oldBudget = config.getString("EventWorkspace.HistogramCacheSizeMB");
+    config.setString("EventWorkspace.HistogramCacheSizeMB", "1");
+    EventWorkspace_const_sptr ew2 = createEventWorkspace(true, true);
+    config.setString("EventWorkspace.HistogramCacheSizeMB", oldBudget);
 
-    // OK, we grab data0 from the MRU.
     const auto &inSpec = ew2->getSpectrum(0);
     const auto &inSpec300 = ew2->getSpectrum(300);
-
     const MantidVec &data0 = inSpec.readY();
     const MantidVec &e300 = inSpec300.readE();
     TS_ASSERT_EQUALS(data0.size(), NUMBINS - 1);
 
-    // Fill up the MRU to make data0 drop off
-    for (size_t i = 0; i < 200; i++)
+    // Fill up the cache, using spectrum 0 all along
+    for (size_t i = 1; i < 200; i++) {
       MantidVec otherData = ew2->readY(i);
+      TS_ASSERT_EQUALS(&data0, &inSpec.readY());
+    }
 
-    // data0 and e300 are now invalid references!
-    TS_ASSERT_DIFFERS(&data0, &inSpec.readY());
-    TS_ASSERT_DIFFERS(&e300, &inSpec.readE());
-
-    // MRU is full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    // The least recently used spectrum 300 dropped off, spectrum 0 did not
+    TS_ASSERT_DIFFERS(&e300, &inSpec300.readE());
+    TS_ASSERT_EQUALS(&data0, &inSpec.readY());
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 64);
   }
 
   void test_sortAll_TOF() {
@@ -0,0 +1,105 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDBoxSlabIO.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidFrameworkTestHelpers/BoxControllerDummyIO.h"
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <memory>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using MantidTestHelpers::BoxControllerDummyIO;
+
+class MDBoxSlabIOTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDBoxSlabIOTest *createSuite() { return new MDBoxSlabIOTest(); }
+  static void destroySuite(MDBoxSlabIOTest *suite) { delete suite; }
+
+  void setUp() override {
+    // 10x10 boxes with 4 events each, laid out one after the other on file
+    m_root.reset(MDEventsTestHelper::makeMDGridBox<2>());
+    MDEventsTestHelper::feedMDBox<2>(m_root.get(), 1, 20, 0.25, 0.5);
+    m_boxes.clear();
+    m_eventIndex.clear();
+    for (size_t i = 0; i < m_root->getNumChildren(); ++i) {
+      m_boxes.emplace_back(m_root->getChild(i));
+      m_eventIndex.emplace_back(4 * i);
+      m_eventIndex.emplace_back(m_boxes.back()->getNPoints());
+    }
+    m_io = std::make_unique<BoxControllerDummyIO>(m_root->getBoxController());
+    m_io->setDataType(sizeof(coord_t), MDLeanEvent<2>::getTypeName());
+    m_io->openFile("newDummy", "w");
+  }
+
+  void tearDown() override {
+    m_io.reset();
+    auto *bc = m_root->getBoxController();
+    m_root.reset();
+    delete bc;
+  }
+
+  void test_save_then_load_gives_back_the_events() {
+    std::vector<std::vector<MDLeanEvent<2>>> expected;
+    for (auto *box : m_boxes)
+      expected.emplace_back(dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(box)->getConstEvents());
+
+    // Two boxes in each slab
+    MDBoxSlabIO<MDLeanEvent<2>, 2> slabIO(*m_io, 8);
+    TS_ASSERT_THROWS_NOTHING(slabIO.save(m_boxes, m_eventIndex));
+    TS_ASSERT_EQUALS(m_io->getFileLength(), 400);
+
+    for (auto *box : m_boxes)
+      box->clear();
+    TS_ASSERT_THROWS_NOTHING(slabIO.load(m_boxes, m_eventIndex));
+
+    for (size_t i = 0; i < m_boxes.size(); ++i) {
+      const auto &events = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(m_boxes[i])->getConstEvents();
+      TS_ASSERT_EQUALS(events.size(), expected[i].size());
+      for (size_t j = 0; j < events.size(); ++j) {
+        TS_ASSERT_EQUALS(events[j].getSignal(), expected[i][j].getSignal());
+        TS_ASSERT_EQUALS(events[j].getErrorSquared(), expected[i][j].getErrorSquared());
+        TS_ASSERT_EQUALS(events[j].getCenter(0), expected[i][j].getCenter(0));
+        TS_ASSERT_EQUALS(events[j].getCenter(1), expected[i][j].getCenter(1));
+      }
+    }
+  }
+
+  void test_masked_boxes_are_not_saved() {
+    m_boxes.back()->mask();
+    MDBoxSlabIO<MDLeanEvent<2>, 2> slabIO(*m_io);
+    TS_ASSERT_THROWS_NOTHING(slabIO.save(m_boxes, m_eventIndex));
+    TS_ASSERT_EQUALS(m_io->getFileLength(), 396);
+  }
+
+  void test_file_backed_boxes_are_saved_without_the_write_buffer() {
+    auto io = std::make_shared<BoxControllerDummyIO>(m_root->getBoxController());
+    io->setDataType(sizeof(coord_t), MDLeanEvent<2>::getTypeName());
+    m_root->getBoxController()->setFileBacked(io, "fileBackedDummy");
+    for (size_t i = 0; i < m_boxes.size(); ++i)
+      m_boxes[i]->setFileBacked(m_eventIndex[2 * i], m_eventIndex[2 * i + 1], false);
+
+    MDBoxSlabIO<MDLeanEvent<2>, 2> slabIO(*io, 8);
+    TS_ASSERT_THROWS_NOTHING(slabIO.save(m_boxes, m_eventIndex));
+    TS_ASSERT_EQUALS(io->getFileLength(), 400);
+    TS_ASSERT_EQUALS(io->getWriteBufferUsed(), 0);
+    for (const auto *box : m_boxes)
+      TS_ASSERT(!box->getISaveable()->isBusy());
+  }
+
+private:
+  std::unique_ptr<MDGridBox<MDLeanEvent<2>, 2>> m_root;
+  std::vector<API::IMDNode *> m_boxes;
+  std::vector<uint64_t> m_eventIndex;
+  std::unique_ptr<BoxControllerDummyIO> m_io;
+};
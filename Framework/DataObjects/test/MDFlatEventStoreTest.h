@@ -0,0 +1,102 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDFlatEventStore.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidFrameworkTestHelpers/MDEventsTestHelper.h"
+#include "MantidGeometry/MDGeometry/MDBoxImplicitFunction.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <memory>
+
+using namespace Mantid::DataObjects;
+using Mantid::coord_t;
+using Mantid::signal_t;
+using Mantid::Geometry::MDBoxImplicitFunction;
+
+class MDFlatEventStoreTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDFlatEventStoreTest *createSuite() { return new MDFlatEventStoreTest(); }
+  static void destroySuite(MDFlatEventStoreTest *suite) { delete suite; }
+
+  void setUp() override {
+    // 10x10 boxes of 1x1, the first split again into 10x10, with 4 events in
+    // each of the 1x1 boxes
+    m_root.reset(MDEventsTestHelper::makeMDGridBox<2>());
+    m_root->splitContents(0);
+    MDEventsTestHelper::feedMDBox<2>(m_root.get(), 1, 20, 0.25, 0.5);
+  }
+
+  void tearDown() override {
+    auto *bc = m_root->getBoxController();
+    m_root.reset();
+    delete bc;
+  }
+
+  void test_box_table_is_in_depth_first_order() {
+    MDFlatEventStore<MDLeanEvent<2>, 2> store(*m_root);
+    TS_ASSERT_EQUALS(store.getNumBoxes(), 1 + 100 + 100);
+    TS_ASSERT_EQUALS(store.getNPoints(), 400);
+    TS_ASSERT_EQUALS(store.getSubtreeEnd(0), 201);
+    TS_ASSERT_EQUALS(store.getNPoints(0), 400);
+
+    // The split box and the boxes under it come straight after the root
+    TS_ASSERT(!store.isLeaf(1));
+    TS_ASSERT_EQUALS(store.getSubtreeEnd(1), 102);
+    TS_ASSERT_EQUALS(store.getNPoints(1), 4);
+    TS_ASSERT_EQUALS(store.eventsBegin(2), store.eventsBegin(1));
+    TS_ASSERT_EQUALS(store.eventsEnd(101), store.eventsEnd(1));
+    TS_ASSERT(store.isLeaf(102));
+    TS_ASSERT_EQUALS(store.getNPoints(102), 4);
+  }
+
+  void test_events_are_in_their_boxes() {
+    MDFlatEventStore<MDLeanEvent<2>, 2> store(*m_root);
+    for (size_t box = 0; box < store.getNumBoxes(); ++box) {
+      signal_t signal = 0.;
+      for (auto event = store.eventsBegin(box); event != store.eventsEnd(box); ++event) {
+        signal += event->getSignal();
+        for (size_t d = 0; d < 2; ++d) {
+          TS_ASSERT_LESS_THAN_EQUALS(store.getMin(box, d), event->getCenter(d));
+          TS_ASSERT_LESS_THAN_EQUALS(event->getCenter(d), store.getMax(box, d));
+        }
+      }
+      TS_ASSERT_DELTA(signal, store.getSignal(box), 1e-6);
+    }
+  }
+
+  void test_getLeaves() {
+    MDFlatEventStore<MDLeanEvent<2>, 2> store(*m_root);
+    std::vector<size_t> leaves;
+    store.getLeaves(leaves, nullptr);
+    TS_ASSERT_EQUALS(leaves.size(), 100 + 99);
+
+    leaves.clear();
+    std::vector<coord_t> min{5.1f, 5.1f};
+    std::vector<coord_t> max{5.9f, 5.9f};
+    MDBoxImplicitFunction function(min, max);
+    store.getLeaves(leaves, &function);
+    TS_ASSERT_EQUALS(leaves.size(), 1);
+    TS_ASSERT_EQUALS(store.getMin(leaves[0], 0), 5.f);
+    TS_ASSERT_EQUALS(store.getMin(leaves[0], 1), 5.f);
+    TS_ASSERT_EQUALS(store.getNPoints(leaves[0]), 4);
+  }
+
+  void test_vertexes() {
+    MDFlatEventStore<MDLeanEvent<2>, 2> store(*m_root);
+    std::vector<coord_t> vertexes;
+    TS_ASSERT_EQUALS(store.getVertexes(0, vertexes), 4);
+    TS_ASSERT_EQUALS(vertexes, std::vector<coord_t>({0.f, 0.f, 10.f, 0.f, 0.f, 10.f, 10.f, 10.f}));
+  }
+
+private:
+  std::unique_ptr<MDGridBox<MDLeanEvent<2>, 2>> m_root;
+};
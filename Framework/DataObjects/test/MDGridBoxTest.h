@@ -21,11 +21,13 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MantidNexus/NexusFile.h"
 #include <Poco/File.h>
+#include <algorithm>
 #include <cmath>
 #include <cxxtest/TestSuite.h>
 #include <gmock/gmock.h>
@@ -555,6 +557,90 @@ public:
     delete bcc;
   }
 
+  //-------------------------------------------------------------------------------------
+  /** Getting the boxes that describe a tree to a level of detail */
+  void test_getBoxesAtLevelOfDetail() {
+    MDGridBox<MDLeanEvent<1>, 1> *parent = MDEventsTestHelper::makeRecursiveMDGridBox<1>(3, 3);
+    using box_t = MDBoxBase<MDLeanEvent<1>, 1>;
+    std::vector<box_t *> leaves;
+    std::vector<const box_t *> taken;
+    auto takeAtDepth = [&taken](const size_t depth) {
+      return [&taken, depth](const box_t &box) {
+        if (box.getDepth() < depth)
+          return false;
+        taken.emplace_back(&box);
+        return true;
+      };
+    };
+
+    // Never taken whole = only the leaves
+    parent->getBoxesAtLevelOfDetail(leaves, [](const box_t &) { return false; });
+    TS_ASSERT_EQUALS(leaves.size(), 27);
+    TS_ASSERT_EQUALS(leaves[0]->getDepth(), 3);
+
+    // The boxes under a box taken are not visited
+    leaves.clear();
+    parent->getBoxesAtLevelOfDetail(leaves, takeAtDepth(2));
+    TS_ASSERT(leaves.empty());
+    TS_ASSERT_EQUALS(taken.size(), 9);
+    TS_ASSERT_EQUALS(taken[0]->getDepth(), 2);
+
+    // Only the boxes touching the function
+    std::vector<coord_t> min{1.2f};
+    std::vector<coord_t> max{1.8f};
+    MDBoxImplicitFunction function(min, max);
+    taken.clear();
+    parent->getBoxesAtLevelOfDetail(leaves, takeAtDepth(1), &function);
+    TS_ASSERT(leaves.empty());
+    TS_ASSERT_EQUALS(taken.size(), 1);
+    TS_ASSERT_EQUALS(taken[0]->getDepth(), 1);
+
+    // A box with a masked box within is never taken whole, nor the masked leaf
+    auto *maskedParent = const_cast<box_t *>(taken[0]);
+    maskedParent->getChild(0)->getChild(0)->mask();
+    taken.clear();
+    parent->getBoxesAtLevelOfDetail(leaves, takeAtDepth(2));
+    TS_ASSERT_EQUALS(taken.size(), 8 + 2);
+    TS_ASSERT_EQUALS(leaves.size(), 1);
+    TS_ASSERT(leaves[0]->getIsMasked());
+
+    // The masked boxes, found once, can be passed in
+    std::vector<bool> maskedBoxes;
+    TS_ASSERT(parent->findMaskedBoxes(maskedBoxes));
+    TS_ASSERT(maskedBoxes[maskedParent->getID()]);
+    TS_ASSERT(maskedBoxes[maskedParent->getChild(0)->getID()]);
+    TS_ASSERT(!maskedBoxes[maskedParent->getChild(1)->getID()]);
+    TS_ASSERT_EQUALS(std::count(maskedBoxes.cbegin(), maskedBoxes.cend(), true), 4);
+    leaves.clear();
+    taken.clear();
+    parent->getBoxesAtLevelOfDetail(leaves, takeAtDepth(2), nullptr, &maskedBoxes);
+    TS_ASSERT_EQUALS(taken.size(), 8 + 2);
+    TS_ASSERT_EQUALS(leaves.size(), 1);
+
+    BoxController *const bcc = parent->getBoxController();
+    delete parent;
+    delete bcc;
+  }
+
+  /** The centroid of a grid box is the signal-weighted one of its boxes */
+  void test_getCentroid_after_refreshCache() {
+    MDGridBox<MDLeanEvent<2>, 2> *superbox = MDEventsTestHelper::makeMDGridBox<2>();
+    // One event in the middle of each box, and an extra 3 in the last one
+    MDEventsTestHelper::feedMDBox<2>(superbox, 1, 10, 0.5, 1.0);
+    coord_t centers[2] = {9.5f, 9.5f};
+    for (size_t i = 0; i < 3; i++)
+      superbox->addEvent(MDLeanEvent<2>(1.0, 1.0, centers));
+    superbox->refreshCache();
+
+    const coord_t *centroid = superbox->getCentroid();
+    TS_ASSERT_DELTA(centroid[0], (100 * 5.0 + 3 * 9.5) / 103., 1e-4);
+    TS_ASSERT_DELTA(centroid[1], (100 * 5.0 + 3 * 9.5) / 103., 1e-4);
+
+    BoxController *const bcc = superbox->getBoxController();
+    delete superbox;
+    delete bcc;
+  }
+
   //-------------------------------------------------------------------------------------
   /** Recursive getting of a list of MDBoxBase, with an implicit function
    * limiting it */
@@ -1064,6 +1150,46 @@ public:
     delete bcc;
   }
 
+  void test_splitAllIfNeeded_usingWorkStealing() {
+    using gbox_t = MDGridBox<MDLeanEvent<2>, 2>;
+    gbox_t *b = MDEventsTestHelper::makeMDGridBox<2>();
+    b->getBoxController()->setSplitThreshold(100);
+    b->getBoxController()->setMaxDepth(4);
+    // Most of the events in one box, as around a Bragg peak
+    MDEventsTestHelper::feedMDBox<2>(b, 200, 10, 0.5, 1.0);
+    MDEventsTestHelper::feedMDBox<2>(b, 5000, 1, 5.5, 1.0);
+
+    auto *ts = new ThreadSchedulerWorkStealing();
+    ThreadPool tp(ts);
+    b->splitAllIfNeeded(ts);
+    tp.joinAll();
+    b->refreshCache();
+
+    TS_ASSERT_EQUALS(b->getNPoints(), 100 * 200 + 5000);
+    const auto boxes = b->getBoxes();
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      TS_ASSERT(dynamic_cast<gbox_t *>(boxes[i]));
+      TS_ASSERT_EQUALS(boxes[i]->getNPoints(), i == 55 ? 5200 : 200);
+    }
+
+    BoxController *const bcc = b->getBoxController();
+    delete b;
+    delete bcc;
+  }
+
+  void test_split_keeps_events_on_the_upper_edge() {
+    auto *b = MDEventsTestHelper::makeMDBox1(10);
+    for (const coord_t x : {0.5f, 9.5f, 10.0f})
+      b->addEvent(MDLeanEvent<1>(1.0, 1.0, &x));
+    auto *g = new MDGridBox<MDLeanEvent<1>, 1>(b);
+    TS_ASSERT_EQUALS(g->getChild(0)->getNPoints(), 1);
+    TS_ASSERT_EQUALS(g->getChild(9)->getNPoints(), 2);
+    BoxController *const bcc = b->getBoxController();
+    delete b;
+    delete bcc;
+    delete g;
+  }
+
   //------------------------------------------------------------------------------------------------
   /** Helper to make a 2D MDBin */
   MDBin<MDLeanEvent<2>, 2> makeMDBin2(double minX, double maxX, double minY, double maxY) {
@@ -0,0 +1,129 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/PackedEvents.h"
+#include <cxxtest/TestSuite.h>
+
+#include <stdexcept>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Core::DateAndTime;
+using Mantid::Types::Event::TofEvent;
+
+using std::vector;
+
+class PackedEventsTest : public CxxTest::TestSuite {
+private:
+  vector<TofEvent> makeTofEvents() {
+    vector<TofEvent> events;
+    events.emplace_back(3.5, DateAndTime(400));
+    events.emplace_back(3.5, DateAndTime(10));
+    events.emplace_back(50., DateAndTime(1000000000));
+    events.emplace_back(100., DateAndTime(400));
+    return events;
+  }
+
+public:
+  void test_round_trip_TofEvent() {
+    const auto events = makeTofEvents();
+    const PackedEvents packed(events);
+    TS_ASSERT_EQUALS(packed.getEventType(), TOF);
+    TS_ASSERT_EQUALS(packed.size(), 4);
+    TS_ASSERT(!packed.hasWeights());
+    TS_ASSERT_EQUALS(*packed.pulseTable(), vector<int64_t>({10, 400, 1000000000}));
+
+    vector<TofEvent> out(1);
+    packed.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+    vector<WeightedEventNoTime> noTime;
+    packed.copyInto(noTime);
+    TS_ASSERT_EQUALS(noTime.size(), 4);
+    TS_ASSERT_EQUALS(noTime[2].tof(), 50.);
+    TS_ASSERT_EQUALS(noTime[2].weight(), 1.);
+  }
+
+  void test_round_trip_WeightedEvent() {
+    vector<WeightedEvent> events;
+    events.emplace_back(3.5, DateAndTime(400), 2.0, 3.0);
+    events.emplace_back(100., DateAndTime(200), 4.0, 5.0);
+    const PackedEvents packed(events);
+    TS_ASSERT_EQUALS(packed.getEventType(), WEIGHTED);
+    TS_ASSERT(packed.hasWeights());
+
+    vector<WeightedEvent> out;
+    packed.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+    vector<TofEvent> unweighted;
+    TS_ASSERT_THROWS(packed.copyInto(unweighted), const std::runtime_error &);
+  }
+
+  void test_round_trip_WeightedEventNoTime() {
+    vector<WeightedEventNoTime> events;
+    events.emplace_back(-1.5, 2.0, 3.0);
+    events.emplace_back(0.0, 1.0, 1.0);
+    events.emplace_back(7.25, 4.0, 5.0);
+    const PackedEvents packed(events);
+    TS_ASSERT_EQUALS(packed.getEventType(), WEIGHTED_NOTIME);
+    TS_ASSERT(!packed.pulseTable());
+
+    vector<WeightedEventNoTime> out;
+    packed.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+    vector<WeightedEvent> withTimes;
+    TS_ASSERT_THROWS(packed.copyInto(withTimes), const std::runtime_error &);
+  }
+
+  void test_tofs_that_are_not_floats_are_kept_exactly() {
+    vector<TofEvent> events;
+    events.emplace_back(0.1, DateAndTime(0));
+    events.emplace_back(1.0 / 3.0, DateAndTime(0));
+    events.emplace_back(1e300, DateAndTime(0));
+    const PackedEvents packed(events);
+
+    vector<TofEvent> out;
+    packed.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+  }
+
+  void test_forEach_visits_in_order_and_stops() {
+    const PackedEvents packed(makeTofEvents());
+    vector<double> tofs;
+    packed.forEach([&tofs](const double tof, const double weight, const double errorSquared) {
+      TS_ASSERT_EQUALS(weight, 1.0);
+      TS_ASSERT_EQUALS(errorSquared, 1.0);
+      tofs.emplace_back(tof);
+      return tofs.size() < 3;
+    });
+    TS_ASSERT_EQUALS(tofs, vector<double>({3.5, 3.5, 50.}));
+  }
+
+  void test_shared_pulse_table() {
+    const auto table = PackedEvents::makePulseTable({1000000000, 10, 400, 10, 5});
+    TS_ASSERT_EQUALS(*table, vector<int64_t>({5, 10, 400, 1000000000}));
+
+    const auto events = makeTofEvents();
+    const PackedEvents packed(events, table);
+    TS_ASSERT_EQUALS(packed.pulseTable(), table);
+    vector<TofEvent> out;
+    packed.copyInto(out);
+    TS_ASSERT_EQUALS(out, events);
+
+    const auto tooSmall = PackedEvents::makePulseTable({10, 400});
+    TS_ASSERT_THROWS(PackedEvents(events, tooSmall), const std::invalid_argument &);
+  }
+
+  void test_sorted_events_take_less_memory() {
+    vector<TofEvent> events;
+    for (int i = 0; i < 10000; ++i)
+      events.emplace_back(1000. + 0.25 * i, DateAndTime(int64_t(i % 100) * 16666667));
+    const PackedEvents packed(events);
+    TS_ASSERT_LESS_THAN(packed.getMemorySize(), events.size() * sizeof(TofEvent) / 3);
+  }
+};
@@ -0,0 +1,118 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/**
+ * BinEdgeSearch finds the bin that a value falls in for a fixed set of bin
+ * edges. It is intended for histogramming many unsorted events into the same
+ * bins, where calling std::upper_bound per event is the dominant cost.
+ *
+ * On construction the edges are inspected once:
+ *   - linear edges (as made by rebin parameters with a positive step) are
+ *     found with a closed-form index,
+ *   - logarithmic edges (negative step) with a closed-form index on log(x),
+ *   - anything else with a branchless binary search.
+ * The closed-form estimate is always checked against the neighbouring edges,
+ * so the returned bin is exact even if the final bin is narrower than the rest.
+ *
+ * The object does not copy the edges: they must outlive it and not change.
+ */
+class MANTID_KERNEL_DLL BinEdgeSearch {
+public:
+  /// How the bin index is computed
+  enum class Mode { Linear, Logarithmic, Arbitrary };
+
+  BinEdgeSearch(const std::vector<double> &edges);
+
+  /// The strategy chosen for these edges
+  Mode mode() const { return m_mode; }
+  /// Number of bins, one fewer than the number of edges
+  size_t numberOfBins() const { return m_numberOfBins; }
+
+  /** Find the bin containing x, with the usual convention that a bin includes
+   * its lower edge but not its upper edge.
+   * @param x :: the value to look up
+   * @return the bin index, or nothing if x is outside the edges or NaN
+   */
+  std::optional<size_t> find(const double x) const {
+    if (!(x >= m_min && x < m_max))
+      return std::nullopt;
+    return findInRange(x);
+  }
+
+  /** Find the bin containing x without checking it against the outer edges.
+   * @param x :: the value to look up; must satisfy front <= x < back
+   * @return the bin index
+   */
+  size_t findInRange(const double x) const {
+    switch (m_mode) {
+    case Mode::Linear:
+      return refine(x, estimate((x - m_offset) * m_scale));
+    case Mode::Logarithmic:
+      return refine(x, estimate((std::log(x) - m_offset) * m_scale));
+    default:
+      return search(x);
+    }
+  }
+
+private:
+  /// Convert a fractional bin position to a bin index in range
+  size_t estimate(const double position) const {
+    return std::min(static_cast<size_t>(position), m_numberOfBins - 1);
+  }
+
+  /// Move an estimated bin to the one actually containing x
+  size_t refine(const double x, size_t bin) const {
+    while (x < m_edges[bin])
+      --bin;
+    while (x >= m_edges[bin + 1])
+      ++bin;
+    return bin;
+  }
+
+  /// Branchless binary search for the last edge <= x. The loop trip count only
+  /// depends on the number of edges so the compiler emits conditional moves.
+  size_t search(const double x) const {
+    const double *base = m_edges;
+    size_t n = m_numberOfBins + 1;
+    while (n > 1) {
+      const size_t half = n / 2;
+      base = (base[half] <= x) ? base + half : base;
+      n -= half;
+    }
+    return static_cast<size_t>(base - m_edges);
+  }
+
+  /// The bin edges
+  const double *m_edges;
+  /// Number of bins
+  size_t m_numberOfBins;
+  /// Lowest edge
+  double m_min;
+  /// Highest edge
+  double m_max;
+  /// Strategy used to find the bin
+  Mode m_mode;
+  /// Value subtracted before scaling: the first edge, or its log
+  double m_offset;
+  /// Inverse of the (log) bin width
+  double m_scale;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,72 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Mantid {
+namespace Kernel {
+
+/** MappedFileArena hands out memory backed by scratch files rather than by
+ * swap, so that data larger than RAM can be held with the operating system
+ * paging it to and from disk as it is used.
+ *
+ * Memory is taken from segments, each a file in the scratch directory mapped
+ * shared into the address space. The files are deleted as soon as they are
+ * mapped (or marked delete-on-close on Windows) so nothing is left behind if
+ * the process dies. Blocks within a segment are allocated best-fit and freed
+ * blocks are merged with their neighbours. A segment is unmapped once nothing
+ * in it is allocated, apart from the first which is kept for reuse.
+ *
+ * All methods are thread-safe.
+ */
+class MANTID_KERNEL_DLL MappedFileArena {
+public:
+  /// Default size of each file mapped
+  static constexpr size_t DEFAULT_SEGMENT_SIZE = size_t(1) << 30;
+  /// All blocks are aligned to, and a multiple of, this many bytes
+  static constexpr size_t ALIGNMENT = 64;
+
+  MappedFileArena(std::string directory, const size_t segmentSize = DEFAULT_SEGMENT_SIZE);
+  ~MappedFileArena();
+  MappedFileArena(const MappedFileArena &) = delete;
+  MappedFileArena &operator=(const MappedFileArena &) = delete;
+
+  void *allocate(const size_t bytes);
+  void deallocate(void *pointer, const size_t bytes);
+
+  /// Directory the scratch files are created in
+  const std::string &directory() const { return m_directory; }
+  size_t getMappedSize() const;
+  size_t getAllocatedSize() const;
+
+private:
+  class Segment;
+
+  static size_t roundUp(const size_t bytes);
+  void *allocateFromSegment(Segment &segment, const size_t bytes);
+
+  /// Directory the scratch files are created in
+  const std::string m_directory;
+  /// Size of each file mapped, unless an allocation needs a larger one
+  const size_t m_segmentSize;
+  /// The mapped segments, by the address they start at
+  std::map<const char *, std::unique_ptr<Segment>> m_segments;
+  /// Bytes currently allocated
+  size_t m_allocatedSize;
+  /// Protects the members above
+  mutable std::mutex m_mutex;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -6,12 +6,20 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidKernel/DllConfig.h"
+
 #include <atomic>
 #include <mutex>
 
 namespace Mantid {
 namespace Kernel {
 
+/** Whether the calling thread is running tasks for a ThreadPool. The pool
+ * already has a thread on each core, so a ThreadPool started from one of its
+ * tasks defaults to a single thread.
+ */
+MANTID_KERNEL_DLL bool isThreadPoolWorker();
+
 /** Thread-safety check
  * Checks the workspace to ensure it is suitable for multithreaded access.
  * NULL workspaces are assumed suitable
@@ -193,6 +201,9 @@ template <typename T, typename BinaryOp> void AtomicOp(std::atomic<T> &f, T d, B
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
+/// Whether the calling code is inside an active parallel region
+#define PARALLEL_IN_PARALLEL_REGION omp_in_parallel()
+
 #define PARALLEL PRAGMA(omp parallel)
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
@@ -224,6 +235,7 @@ inline void setMaxCoresToConfig() {
 #define PARALLEL_CRITICAL(name)
 #define PARALLEL_ATOMIC
 #define PARALLEL_THREAD_NUMBER 0
+#define PARALLEL_IN_PARALLEL_REGION false
 #define PARALLEL_SET_NUM_THREADS(MaxCores)
 #define PARALLEL_SET_DYNAMIC(val)
 #define PARALLEL_NUMBER_OF_THREADS 1
@@ -26,7 +26,12 @@ public:
   ThreadPoolRunnable(size_t threadnum, ThreadScheduler *scheduler, ProgressBase *prog = nullptr, double waitSec = 0.0);
 
   /// Return the thread number of this thread.
-  size_t threadnum() { return m_threadnum; }
+  size_t threadnum() const { return m_threadnum; }
+
+  /// Return the scheduler the tasks are taken from.
+  ThreadScheduler *scheduler() const { return m_scheduler; }
+
+  static const ThreadPoolRunnable *current();
 
   void run() override;
 
@@ -9,6 +9,7 @@
 #include "MantidKernel/DllConfig.h"
 #include "MantidKernel/SingletonHolder.h"
 #include "MantidKernel/Task.h"
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
@@ -101,6 +102,17 @@ public:
   /// Returns true if the execution was aborted.
   bool getAborted() { return m_aborted; }
 
+  //-------------------------------------------------------------------------------
+  /** Signal that work held outside the queue will be pushed to it later, so the
+   * threads of a ThreadPool must keep waiting for tasks while the queue is
+   * empty. Each call must be matched by a call to removePendingWork().
+   */
+  void addPendingWork() { ++m_pendingWork; }
+  /// Signal that work announced by addPendingWork() has been pushed or dropped
+  void removePendingWork() { --m_pendingWork; }
+  /// Returns true if work held outside the queue is still to be pushed to it
+  bool hasPendingWork() const { return m_pendingWork > 0; }
+
 protected:
   /// Total cost of all tasks
   double m_cost;
@@ -112,6 +124,8 @@ protected:
   std::runtime_error m_abortException;
   /// The run was aborted due to an exception
   bool m_aborted;
+  /// Number of calls to addPendingWork() not yet matched by removePendingWork()
+  std::atomic<size_t> m_pendingWork{0};
 };
 
 //===========================================================================
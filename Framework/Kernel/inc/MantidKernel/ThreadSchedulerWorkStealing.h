@@ -0,0 +1,78 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : a scheduler suited to tasks that schedule
+ * further tasks, such as recursive splitting.
+ *
+ * Each thread of the pool has its own queue. A task pushed from inside a
+ * running task goes on the queue of the thread running it, and a thread takes
+ * the newest task from its own queue, so that work on the same data stays on
+ * the same core. A thread whose queue is empty takes the oldest task from the
+ * queue of tasks pushed from outside the pool, and failing that steals the
+ * oldest task from another thread, so a thread's queue is only contended when
+ * it is stolen from. The tasks pushed from outside are taken costliest first,
+ * and oldest first among equal costs, so that the largest pieces of work are
+ * not left to the end; the costs are otherwise only added up for
+ * totalCost() and totalCostExecuted().
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numThreads = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+
+private:
+  /// One queue and its lock
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<Task>> tasks;
+  };
+
+  /// The tasks pushed from outside the pool, by decreasing cost
+  struct SharedQueue {
+    std::mutex mutex;
+    std::multimap<double, std::shared_ptr<Task>, std::greater<double>> tasks;
+  };
+
+  Queue &queueFor(size_t threadnum);
+  std::shared_ptr<Task> takeNewest(Queue &queue);
+  std::shared_ptr<Task> takeOldest(Queue &queue);
+  std::shared_ptr<Task> takeCostliest(SharedQueue &queue);
+  void added(const double cost);
+  void taken(const double cost);
+
+  /// Tasks pushed from outside the pool
+  SharedQueue m_shared;
+  /// A queue for each thread, by thread number
+  std::vector<Queue> m_threadQueues;
+  /// Number of tasks in all the queues
+  std::atomic<size_t> m_size{0};
+  /// Guards m_cost and m_costExecuted, which are updated under any of the queue locks
+  std::mutex m_costMutex;
+};
+
+} // namespace Kernel
+} // namespace Mantid
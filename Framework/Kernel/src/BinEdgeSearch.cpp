@@ -0,0 +1,70 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/BinEdgeSearch.h"
+
+#include <stdexcept>
+
+namespace Mantid::Kernel {
+
+namespace {
+/// How far an edge may be from its predicted position, as a fraction of the bin
+/// width, for the closed-form index to be used. Anything below one half keeps
+/// the estimate within one bin of the answer.
+constexpr double EDGE_TOLERANCE = 0.01;
+
+/** Check that edges[i] == start + i * width for all but the final edge, which
+ * rebinning may have moved to absorb a short last bin.
+ */
+template <typename Transform>
+bool isUniform(const std::vector<double> &edges, const double start, const double width, Transform transform) {
+  if (!(width > 0.) || !std::isfinite(width))
+    return false;
+  for (size_t i = 2; i + 1 < edges.size(); ++i) {
+    const double predicted = start + static_cast<double>(i) * width;
+    if (std::abs(transform(edges[i]) - predicted) > EDGE_TOLERANCE * width)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+/** Constructor. Inspects the edges to choose how bins will be found.
+ * @param edges :: the bin edges, in increasing order
+ * @throw std::invalid_argument if there are fewer than two edges
+ */
+BinEdgeSearch::BinEdgeSearch(const std::vector<double> &edges)
+    : m_edges(edges.data()), m_numberOfBins(edges.size() > 1 ? edges.size() - 1 : 0), m_min(0.), m_max(0.),
+      m_mode(Mode::Arbitrary), m_offset(0.), m_scale(0.) {
+  if (m_numberOfBins == 0)
+    throw std::invalid_argument("BinEdgeSearch: at least two bin edges are required");
+  m_min = edges.front();
+  m_max = edges.back();
+
+  // A single bin is found by the range check alone
+  if (m_numberOfBins < 3)
+    return;
+
+  const double width = edges[1] - edges[0];
+  if (isUniform(edges, edges[0], width, [](const double x) { return x; })) {
+    m_mode = Mode::Linear;
+    m_offset = edges[0];
+    m_scale = 1. / width;
+    return;
+  }
+
+  if (edges[0] > 0.) {
+    const double logStart = std::log(edges[0]);
+    const double logWidth = std::log(edges[1]) - logStart;
+    if (isUniform(edges, logStart, logWidth, [](const double x) { return std::log(x); })) {
+      m_mode = Mode::Logarithmic;
+      m_offset = logStart;
+      m_scale = 1. / logWidth;
+    }
+  }
+}
+
+} // namespace Mantid::Kernel
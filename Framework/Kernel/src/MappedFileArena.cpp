@@ -0,0 +1,268 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/MappedFileArena.h"
+#include "MantidKernel/Logger.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Mantid::Kernel {
+namespace {
+/// static logger object
+Logger g_log("MappedFileArena");
+
+#ifndef _WIN32
+/// @return a description of the last error from a system call
+std::string lastError() { return std::strerror(errno); }
+#endif
+} // namespace
+
+/** One scratch file mapped into memory and the record of which parts of it are
+ * free.
+ */
+class MappedFileArena::Segment {
+public:
+  Segment(const std::string &directory, const size_t size) : m_size(size) {
+#ifdef _WIN32
+    char filename[MAX_PATH];
+    if (GetTempFileNameA(directory.c_str(), "mtd", 0, filename) == 0)
+      throw std::runtime_error("Cannot create a scratch file in " + directory);
+    m_file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                         FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+      throw std::runtime_error(std::string("Cannot open scratch file ") + filename);
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READWRITE, static_cast<DWORD>(uint64_t(size) >> 32),
+                                   static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+    if (!m_mapping) {
+      CloseHandle(m_file);
+      throw std::runtime_error(std::string("Cannot map scratch file ") + filename);
+    }
+    m_base = static_cast<char *>(MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size));
+    if (!m_base) {
+      CloseHandle(m_mapping);
+      CloseHandle(m_file);
+      throw std::runtime_error(std::string("Cannot map scratch file ") + filename);
+    }
+#else
+    const auto pattern = (std::filesystem::path(directory) / "mantid-scratch-XXXXXX").string();
+    std::vector<char> filename(pattern.begin(), pattern.end());
+    filename.emplace_back('\0');
+    const int fd = mkstemp(filename.data());
+    if (fd == -1)
+      throw std::runtime_error("Cannot create a scratch file in " + directory + ": " + lastError());
+    // Nobody else needs the name, and this way the file cannot outlive us
+    unlink(filename.data());
+#ifdef __linux__
+    // Reserve the blocks now so a full disk is reported here, not as a SIGBUS
+    const int error = posix_fallocate(fd, 0, static_cast<off_t>(size));
+    const bool sized = error == 0 || ((error == EOPNOTSUPP || error == EINVAL) && ftruncate(fd, size) == 0);
+#else
+    const bool sized = ftruncate(fd, static_cast<off_t>(size)) == 0;
+#endif
+    if (!sized) {
+      close(fd);
+      throw std::runtime_error("Cannot size a scratch file in " + directory);
+    }
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps the file alive
+    close(fd);
+    if (base == MAP_FAILED)
+      throw std::runtime_error("Cannot map a scratch file in " + directory + ": " + lastError());
+    m_base = static_cast<char *>(base);
+#endif
+    addFreeBlock(0, size);
+  }
+
+  ~Segment() {
+#ifdef _WIN32
+    UnmapViewOfFile(m_base);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+#else
+    munmap(m_base, m_size);
+#endif
+  }
+
+  Segment(const Segment &) = delete;
+  Segment &operator=(const Segment &) = delete;
+
+  /// First byte of the mapping
+  char *base() const { return m_base; }
+  /// Size of the mapping in bytes
+  size_t size() const { return m_size; }
+  /// Whether nothing in the segment is allocated
+  bool empty() const { return m_freeByOffset.size() == 1 && m_freeByOffset.begin()->second == m_size; }
+
+  /** Take the smallest free block that fits
+   * @param bytes :: the size, already rounded up by the arena
+   * @return the block, or nullptr if none is large enough
+   */
+  char *take(const size_t bytes) {
+    const auto fit = m_freeBySize.lower_bound(bytes);
+    if (fit == m_freeBySize.end())
+      return nullptr;
+    const size_t length = fit->first;
+    const size_t offset = fit->second;
+    m_freeBySize.erase(fit);
+    m_freeByOffset.erase(offset);
+    if (length > bytes)
+      addFreeBlock(offset + bytes, length - bytes);
+    return m_base + offset;
+  }
+
+  /** Return a block, merging it with any free neighbours
+   * @param pointer :: the block, from take()
+   * @param bytes :: its size, as passed to take()
+   */
+  void give(const char *pointer, size_t bytes) {
+    auto offset = static_cast<size_t>(pointer - m_base);
+    const auto next = m_freeByOffset.find(offset + bytes);
+    if (next != m_freeByOffset.end()) {
+      bytes += next->second;
+      removeFreeBlock(next);
+    }
+    const auto after = m_freeByOffset.lower_bound(offset);
+    if (after != m_freeByOffset.begin()) {
+      const auto previous = std::prev(after);
+      if (previous->first + previous->second == offset) {
+        offset = previous->first;
+        bytes += previous->second;
+        removeFreeBlock(previous);
+      }
+    }
+    addFreeBlock(offset, bytes);
+  }
+
+private:
+  void addFreeBlock(const size_t offset, const size_t length) {
+    m_freeByOffset.emplace(offset, length);
+    m_freeBySize.emplace(length, offset);
+  }
+
+  void removeFreeBlock(std::map<size_t, size_t>::iterator block) {
+    auto [first, last] = m_freeBySize.equal_range(block->second);
+    for (; first != last; ++first) {
+      if (first->second == block->first) {
+        m_freeBySize.erase(first);
+        break;
+      }
+    }
+    m_freeByOffset.erase(block);
+  }
+
+  char *m_base{nullptr};
+  const size_t m_size;
+#ifdef _WIN32
+  HANDLE m_file{INVALID_HANDLE_VALUE};
+  HANDLE m_mapping{nullptr};
+#endif
+  /// Free blocks: offset to length
+  std::map<size_t, size_t> m_freeByOffset;
+  /// Free blocks: length to offset
+  std::multimap<size_t, size_t> m_freeBySize;
+};
+
+/** Constructor. No file is created until the first allocation.
+ * @param directory :: where to create the scratch files
+ * @param segmentSize :: bytes to map at a time
+ */
+MappedFileArena::MappedFileArena(std::string directory, const size_t segmentSize)
+    : m_directory(std::move(directory)), m_segmentSize(roundUp(std::max<size_t>(segmentSize, 1))),
+      m_allocatedSize(0) {}
+
+MappedFileArena::~MappedFileArena() = default;
+
+/// @return bytes rounded up to a whole number of ALIGNMENT
+size_t MappedFileArena::roundUp(const size_t bytes) { return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+/** Allocate a block of file-backed memory, mapping another segment if none
+ * has room.
+ * @param bytes :: size of the block
+ * @return the block, aligned to ALIGNMENT
+ * @throws std::bad_alloc if no scratch file could be mapped
+ */
+void *MappedFileArena::allocate(const size_t bytes) {
+  const size_t size = roundUp(std::max<size_t>(bytes, 1));
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto &segment : m_segments) {
+    if (auto pointer = allocateFromSegment(*segment.second, size))
+      return pointer;
+  }
+  std::unique_ptr<Segment> segment;
+  try {
+    segment = std::make_unique<Segment>(m_directory, std::max(size, m_segmentSize));
+  } catch (std::runtime_error &e) {
+    g_log.error() << e.what() << '\n';
+    throw std::bad_alloc();
+  }
+  auto &added = *m_segments.emplace(segment->base(), std::move(segment)).first->second;
+  return allocateFromSegment(added, size);
+}
+
+/// Allocate from one segment and count the bytes. The caller holds the lock.
+void *MappedFileArena::allocateFromSegment(Segment &segment, const size_t bytes) {
+  auto pointer = segment.take(bytes);
+  if (pointer)
+    m_allocatedSize += bytes;
+  return pointer;
+}
+
+/** Return a block to the arena
+ * @param pointer :: the block, from allocate()
+ * @param bytes :: the size it was allocated with
+ */
+void MappedFileArena::deallocate(void *pointer, const size_t bytes) {
+  if (!pointer)
+    return;
+  const size_t size = roundUp(std::max<size_t>(bytes, 1));
+  const auto address = static_cast<const char *>(pointer);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto owner = m_segments.upper_bound(address);
+  if (owner == m_segments.begin())
+    throw std::invalid_argument("MappedFileArena::deallocate() given memory it does not own");
+  --owner;
+  auto &segment = *owner->second;
+  if (address >= segment.base() + segment.size())
+    throw std::invalid_argument("MappedFileArena::deallocate() given memory it does not own");
+  segment.give(address, size);
+  m_allocatedSize -= size;
+  // Give the disk space back, but keep one segment to avoid remapping
+  if (segment.empty() && m_segments.size() > 1)
+    m_segments.erase(owner);
+}
+
+/// @return the total size of the scratch files currently mapped
+size_t MappedFileArena::getMappedSize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  size_t total = 0;
+  for (const auto &segment : m_segments)
+    total += segment.second->size();
+  return total;
+}
+
+/// @return the bytes currently allocated, including rounding
+size_t MappedFileArena::getAllocatedSize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_allocatedSize;
+}
+
+} // namespace Mantid::Kernel
@@ -34,7 +34,8 @@ namespace Mantid::Kernel {
  *        NOTE: The ThreadPool destructor will delete this ThreadScheduler.
  * @param numThreads :: number of cores to use; default = 0, meaning auto-detect
  *all
- *        available physical cores.
+ *        available physical cores, or one if called from a ThreadPool task or
+ *        a parallel loop.
  * @param prog :: optional pointer to a Progress reporter object. If passed,
  *then
  *        automatic progress reporting will be handled by the thread pool.
@@ -47,8 +48,12 @@ ThreadPool::ThreadPool(ThreadScheduler *scheduler, size_t numThreads, ProgressBa
     throw std::invalid_argument("NULL ThreadScheduler passed to ThreadPool constructor.");
 
   if (numThreads == 0) {
-    // Uses Poco to find how many cores there are.
-    m_numThreads = getNumPhysicalCores();
+    // A pool started from another pool's task, or from a parallel loop, would only compete
+    // with the threads already running, so it gets a single thread of its own
+    if (isThreadPoolWorker() || PARALLEL_IN_PARALLEL_REGION)
+      m_numThreads = 1;
+    else
+      m_numThreads = getNumPhysicalCores();
   } else
     m_numThreads = numThreads;
   // std::cout << m_numThreads << " m_numThreads \n";
@@ -62,7 +67,7 @@ ThreadPool::~ThreadPool() = default;
 //--------------------------------------------------------------------------------
 /** Return the number of physical cores available on the system.
  * NOTE: Uses OPENMP or Poco::Environment::processorCount() to find the number.
- * @return how many cores are present.
+ * @return how many cores are present, limited by MultiThreaded.MaxCores if it is set.
  */
 size_t ThreadPool::getNumPhysicalCores() {
 // windows hangs with openmp for some reason
@@ -74,8 +79,8 @@ size_t ThreadPool::getNumPhysicalCores() {
 
   auto maxCores = Kernel::ConfigService::Instance().getValue<int>("MultiThreaded.MaxCores");
 
-  if (!maxCores.has_value())
-    return std::min(maxCores.value_or(0), physicalCores);
+  if (maxCores.value_or(0) > 0)
+    return std::min(maxCores.value(), physicalCores);
   else
     return physicalCores;
 }
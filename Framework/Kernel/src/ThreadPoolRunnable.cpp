@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
@@ -12,6 +13,25 @@
 #include <Poco/Thread.h>
 
 namespace Mantid::Kernel {
+namespace {
+/// The runnable whose run() is executing on this thread, if any
+thread_local const ThreadPoolRunnable *g_current = nullptr;
+
+/// Marks a runnable as current for its lifetime, restoring the previous one after
+class CurrentRunnable {
+public:
+  explicit CurrentRunnable(const ThreadPoolRunnable *runnable) : m_previous(g_current) { g_current = runnable; }
+  ~CurrentRunnable() { g_current = m_previous; }
+  CurrentRunnable(const CurrentRunnable &) = delete;
+  CurrentRunnable &operator=(const CurrentRunnable &) = delete;
+
+private:
+  const ThreadPoolRunnable *m_previous;
+};
+} // namespace
+
+/// @return true if the calling thread is running tasks for a ThreadPool
+bool isThreadPoolWorker() { return g_current != nullptr; }
 
 //-----------------------------------------------------------------------------------
 /** Constructor
@@ -34,11 +54,18 @@ ThreadPoolRunnable::ThreadPoolRunnable(size_t threadnum, ThreadScheduler *schedu
 /** Clear the wait time of the runnable so that it stops waiting for tasks. */
 void ThreadPoolRunnable::clearWait() { m_waitSec = 0.0; }
 
+//-----------------------------------------------------------------------------------
+/** @return the runnable running tasks on the calling thread, or nullptr if the
+ * thread is not running one
+ */
+const ThreadPoolRunnable *ThreadPoolRunnable::current() { return g_current; }
+
 //-----------------------------------------------------------------------------------
 /** Thread method. Will wait for new tasks and run them
  * as scheduled to it.
  */
 void ThreadPoolRunnable::run() {
+  CurrentRunnable current(this);
   std::shared_ptr<Task> task;
 
   // If there are no tasks yet, wait up to m_waitSec for them to come up
@@ -47,7 +74,9 @@ void ThreadPoolRunnable::run() {
     m_waitSec -= 0.01;       // Subtract ten millisec from the time left to wait.
   }
 
-  while (!m_scheduler->empty()) {
+  // Keep going while there are tasks, or tasks are still to come from work the
+  // scheduler has been told is pending elsewhere
+  while (!m_scheduler->empty() || (m_scheduler->hasPendingWork() && !m_scheduler->getAborted())) {
     // Request the task from the scheduler.
     // Will be NULL if not found.
     task = m_scheduler->pop(m_threadnum);
@@ -80,6 +109,9 @@ void ThreadPoolRunnable::run() {
         mutex->unlock();
 
       // We now delete the task to free up memory
+    } else if (m_scheduler->empty()) {
+      // The pending work has not been pushed yet, it will come in soon
+      Poco::Thread::sleep(1); // millisec
     } else {
       // No appropriate task for this thread (perhaps a mutex is locked)
       // but there are more tasks.
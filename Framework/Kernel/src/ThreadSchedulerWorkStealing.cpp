@@ -0,0 +1,146 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadPoolRunnable.h"
+
+#include <algorithm>
+
+namespace Mantid::Kernel {
+
+/** Constructor
+ * @param numThreads :: number of threads that will pop tasks; default = 0,
+ *        meaning the number a ThreadPool uses by default. Threads numbered
+ *        beyond it share queues.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numThreads)
+    : ThreadScheduler(),
+      m_threadQueues(numThreads > 0 ? numThreads : std::max<size_t>(ThreadPool::getNumPhysicalCores(), 1)) {}
+
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+/** Add a Task. From a task run by a pool using this scheduler, it goes on the
+ * queue of the thread running it; otherwise on the shared queue.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  const double cost = newTask->cost();
+  const auto runnable = ThreadPoolRunnable::current();
+  if (runnable && runnable->scheduler() == this) {
+    auto &queue = queueFor(runnable->threadnum());
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.emplace_back(std::move(newTask));
+    added(cost);
+  } else {
+    std::lock_guard<std::mutex> lock(m_shared.mutex);
+    m_shared.tasks.emplace(cost, std::move(newTask));
+    added(cost);
+  }
+}
+
+/** Retrieve the next Task for a thread: the newest on its own queue, else the
+ * costliest on the shared queue, else the oldest on another thread's queue.
+ * @param threadnum :: ID of the calling thread
+ * @return the task, or nullptr if every queue was empty
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  auto &own = queueFor(threadnum);
+  if (auto task = takeNewest(own))
+    return task;
+  if (auto task = takeCostliest(m_shared))
+    return task;
+  // Start with the next thread along so that thieves spread out over the victims
+  const size_t numQueues = m_threadQueues.size();
+  const size_t ownIndex = threadnum % numQueues;
+  for (size_t i = 1; i < numQueues; ++i) {
+    if (auto task = takeOldest(m_threadQueues[(ownIndex + i) % numQueues]))
+      return task;
+  }
+  return nullptr;
+}
+
+/// @return the number of tasks queued
+size_t ThreadSchedulerWorkStealing::size() { return m_size; }
+
+/// @return true if no task is queued
+bool ThreadSchedulerWorkStealing::empty() { return m_size == 0; }
+
+/// Empty out all the queues
+void ThreadSchedulerWorkStealing::clear() {
+  auto clearQueue = [this](auto &queue) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    m_size -= queue.tasks.size();
+    queue.tasks.clear();
+  };
+  clearQueue(m_shared);
+  for (auto &queue : m_threadQueues)
+    clearQueue(queue);
+  std::lock_guard<std::mutex> lock(m_costMutex);
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+/// @return the queue of a thread
+ThreadSchedulerWorkStealing::Queue &ThreadSchedulerWorkStealing::queueFor(size_t threadnum) {
+  return m_threadQueues[threadnum % m_threadQueues.size()];
+}
+
+/// @return the last task pushed to a queue, or nullptr if it is empty
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::takeNewest(Queue &queue) {
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  auto task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  taken(task->cost());
+  return task;
+}
+
+/// @return the first task pushed to a queue, or nullptr if it is empty
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::takeOldest(Queue &queue) {
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  auto task = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+  taken(task->cost());
+  return task;
+}
+
+/// @return the costliest task on the shared queue, or nullptr if it is empty
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::takeCostliest(SharedQueue &queue) {
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty())
+    return nullptr;
+  auto first = queue.tasks.begin();
+  auto task = std::move(first->second);
+  queue.tasks.erase(first);
+  taken(task->cost());
+  return task;
+}
+
+/** Account for a task put on a queue. The caller must hold the lock of the
+ * queue, so that the size and costs stay in step with it.
+ * @param cost :: the cost of the task
+ */
+void ThreadSchedulerWorkStealing::added(const double cost) {
+  ++m_size;
+  std::lock_guard<std::mutex> lock(m_costMutex);
+  m_cost += cost;
+}
+
+/** Account for a task taken off a queue. The caller must hold the lock of the
+ * queue, so that the size and costs stay in step with it.
+ * @param cost :: the cost of the task
+ */
+void ThreadSchedulerWorkStealing::taken(const double cost) {
+  --m_size;
+  std::lock_guard<std::mutex> lock(m_costMutex);
+  m_costExecuted += cost;
+}
+
+} // namespace Mantid::Kernel
@@ -0,0 +1,168 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/BinEdgeSearch.h"
+#include "MantidKernel/VectorHelper.h"
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+using namespace Mantid::Kernel;
+using std::vector;
+
+namespace {
+/// Reference answer using std::upper_bound
+std::optional<size_t> referenceBin(const vector<double> &edges, const double x) {
+  if (!(x >= edges.front() && x < edges.back()))
+    return std::nullopt;
+  return static_cast<size_t>(std::distance(edges.cbegin(), std::upper_bound(edges.cbegin(), edges.cend(), x)) - 1);
+}
+
+vector<double> edgesFromParams(const vector<double> &params) {
+  vector<double> edges;
+  VectorHelper::createAxisFromRebinParams(params, edges, true);
+  return edges;
+}
+} // namespace
+
+class BinEdgeSearchTest : public CxxTest::TestSuite {
+public:
+  void test_too_few_edges_throws() {
+    TS_ASSERT_THROWS(BinEdgeSearch(vector<double>{}), const std::invalid_argument &);
+    TS_ASSERT_THROWS(BinEdgeSearch(vector<double>{1.}), const std::invalid_argument &);
+  }
+
+  void test_linear_edges() {
+    const auto edges = edgesFromParams({0., 2., 100.});
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.mode(), BinEdgeSearch::Mode::Linear);
+    TS_ASSERT_EQUALS(search.numberOfBins(), 50);
+    TS_ASSERT(!search.find(-0.1));
+    TS_ASSERT(!search.find(100.));
+    TS_ASSERT_EQUALS(search.find(0.).value(), 0);
+    TS_ASSERT_EQUALS(search.find(1.999).value(), 0);
+    TS_ASSERT_EQUALS(search.find(2.).value(), 1);
+    TS_ASSERT_EQUALS(search.find(99.).value(), 49);
+  }
+
+  void test_linear_edges_with_short_last_bin() {
+    const auto edges = edgesFromParams({0., 0.1, 100.05});
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.mode(), BinEdgeSearch::Mode::Linear);
+    checkAgainstReference(edges, search);
+  }
+
+  void test_logarithmic_edges() {
+    const auto edges = edgesFromParams({1., -0.001, 1.1});
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.mode(), BinEdgeSearch::Mode::Logarithmic);
+    checkAgainstReference(edges, search);
+  }
+
+  void test_arbitrary_edges() {
+    const vector<double> edges{-5., -1., 0., 0.5, 7., 7.25, 100.};
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.mode(), BinEdgeSearch::Mode::Arbitrary);
+    TS_ASSERT_EQUALS(search.find(-5.).value(), 0);
+    TS_ASSERT_EQUALS(search.find(0.).value(), 2);
+    TS_ASSERT_EQUALS(search.find(7.1).value(), 4);
+    TS_ASSERT_EQUALS(search.find(99.).value(), 5);
+    checkAgainstReference(edges, search);
+  }
+
+  void test_mixed_linear_and_log_edges_are_arbitrary() {
+    const auto edges = edgesFromParams({1., 0.5, 10., -0.1, 100.});
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.mode(), BinEdgeSearch::Mode::Arbitrary);
+    checkAgainstReference(edges, search);
+  }
+
+  void test_single_bin() {
+    const vector<double> edges{1., 2.};
+    BinEdgeSearch search(edges);
+    TS_ASSERT_EQUALS(search.find(1.5).value(), 0);
+    TS_ASSERT(!search.find(2.));
+  }
+
+  void test_nan_is_not_in_any_bin() {
+    const auto edges = edgesFromParams({0., 1., 10.});
+    BinEdgeSearch search(edges);
+    TS_ASSERT(!search.find(std::numeric_limits<double>::quiet_NaN()));
+  }
+
+private:
+  void checkAgainstReference(const vector<double> &edges, const BinEdgeSearch &search) {
+    std::mt19937 generator(1234);
+    const double width = edges.back() - edges.front();
+    std::uniform_real_distribution<double> distribution(edges.front() - 0.1 * width, edges.back() + 0.1 * width);
+    for (size_t i = 0; i < 10000; ++i) {
+      const double x = distribution(generator);
+      TS_ASSERT_EQUALS(search.find(x), referenceBin(edges, x));
+    }
+    // Every edge belongs to the bin above it
+    for (size_t i = 0; i + 1 < edges.size(); ++i)
+      TS_ASSERT_EQUALS(search.find(edges[i]).value(), i);
+  }
+};
+
+/** Histograms NUM_EVENTS uniformly distributed values so the rate in events per
+ * second for each strategy can be read off the test timings, with
+ * std::upper_bound as the baseline.
+ */
+class BinEdgeSearchTestPerformance : public CxxTest::TestSuite {
+public:
+  static BinEdgeSearchTestPerformance *createSuite() { return new BinEdgeSearchTestPerformance(); }
+  static void destroySuite(BinEdgeSearchTestPerformance *suite) { delete suite; }
+
+  BinEdgeSearchTestPerformance()
+      : m_linearEdges(edgesFromParams({1000., 1., 20000.})), m_logEdges(edgesFromParams({1000., -0.0002, 20000.})),
+        m_events(NUM_EVENTS) {
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(900., 20100.);
+    std::generate(m_events.begin(), m_events.end(), [&]() { return distribution(generator); });
+    // Perturb the linear edges so that they must be searched
+    m_arbitraryEdges = m_linearEdges;
+    for (size_t i = 1; i + 1 < m_arbitraryEdges.size(); i += 2)
+      m_arbitraryEdges[i] += 0.3;
+  }
+
+  void test_linear_edges() { TS_ASSERT_LESS_THAN(0., histogram(m_linearEdges)); }
+
+  void test_logarithmic_edges() { TS_ASSERT_LESS_THAN(0., histogram(m_logEdges)); }
+
+  void test_arbitrary_edges() { TS_ASSERT_LESS_THAN(0., histogram(m_arbitraryEdges)); }
+
+  void test_upper_bound_baseline() {
+    vector<double> counts(m_arbitraryEdges.size() - 1, 0.);
+    for (const double x : m_events) {
+      if (const auto bin = referenceBin(m_arbitraryEdges, x))
+        counts[*bin] += 1.;
+    }
+    TS_ASSERT_LESS_THAN(0., std::accumulate(counts.cbegin(), counts.cend(), 0.));
+  }
+
+private:
+  double histogram(const vector<double> &edges) {
+    BinEdgeSearch search(edges);
+    vector<double> counts(search.numberOfBins(), 0.);
+    for (const double x : m_events) {
+      if (const auto bin = search.find(x))
+        counts[*bin] += 1.;
+    }
+    return std::accumulate(counts.cbegin(), counts.cend(), 0.);
+  }
+
+  static constexpr size_t NUM_EVENTS = 20000000;
+  vector<double> m_linearEdges;
+  vector<double> m_logEdges;
+  vector<double> m_arbitraryEdges;
+  vector<double> m_events;
+};
@@ -0,0 +1,102 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MappedFileArena.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <vector>
+
+using Mantid::Kernel::MappedFileArena;
+
+class MappedFileArenaTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MappedFileArenaTest *createSuite() { return new MappedFileArenaTest(); }
+  static void destroySuite(MappedFileArenaTest *suite) { delete suite; }
+
+  void test_nothing_is_mapped_until_first_allocation() {
+    MappedFileArena arena(tempDirectory(), SEGMENT);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), 0);
+    TS_ASSERT_EQUALS(arena.getAllocatedSize(), 0);
+  }
+
+  void test_memory_is_aligned_and_usable() {
+    MappedFileArena arena(tempDirectory(), SEGMENT);
+    auto first = static_cast<double *>(arena.allocate(100 * sizeof(double)));
+    auto second = static_cast<double *>(arena.allocate(3));
+    TS_ASSERT_EQUALS(reinterpret_cast<std::uintptr_t>(first) % MappedFileArena::ALIGNMENT, 0);
+    TS_ASSERT_EQUALS(reinterpret_cast<std::uintptr_t>(second) % MappedFileArena::ALIGNMENT, 0);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), SEGMENT);
+    TS_ASSERT_EQUALS(arena.getAllocatedSize(), 832 + 64);
+
+    for (size_t i = 0; i < 100; ++i)
+      first[i] = static_cast<double>(i);
+    TS_ASSERT_EQUALS(first[99], 99.);
+
+    arena.deallocate(first, 100 * sizeof(double));
+    arena.deallocate(second, 3);
+    TS_ASSERT_EQUALS(arena.getAllocatedSize(), 0);
+    // The first segment is kept
+    TS_ASSERT_EQUALS(arena.getMappedSize(), SEGMENT);
+  }
+
+  void test_freed_neighbours_are_merged() {
+    MappedFileArena arena(tempDirectory(), SEGMENT);
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < 4; ++i)
+      blocks.emplace_back(arena.allocate(SEGMENT / 4));
+    // Free the middle two in the order that needs both merges
+    arena.deallocate(blocks[2], SEGMENT / 4);
+    arena.deallocate(blocks[1], SEGMENT / 4);
+    auto merged = arena.allocate(SEGMENT / 2);
+    TS_ASSERT_EQUALS(merged, blocks[1]);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), SEGMENT);
+  }
+
+  void test_new_segments_are_mapped_and_released() {
+    MappedFileArena arena(tempDirectory(), SEGMENT);
+    auto first = arena.allocate(SEGMENT);
+    auto second = arena.allocate(SEGMENT / 2);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), 2 * SEGMENT);
+    // Larger than a segment gets a segment of its own
+    auto large = arena.allocate(3 * SEGMENT);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), 5 * SEGMENT);
+    std::memset(large, 1, 3 * SEGMENT);
+
+    arena.deallocate(large, 3 * SEGMENT);
+    arena.deallocate(second, SEGMENT / 2);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), SEGMENT);
+    arena.deallocate(first, SEGMENT);
+    TS_ASSERT_EQUALS(arena.getMappedSize(), SEGMENT);
+  }
+
+  void test_foreign_pointer_throws() {
+    MappedFileArena arena(tempDirectory(), SEGMENT);
+    auto block = arena.allocate(64);
+    double onStack = 0.;
+    TS_ASSERT_THROWS(arena.deallocate(&onStack, sizeof(double)), const std::invalid_argument &);
+    arena.deallocate(block, 64);
+  }
+
+  void test_unusable_directory_throws_bad_alloc() {
+    MappedFileArena arena((std::filesystem::temp_directory_path() / "MappedFileArenaTest-does-not-exist").string(),
+                          SEGMENT);
+    TS_ASSERT_THROWS(arena.allocate(64), const std::bad_alloc &);
+  }
+
+private:
+  static std::string tempDirectory() { return std::filesystem::temp_directory_path().string(); }
+
+  static constexpr size_t SEGMENT = 1024 * 1024;
+};
@@ -11,7 +11,9 @@
 #include "MantidKernel/Timer.h"
 
 #include <cxxtest/TestSuite.h>
+#include <chrono>
 #include <memory>
+#include <thread>
 
 using namespace Mantid::Kernel;
 
@@ -43,6 +45,26 @@ public:
     TS_ASSERT_EQUALS(sc->size(), 0);
   }
 
+  void test_run_waits_for_pending_work() {
+    std::unique_ptr<ThreadScheduler> sc = std::make_unique<ThreadSchedulerFIFO>();
+    ThreadPoolRunnable tpr(0, sc.get());
+    sc->addPendingWork();
+
+    // The queue is empty, but a task is on its way
+    ThreadPoolRunnableTest_value = 0;
+    std::thread producer([&sc] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      sc->push(std::make_shared<SimpleTask>());
+      sc->removePendingWork();
+    });
+    tpr.run();
+    producer.join();
+
+    TS_ASSERT_EQUALS(ThreadPoolRunnableTest_value, 1234);
+    TS_ASSERT_EQUALS(sc->size(), 0);
+    TS_ASSERT(!sc->hasPendingWork());
+  }
+
   //=======================================================================================
   /** Class that throws an exception */
   class TaskThatThrows : public Task {
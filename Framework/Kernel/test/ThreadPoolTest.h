@@ -9,14 +9,17 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 
 #include <Poco/Thread.h>
 
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 
@@ -358,6 +361,8 @@ public:
 
   void test_StressTest_ThreadSchedulerMutexes() { do_StressTest_scheduler(new ThreadSchedulerMutexes()); }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() { do_StressTest_scheduler(new ThreadSchedulerWorkStealing()); }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -396,6 +401,22 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
+  //--------------------------------------------------------------------
+  void test_tasks_know_they_are_in_a_pool() {
+    TS_ASSERT(!isThreadPoolWorker());
+    ThreadPool p(new ThreadSchedulerFIFO(), 2);
+    std::atomic<int> inPool{0};
+    for (int i = 0; i < 10; i++)
+      p.schedule(std::make_shared<FunctionTask>([&inPool] { inPool += isThreadPoolWorker() ? 1 : 0; }));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    TS_ASSERT_EQUALS(inPool.load(), 10);
+    TS_ASSERT(!isThreadPoolWorker());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
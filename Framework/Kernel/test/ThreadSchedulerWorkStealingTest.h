@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPoolRunnable.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <vector>
+
+using namespace Mantid::Kernel;
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() { return new ThreadSchedulerWorkStealingTest(); }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) { delete suite; }
+
+  void test_tasks_pushed_from_outside_are_taken_oldest_first() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    for (int i = 0; i < 3; ++i)
+      scheduler.push(recordingTask(record, i));
+    TS_ASSERT_EQUALS(scheduler.size(), 3);
+
+    scheduler.pop(1)->run();
+    scheduler.pop(0)->run();
+    scheduler.pop(1)->run();
+    TS_ASSERT(scheduler.empty());
+    TS_ASSERT(!scheduler.pop(0));
+    TS_ASSERT_EQUALS(record, std::vector<int>({0, 1, 2}));
+  }
+
+  void test_tasks_pushed_from_outside_are_taken_costliest_first() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    scheduler.push(recordingTask(record, 0, 1.));
+    scheduler.push(recordingTask(record, 1, 10.));
+    scheduler.push(recordingTask(record, 2, 1.));
+    scheduler.push(recordingTask(record, 3, 5.));
+    while (auto task = scheduler.pop(0))
+      task->run();
+    TS_ASSERT_EQUALS(record, std::vector<int>({1, 3, 0, 2}));
+  }
+
+  void test_tasks_pushed_from_a_task_are_taken_newest_first_by_that_thread() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    scheduler.push(std::make_shared<FunctionTask>([&scheduler, &record] {
+      for (int i = 0; i < 3; ++i)
+        scheduler.push(recordingTask(record, i));
+    }));
+    ThreadPoolRunnable(0, &scheduler).run();
+    TS_ASSERT_EQUALS(record, std::vector<int>({2, 1, 0}));
+  }
+
+  void test_idle_thread_steals_oldest_task() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    scheduler.push(std::make_shared<FunctionTask>([&scheduler, &record] {
+      for (int i = 0; i < 3; ++i)
+        scheduler.push(recordingTask(record, i));
+      // Thread 1 has nothing of its own, so takes from thread 0
+      scheduler.pop(1)->run();
+    }));
+    ThreadPoolRunnable(0, &scheduler).run();
+    TS_ASSERT_EQUALS(record, std::vector<int>({0, 2, 1}));
+  }
+
+  void test_costs_are_added_up() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    scheduler.push(std::make_shared<FunctionTask>(
+        [&scheduler, &record] { scheduler.push(recordingTask(record, 0, 2.)); }, 1.));
+    scheduler.push(recordingTask(record, 1, 4.));
+    TS_ASSERT_EQUALS(scheduler.totalCost(), 5.);
+    TS_ASSERT_EQUALS(scheduler.totalCostExecuted(), 0.);
+    ThreadPoolRunnable(0, &scheduler).run();
+    TS_ASSERT_EQUALS(scheduler.totalCost(), 7.);
+    TS_ASSERT_EQUALS(scheduler.totalCostExecuted(), 7.);
+    scheduler.clear();
+    TS_ASSERT_EQUALS(scheduler.totalCost(), 0.);
+    TS_ASSERT_EQUALS(scheduler.totalCostExecuted(), 0.);
+  }
+
+  void test_clear() {
+    ThreadSchedulerWorkStealing scheduler(2);
+    std::vector<int> record;
+    scheduler.push(std::make_shared<FunctionTask>([&scheduler, &record] {
+      scheduler.push(recordingTask(record, 0));
+      scheduler.push(recordingTask(record, 1));
+    }));
+    scheduler.push(recordingTask(record, 2));
+    scheduler.clear();
+    TS_ASSERT_EQUALS(scheduler.size(), 0);
+    TS_ASSERT(!scheduler.pop(0));
+    TS_ASSERT(record.empty());
+  }
+
+private:
+  static std::shared_ptr<Task> recordingTask(std::vector<int> &record, const int id, const double cost = 1.) {
+    return std::make_shared<FunctionTask>([&record, id] { record.emplace_back(id); }, cost);
+  }
+};
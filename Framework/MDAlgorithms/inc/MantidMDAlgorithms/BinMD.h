@@ -65,6 +65,35 @@ private:
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax);
 
+  /// Add a whole box to one bin if it lies within it
+  template <size_t nd>
+  bool binWholeBox(const coord_t *vertexes, const size_t numVertexes, const signal_t signal,
+                   const signal_t errorSquared, const uint64_t nPoints, const size_t *const chunkMin,
+                   const size_t *const chunkMax);
+
+  /// Find the one bin a whole box can be added to, if there is one
+  template <typename MDE, size_t nd>
+  bool findWholeBoxBin(const DataObjects::MDBoxBase<MDE, nd> &box, const size_t *const chunkMin,
+                       const size_t *const chunkMax, size_t &linearIndex, bool &inChunk);
+
+  /// Method to add a box whole at some level of detail, if it can be
+  template <typename MDE, size_t nd>
+  bool binBoxAtLevelOfDetail(const DataObjects::MDBoxBase<MDE, nd> &box, const size_t *const chunkMin,
+                             const size_t *const chunkMax);
+
+  /// Method to bin a range of events
+  template <typename MDE>
+  void binEvents(const MDE *begin, const MDE *end, const size_t *const chunkMin, const size_t *const chunkMax);
+
+  /// Check that a previous output was binned from the input as it is now
+  bool previousOutputIsCurrent(const DataObjects::MDHistoWorkspace &previous, const API::Workspace &input) const;
+  /// Find the bins that can be taken from a previous output
+  bool findReusedBins(const DataObjects::MDHistoWorkspace &previous);
+  /// Fill the reused bins from the previous output
+  void copyReusedBins();
+  /// The regions of bins left to bin from the events
+  std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>> regionsToBin() const;
+
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
   /// Progress reporting
@@ -78,6 +107,19 @@ private:
   signal_t *errors;
   signal_t *numEvents;
   bool m_accumulate{false};
+  /// Largest width of a box, in bins, that is added whole at its centroid
+  double m_levelOfDetailTolerance{0.};
+
+  /// Previous output whose bins are reused, if any
+  DataObjects::MDHistoWorkspace_const_sptr m_previousWS;
+  /// For each output dimension, the first bin filled from m_previousWS
+  std::vector<size_t> m_reusedMin;
+  /// For each output dimension, one past the last bin filled from m_previousWS
+  std::vector<size_t> m_reusedMax;
+  /// For each output dimension, the number of bins of m_previousWS in one bin
+  std::vector<size_t> m_reuseFactor;
+  /// For each output dimension, the bin of m_previousWS where bin 0 starts
+  std::vector<int64_t> m_reuseOffset;
 };
 
 } // namespace MDAlgorithms
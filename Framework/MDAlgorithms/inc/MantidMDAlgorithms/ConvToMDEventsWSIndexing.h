@@ -121,17 +121,26 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
     getEventsFrom(el, events_ptr);
     const typename std::vector<EventType> &events = *events_ptr;
     std::vector<MDEventType<ND>> mdEventsForSpectrum;
-    // Iterators to start/end
-    for (const auto &event : events) {
-      double val = localUnitConv.convertUnits(event.tof());
-      double signal = event.weight();
-      double errorSq = event.errorSquared();
-
-      if (!localQConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+    // Convert the whole spectrum in one batch
+    std::vector<double> vals(numEvents), signal(numEvents), errorSq(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+      vals[i] = events[i].tof();
+      signal[i] = events[i].weight();
+      errorSq[i] = events[i].errorSquared();
+    }
+    localUnitConv.convertUnits(vals);
+    std::vector<coord_t> allCoord;
+    std::vector<char> inRange;
+    localQConverter->calcMatrixCoords(vals, locCoord, signal, errorSq, allCoord, inRange);
+
+    coord_t *eventCoord = allCoord.data();
+    for (size_t i = 0; i < numEvents; ++i) {
+      if (!inRange[i])
         continue; // skip ND outside the range
 
       mdEventsForSpectrum.emplace_back(MDEventMaker<ND, MDEventType>::makeMDEvent(
-          signal, errorSq, expInfoIndexLoc, goniometerIndex, detID, &locCoord[0]));
+          signal[i], errorSq[i], expInfoIndexLoc, goniometerIndex, detID, eventCoord));
+      eventCoord += ND;
 
       // Filter events before adding to the ndEvents vector to add in workspace
       // The bounds of the resulting WS have to be already defined
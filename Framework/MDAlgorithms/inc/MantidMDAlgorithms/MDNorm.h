@@ -10,10 +10,12 @@
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidMDAlgorithms/DllConfig.h"
+#include "MantidMDAlgorithms/MDNormDetectorCache.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
 namespace Mantid {
 namespace MDAlgorithms {
+class MDNormGrid;
 
 /** MDNormalization : Bin single crystal diffraction or direct geometry
  * inelastic data and calculate the corresponding statistical weight
@@ -77,8 +79,8 @@ private:
 
   void calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                               std::vector<double> &yValues, const size_t &vmdDims, std::vector<coord_t> &pos,
-                              std::vector<coord_t> &posNew, std::vector<std::atomic<signal_t>> &signalArray,
-                              const double &solidBkgd, std::vector<std::atomic<signal_t>> &bkgdSignalArray);
+                              std::vector<coord_t> &posNew, const size_t thread, MDNormGrid &signalArray,
+                              const double &solidBkgd, MDNormGrid &bkgdSignalArray);
 
   API::IMDWorkspace_sptr divideMD(const API::IMDHistoWorkspace_sptr &lhs, const API::IMDHistoWorkspace_sptr &rhs,
                                   const std::string &outputwsname, const double &startProgress,
@@ -123,6 +125,8 @@ private:
   Kernel::V3D m_samplePos;
   /// Beam direction
   Kernel::V3D m_beamDir;
+  /// Values for the detectors, kept for one execution
+  MDNormDetectorCache m_detectorCache;
   /// ki-kf for Inelastic convention; kf-ki for Crystallography convention
   std::string convention;
 };
@@ -0,0 +1,93 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidKernel/V3D.h"
+#include "MantidMDAlgorithms/DllConfig.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** MDNormDetectorCache : what MDNorm, MDNormSCD and MDNormDirectSC need to
+ * know about each spectrum that does not change with the goniometer: whether
+ * to use it, the angles of its detector, its flux spectrum and its solid
+ * angle.
+
+  Working these out means building maps from detector ID to workspace index
+  and finding the angles of every detector, which was done again for every
+  symmetry operation of every run. Instead the algorithms keep them in one of
+  these caches for the length of an execution, for the experiment, flux and
+  solid angle workspaces they were made from, the sample position and the beam
+  direction. The workspaces are compared by identity, so finding the values
+  does not depend on the number of detectors. The cache is emptied at the start
+  and end of each execution, so workspaces changed in place between runs, for
+  example by MaskDetectors, are always seen.
+*/
+class MANTID_MDALGORITHMS_DLL MDNormDetectorCache {
+public:
+  /// What is cached for one spectrum
+  struct Spectrum {
+    /// False for monitors, masked detectors and spectra without detectors or flux
+    bool use{false};
+    /// Scattering angle of the detector
+    double twoTheta{0.};
+    /// Azimuthal angle of the detector
+    double phi{0.};
+    /// Workspace index of the flux spectrum for the detector
+    size_t fluxIndex{0};
+    /// The solid angle of the detector, or 1 without a solid angle workspace
+    double solidAngle{1.};
+  };
+
+  /// The values for every spectrum of one experiment
+  class MANTID_MDALGORITHMS_DLL Detectors {
+  public:
+    Detectors(const API::ExperimentInfo_const_sptr &exptInfo, const Kernel::V3D &samplePos, const Kernel::V3D &beamDir,
+              const API::MatrixWorkspace_const_sptr &flux, const API::MatrixWorkspace_const_sptr &solidAngle,
+              std::vector<Spectrum> spectra);
+
+    /// The cached values for a spectrum of the experiment
+    const Spectrum &operator[](const size_t index) const { return m_spectra[index]; }
+    /// Number of spectra
+    size_t size() const { return m_spectra.size(); }
+    bool isFor(const API::ExperimentInfo_const_sptr &exptInfo, const Kernel::V3D &samplePos,
+               const Kernel::V3D &beamDir, const API::MatrixWorkspace_const_sptr &flux,
+               const API::MatrixWorkspace_const_sptr &solidAngle) const;
+
+  private:
+    /// The experiment the values are for
+    std::weak_ptr<const API::ExperimentInfo> m_exptInfo;
+    /// The position of the sample
+    Kernel::V3D m_samplePos;
+    /// The direction of the beam
+    Kernel::V3D m_beamDir;
+    /// The flux workspace, if any
+    std::weak_ptr<const API::MatrixWorkspace> m_flux;
+    /// The solid angle workspace, if any
+    std::weak_ptr<const API::MatrixWorkspace> m_solidAngle;
+    /// Values for each spectrum
+    std::vector<Spectrum> m_spectra;
+  };
+
+  std::shared_ptr<const Detectors> get(const API::ExperimentInfo_const_sptr &exptInfo, const Kernel::V3D &samplePos,
+                                       const Kernel::V3D &beamDir, const API::MatrixWorkspace_const_sptr &flux,
+                                       const API::MatrixWorkspace_const_sptr &solidAngle);
+  void clear();
+
+private:
+  /// The cached sets, most recently used first
+  std::list<std::shared_ptr<const Detectors>> m_cache;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
@@ -0,0 +1,68 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidMDAlgorithms/DllConfig.h"
+
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** MDNormGrid : the normalization grid that MDNorm, MDNormSCD and
+ * MDNormDirectSC add the contributions of the detectors into, from many
+ * threads at once.
+
+  Each thread adds into a private copy of the grid, allocated when the thread
+  first adds to it, so that threads never contend for a bin. The copies are
+  summed bin by bin in thread order when the grid is written out. If private
+  copies for all the threads would take more than the memory limit, the
+  threads add into one shared grid of atomics instead. Either way the order
+  of the floating point additions follows how the detectors were shared
+  between threads, so results may differ in the last bits from run to run.
+*/
+class MANTID_MDALGORITHMS_DLL MDNormGrid {
+public:
+  MDNormGrid(size_t numPoints, size_t numThreads, std::optional<size_t> memoryLimit = std::nullopt);
+
+  /** Add to a bin of the grid
+   * @param thread :: the number of the calling thread, less than numThreads
+   * @param index :: linear index of the bin
+   * @param value :: value to add
+   */
+  void add(const size_t thread, const size_t index, const signal_t value) {
+    if (!m_shared.empty()) {
+      Kernel::AtomicOp(m_shared[index], value, std::plus<signal_t>());
+      return;
+    }
+    auto &grid = m_private[thread];
+    if (grid.empty())
+      grid.assign(m_numPoints, 0.);
+    grid[index] += value;
+  }
+
+  void writeTo(signal_t *signal, const bool accumulate) const;
+
+  /// True if each thread adds into its own copy of the grid
+  bool isPrivate() const { return m_shared.empty(); }
+
+private:
+  /// Number of bins in the grid
+  size_t m_numPoints;
+  /// A copy of the grid for each thread, empty until the thread adds to it
+  std::vector<std::vector<signal_t>> m_private;
+  /// One grid for all threads, used if the copies would take too much memory
+  std::vector<std::atomic<signal_t>> m_shared;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
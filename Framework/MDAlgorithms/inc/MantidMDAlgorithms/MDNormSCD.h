@@ -7,6 +7,7 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidMDAlgorithms/MDNormDetectorCache.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
 namespace Mantid {
@@ -68,6 +69,8 @@ private:
   Kernel::V3D m_samplePos;
   /// Beam direction
   Kernel::V3D m_beamDir;
+  /// Values for the detectors, kept for one execution
+  MDNormDetectorCache m_detectorCache;
   /// ki-kf for Inelastic convention; kf-ki for Crystallography convention
   std::string convention;
   /// internal flag to accumulate to an existing workspace
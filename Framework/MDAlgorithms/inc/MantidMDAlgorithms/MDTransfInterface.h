@@ -136,6 +136,28 @@ public:
       * */
   virtual bool calcMatrixCoord(const double &X, std::vector<coord_t> &Coord, double &signal, double &errSq) const = 0;
 
+  /** Calculate the remaining coordinates for a batch of X values, all of the
+   * spectrum set up by the last call to calcYDepCoordinates. The result is the
+   * same as calling calcMatrixCoord for each value; transformations override it
+   * to do the per-spectrum work once and convert the batch in a tight loop.
+   * @param X       -- X workspace values
+   * @param Coord   -- coordinates with the ones not depending on X filled in
+   * @param signal  -- signal of each value, changed in place as by calcMatrixCoord
+   * @param errSq   -- squared error of each value, changed in place likewise
+   * @param allCoord -- the coordinates of each value within the range are appended to this
+   * @param inRange -- set for each value to whether it is within the range requested
+   */
+  virtual void calcMatrixCoords(const std::vector<double> &X, std::vector<coord_t> &Coord, std::vector<double> &signal,
+                                std::vector<double> &errSq, std::vector<coord_t> &allCoord,
+                                std::vector<char> &inRange) const {
+    inRange.resize(X.size());
+    for (size_t i = 0; i < X.size(); ++i) {
+      inRange[i] = calcMatrixCoord(X[i], Coord, signal[i], errSq[i]);
+      if (inRange[i])
+        allCoord.insert(allCoord.end(), Coord.begin(), Coord.end());
+    }
+  }
+
   /* clone method allowing to provide the copy of the particular class */
   virtual MDTransfInterface *clone() const = 0;
   // destructor
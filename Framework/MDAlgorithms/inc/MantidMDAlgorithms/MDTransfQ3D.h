@@ -32,6 +32,9 @@ public:
   const std::string transfID() const override;
   bool calcYDepCoordinates(std::vector<coord_t> &Coord, size_t i) override;
   bool calcMatrixCoord(const double &deltaEOrK0, std::vector<coord_t> &Coord, double &s, double &err) const override;
+  void calcMatrixCoords(const std::vector<double> &deltaEOrK0, std::vector<coord_t> &Coord, std::vector<double> &s,
+                        std::vector<double> &err, std::vector<coord_t> &allCoord,
+                        std::vector<char> &inRange) const override;
   // constructor;
   MDTransfQ3D();
   /* clone method allowing to provide the copy of the particular class */
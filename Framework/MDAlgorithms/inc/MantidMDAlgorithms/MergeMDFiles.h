@@ -9,6 +9,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/IMDEventWorkspace_fwd.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
+#include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidMDAlgorithms/DllConfig.h"
 #include <mutex>
 
@@ -54,6 +55,10 @@ private:
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
 
+  template <typename MDE, size_t nd> void mergeStreaming(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+
+  void saveMergedBox(API::IMDNode *box);
+
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
   // the vector of box structures for contributing files components
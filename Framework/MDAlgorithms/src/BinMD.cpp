@@ -5,7 +5,9 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/BinMD.h"
+#include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/ImplicitFunctionFactory.h"
+#include "MantidAPI/WorkspaceHistory.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/CoordTransformAffineParser.h"
 #include "MantidDataObjects/CoordTransformAligned.h"
@@ -16,6 +18,7 @@
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidGeometry/MDGeometry/MDBoxImplicitFunction.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Strings.h"
@@ -70,106 +73,299 @@ void BinMD::init() {
                   "due to disk thrashing.");
   setPropertyGroup("Parallel", grp);
 
+  declareProperty(std::make_unique<PropertyWithValue<bool>>("LevelOfDetail", false, Direction::Input),
+                  "Add any box, at any depth, that lies wholly within one bin from its "
+                  "cached signal and error instead of going down to its events. Boxes "
+                  "with masked boxes within are not added whole.");
+  setPropertyGroup("LevelOfDetail", grp);
+
+  auto mustBePositive = std::make_shared<BoundedValidator<double>>();
+  mustBePositive->setLower(0.0);
+  declareProperty("LevelOfDetailTolerance", 0.0, mustBePositive,
+                  "With LevelOfDetail, a box no wider than this many bins in every "
+                  "output dimension is also added whole, to the bin of its centroid. "
+                  "This is an approximation that makes coarse cuts faster; 0 keeps "
+                  "the result exact.");
+  setPropertySettings("LevelOfDetailTolerance", std::make_unique<EnabledWhenProperty>("LevelOfDetail", IS_NOT_DEFAULT));
+  setPropertyGroup("LevelOfDetailTolerance", grp);
+
   declareProperty(std::make_unique<WorkspaceProperty<IMDHistoWorkspace>>("TemporaryDataWorkspace", "", Direction::Input,
                                                                          PropertyMode::Optional),
                   "An input MDHistoWorkspace used to accumulate results from "
                   "multiple MDEventWorkspaces. If unspecified a blank "
                   "MDHistoWorkspace will be created.");
 
+  declareProperty(std::make_unique<WorkspaceProperty<IMDHistoWorkspace>>("PreviousOutputWorkspace", "",
+                                                                         Direction::Input, PropertyMode::Optional),
+                  "A previous output of BinMD on the same, unchanged, InputWorkspace. "
+                  "If it has the same transformation, and bins that line up with the new ones "
+                  "(the same width or a whole number of them, shifted by whole bins), the bins "
+                  "it covers are summed from it and only the boxes of the rest are binned. "
+                  "It is not used with an ImplicitFunctionXML or a TemporaryDataWorkspace, nor if its "
+                  "history does not show it as an unfiltered output of BinMD on the InputWorkspace as it is now.");
+
   declareProperty(std::make_unique<WorkspaceProperty<Workspace>>("OutputWorkspace", "", Direction::Output),
                   "A name for the output MDHistoWorkspace.");
 }
 
 //----------------------------------------------------------------------------------------------
-/** Bin the contents of a MDBox
+/** Check from the history of a previous output of BinMD that its bins are
+ * still those of the input: BinMD was the last algorithm to write to it, with
+ * no ImplicitFunctionXML or TemporaryDataWorkspace, and no algorithm has
+ * changed the input since. Without that history they cannot be verified.
  *
- * @param box :: pointer to the MDBox to bin
+ * @param previous :: the previous output of BinMD
+ * @param input :: the workspace it was binned from
+ * @return true if the bins of previous can be reused
+ */
+bool BinMD::previousOutputIsCurrent(const MDHistoWorkspace &previous, const Workspace &input) const {
+  const auto &previousHistory = previous.getHistory().getAlgorithmHistories();
+  if (previousHistory.empty() || previousHistory.back()->name() != name())
+    return false;
+  const auto &binMD = *previousHistory.back();
+  try {
+    if (!binMD.getPropertyValue("ImplicitFunctionXML").empty() ||
+        !binMD.getPropertyValue("TemporaryDataWorkspace").empty())
+      return false;
+  } catch (Exception::NotFoundError &) {
+    return false;
+  }
+
+  // Any algorithm run on the input since is in its history but not in the
+  // history of the previous output
+  const auto &inputHistory = input.getHistory().getAlgorithmHistories();
+  return std::all_of(inputHistory.cbegin(), inputHistory.cend(), [&previousHistory](const auto &algorithm) {
+    return std::any_of(previousHistory.cbegin(), previousHistory.cend(),
+                       [&algorithm](const auto &other) { return *algorithm == *other; });
+  });
+}
+
+//----------------------------------------------------------------------------------------------
+/** Find the bins of the output that can be summed from the bins of a previous
+ * output, rather than binned from the events again. That is possible when both
+ * have the same transformation from the same original workspace, and in each
+ * dimension an output bin is a whole number of previous bins, starting on a
+ * previous bin edge. The bins found are a box given by m_reusedMin and
+ * m_reusedMax.
+ *
+ * NOTE: m_transformFromOriginal must still be set.
+ *
+ * @param previous :: the previous output of BinMD
+ * @return true if any bins can be reused
+ */
+bool BinMD::findReusedBins(const MDHistoWorkspace &previous) {
+  if (previous.getNumDims() != m_outD || previous.numOriginalWorkspaces() == 0 ||
+      previous.getOriginalWorkspace(0).get() != m_inWS.get() || !previousOutputIsCurrent(previous, *m_inWS))
+    return false;
+  const auto *previousTransform = previous.getTransformFromOriginal(0);
+  if (!previousTransform || !m_transformFromOriginal)
+    return false;
+  try {
+    if (!m_transformFromOriginal->makeAffineMatrix().equals(previousTransform->makeAffineMatrix(), 1e-5))
+      return false;
+  } catch (std::runtime_error &) {
+    // Not an affine transformation, so cannot be compared
+    return false;
+  }
+
+  m_reusedMin.resize(m_outD);
+  m_reusedMax.resize(m_outD);
+  m_reuseFactor.resize(m_outD);
+  m_reuseOffset.resize(m_outD);
+  for (size_t d = 0; d < m_outD; d++) {
+    const auto &dim = m_binDimensions[d];
+    const auto previousDim = previous.getDimension(d);
+    const double previousWidth = previousDim->getBinWidth();
+    const double factor = dim->getBinWidth() / previousWidth;
+    const double offset = (dim->getMinimum() - previousDim->getMinimum()) / previousWidth;
+    const auto k = static_cast<int64_t>(std::llround(factor));
+    const auto o = static_cast<int64_t>(std::llround(offset));
+    if (k < 1 || std::abs(factor - static_cast<double>(k)) > 1e-4 || std::abs(offset - static_cast<double>(o)) > 1e-4)
+      return false;
+
+    // The output bins i with all of [o + i*k, o + (i+1)*k) in the previous bins
+    const auto previousBins = static_cast<int64_t>(previousDim->getNBins());
+    const auto bins = static_cast<int64_t>(dim->getNBins());
+    const int64_t first = o >= 0 ? 0 : (k - 1 - o) / k;
+    const int64_t last = std::min(bins, previousBins >= o ? (previousBins - o) / k : 0);
+    if (first >= last)
+      return false;
+    m_reusedMin[d] = static_cast<size_t>(first);
+    m_reusedMax[d] = static_cast<size_t>(last);
+    m_reuseFactor[d] = static_cast<size_t>(k);
+    m_reuseOffset[d] = o;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add the bins of the previous output to the reused bins of the output */
+void BinMD::copyReusedBins() {
+  const signal_t *previousSignals = m_previousWS->getSignalArray();
+  const signal_t *previousErrors = m_previousWS->getErrorSquaredArray();
+  const signal_t *previousNumEvents = m_previousWS->getNumEventsArray();
+  std::vector<size_t> previousMultiplier(m_outD, 1);
+  for (size_t d = 1; d < m_outD; d++)
+    previousMultiplier[d] = m_previousWS->getIndexMultiplier()[d - 1];
+
+  std::vector<size_t> index(m_reusedMin);
+  std::vector<size_t> block(m_outD, 0);
+  do {
+    size_t linearIndex = 0;
+    size_t previousFirst = 0;
+    for (size_t d = 0; d < m_outD; d++) {
+      linearIndex += indexMultiplier[d] * index[d];
+      previousFirst += previousMultiplier[d] * static_cast<size_t>(m_reuseOffset[d] +
+                                                                   static_cast<int64_t>(index[d] * m_reuseFactor[d]));
+    }
+    // Sum the block of previous bins that make up this bin
+    do {
+      size_t previousIndex = previousFirst;
+      for (size_t d = 0; d < m_outD; d++)
+        previousIndex += previousMultiplier[d] * block[d];
+      signals[linearIndex] += previousSignals[previousIndex];
+      errors[linearIndex] += previousErrors[previousIndex];
+      numEvents[linearIndex] += previousNumEvents[previousIndex];
+    } while (!Utils::NestedForLoop::Increment(m_outD, block.data(), m_reuseFactor.data()));
+  } while (!Utils::NestedForLoop::Increment(m_outD, index.data(), m_reusedMax.data(), m_reusedMin.data()));
+}
+
+//----------------------------------------------------------------------------------------------
+/** Split the output bins that still need binning from the events into boxes
+ * that do not overlap. This is all the bins, or the bins around the box of
+ * bins reused from a previous output.
+ *
+ * @return the minimum (inclusive) and maximum (exclusive) bin index in each
+ *dimension of each region
+ */
+std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>> BinMD::regionsToBin() const {
+  std::vector<size_t> regionMin(m_outD, 0);
+  std::vector<size_t> regionMax(m_outD);
+  for (size_t d = 0; d < m_outD; d++)
+    regionMax[d] = m_binDimensions[d]->getNBins();
+  if (!m_previousWS)
+    return {{regionMin, regionMax}};
+
+  // The slabs below and above the reused bins in each dimension, limited to
+  // the reused bins in the dimensions before it so that they do not overlap
+  std::vector<std::pair<std::vector<size_t>, std::vector<size_t>>> regions;
+  for (size_t d = 0; d < m_outD; d++) {
+    const size_t bins = regionMax[d];
+    if (m_reusedMin[d] > 0) {
+      regionMin[d] = 0;
+      regionMax[d] = m_reusedMin[d];
+      regions.emplace_back(regionMin, regionMax);
+    }
+    if (m_reusedMax[d] < bins) {
+      regionMin[d] = m_reusedMax[d];
+      regionMax[d] = bins;
+      regions.emplace_back(regionMin, regionMax);
+    }
+    regionMin[d] = m_reusedMin[d];
+    regionMax[d] = m_reusedMax[d];
+  }
+  return regions;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add the cached signal of a whole box to one bin, if every vertex of the box
+ * is in that bin
+ *
+ * @param vertexes :: nd coordinates for each vertex of the box
+ * @param numVertexes :: the number of vertexes
+ * @param signal :: total signal of the box
+ * @param errorSquared :: total squared error of the box
+ * @param nPoints :: number of events in the box
  * @param chunkMin :: the minimum index in each dimension to consider "valid"
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @return true if the box was added; false if its events need to be binned
  */
-template <typename MDE, size_t nd>
-inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+template <size_t nd>
+bool BinMD::binWholeBox(const coord_t *vertexes, const size_t numVertexes, const signal_t signal,
+                        const signal_t errorSquared, const uint64_t nPoints, const size_t *const chunkMin,
+                        const size_t *const chunkMax) {
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
 
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
-    // There is a check that the number of events is enough for it to make sense
-    // to do all this processing.
-    size_t numVertexes = 0;
-    auto vertexes = box->getVertexesArray(numVertexes);
+  // All vertexes have to be within THE SAME BIN = have the same linear index.
+  size_t lastLinearIndex = 0;
+  bool badOne = false;
 
-    // All vertexes have to be within THE SAME BIN = have the same linear index.
-    size_t lastLinearIndex = 0;
-    bool badOne = false;
+  for (size_t i = 0; i < numVertexes; i++) {
+    // Cache the center of the event (again for speed)
+    const coord_t *inCenter = vertexes + i * nd;
 
-    for (size_t i = 0; i < numVertexes; i++) {
-      // Cache the center of the event (again for speed)
-      const coord_t *inCenter = vertexes.get() + i * nd;
-
-      // Now transform to the output dimensions
-      m_transform->apply(inCenter, outCenter.data());
-
-      // To build up the linear index
-      size_t linearIndex = 0;
-      // To mark VERTEXES outside range
-      badOne = false;
-
-      /// Loop through the dimensions on which we bin
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // What is the bin index in that dimension
-        coord_t x = outCenter[bd];
-        auto ix = size_t(x);
-        // Within range (for this chunk)?
-        if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-          // Build up the linear index
-          linearIndex += indexMultiplier[bd] * ix;
-        } else {
-          // Outside the range
-          badOne = true;
-          break;
-        }
-      } // (for each dim in MDHisto)
-
-      // Is the vertex at the same place as the last one?
-      if (!badOne) {
-        if ((i > 0) && (linearIndex != lastLinearIndex)) {
-          // Change of index
-          badOne = true;
-          break;
-        }
-        lastLinearIndex = linearIndex;
-      }
+    // Now transform to the output dimensions
+    m_transform->apply(inCenter, outCenter.data());
+
+    // To build up the linear index
+    size_t linearIndex = 0;
+    // To mark VERTEXES outside range
+    badOne = false;
 
-      // Was the vertex completely outside the range?
-      if (badOne)
+    /// Loop through the dimensions on which we bin
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      // What is the bin index in that dimension
+      coord_t x = outCenter[bd];
+      auto ix = size_t(x);
+      // Within range (for this chunk)?
+      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
+        // Build up the linear index
+        linearIndex += indexMultiplier[bd] * ix;
+      } else {
+        // Outside the range
+        badOne = true;
         break;
-    } // (for each vertex)
+      }
+    } // (for each dim in MDHisto)
 
+    // Is the vertex at the same place as the last one?
     if (!badOne) {
-      // Yes, the entire box is within a single bin
-      //        std::cout << "Box at " << box->getExtentsStr() << " is within a
-      //        single bin.\n";
-      // Add the CACHED signal from the entire box
-      signals[lastLinearIndex] += box->getSignal();
-      errors[lastLinearIndex] += box->getErrorSquared();
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[lastLinearIndex] += static_cast<signal_t>(box->getNPoints());
-
-      // And don't bother looking at each event. This may save lots of time
-      // loading from disk.
-      return;
+      if ((i > 0) && (linearIndex != lastLinearIndex)) {
+        // Change of index
+        badOne = true;
+        break;
+      }
+      lastLinearIndex = linearIndex;
     }
-  }
 
-  // If you get here, you could not determine that the entire box was in the
-  // same bin.
-  // So you need to iterate through events.
-  const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
+    // Was the vertex completely outside the range?
+    if (badOne)
+      break;
+  } // (for each vertex)
+
+  if (badOne)
+    return false;
+
+  // Yes, the entire box is within a single bin
+  // Add the CACHED signal from the entire box
+  signals[lastLinearIndex] += signal;
+  errors[lastLinearIndex] += errorSquared;
+  // TODO: If DataObjects get a weight, this would need to get the summed
+  // weight.
+  numEvents[lastLinearIndex] += static_cast<signal_t>(nPoints);
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin a range of events
+ *
+ * @param begin :: the first event
+ * @param end :: one past the last event
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ */
+template <typename MDE>
+inline void BinMD::binEvents(const MDE *begin, const MDE *end, const size_t *const chunkMin,
+                             const size_t *const chunkMax) {
+  // An array to hold the rotated/transformed coordinates
+  auto outCenter = std::vector<coord_t>(m_outD);
+
+  for (auto it = begin; it != end; ++it) {
     // Cache the center of the event (again for speed)
     const coord_t *inCenter = it->getCenter();
 
@@ -206,10 +402,134 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, c
       numEvents[linearIndex] += 1.0;
     }
   }
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin the contents of a MDBox
+ *
+ * @param box :: pointer to the MDBox to bin
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ */
+template <typename MDE, size_t nd>
+inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin, const size_t *const chunkMax) {
+  // Evaluate whether the entire box is in the same bin
+  if (box->getNPoints() > (1 << nd) * 2) {
+    // There is a check that the number of events is enough for it to make sense
+    // to do all this processing.
+    size_t numVertexes = 0;
+    auto vertexes = box->getVertexesArray(numVertexes);
+    // And don't bother looking at each event. This may save lots of time
+    // loading from disk.
+    if (binWholeBox<nd>(vertexes.get(), numVertexes, box->getSignal(), box->getErrorSquared(), box->getNPoints(),
+                    chunkMin, chunkMax))
+      return;
+  }
+
+  // If you get here, you could not determine that the entire box was in the
+  // same bin.
+  // So you need to iterate through events.
+  const std::vector<MDE> &events = box->getConstEvents();
+  binEvents(events.data(), events.data() + events.size(), chunkMin, chunkMax);
   // Done with the events list
   box->releaseEvents();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Find the bin that a whole box can be added to, from its cached signal and
+ * error. That is either the bin holding all of its vertexes or, if the box is
+ * no wider than m_levelOfDetailTolerance bins in any output dimension, the bin
+ * of its centroid.
+ *
+ * @param box :: the box
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @param[out] linearIndex :: the bin to add the box to, if in this chunk
+ * @param[out] inChunk :: false if the box is added to a bin of another chunk,
+ *or to none
+ * @return true if the box can be added whole
+ */
+template <typename MDE, size_t nd>
+bool BinMD::findWholeBoxBin(const MDBoxBase<MDE, nd> &box, const size_t *const chunkMin, const size_t *const chunkMax,
+                            size_t &linearIndex, bool &inChunk) {
+  // The range of the box in the output, in bins
+  std::vector<coord_t> outMin(m_outD, std::numeric_limits<coord_t>::max());
+  std::vector<coord_t> outMax(m_outD, std::numeric_limits<coord_t>::lowest());
+  std::vector<coord_t> outCenter(m_outD);
+  size_t numVertexes = 0;
+  const auto vertexes = box.getVertexesArray(numVertexes);
+  for (size_t i = 0; i < numVertexes; i++) {
+    m_transform->apply(vertexes.get() + i * nd, outCenter.data());
+    for (size_t bd = 0; bd < m_outD; bd++) {
+      outMin[bd] = std::min(outMin[bd], outCenter[bd]);
+      outMax[bd] = std::max(outMax[bd], outCenter[bd]);
+    }
+  }
+
+  bool oneBin = true;
+  bool narrow = m_levelOfDetailTolerance > 0.;
+  for (size_t bd = 0; bd < m_outD; bd++) {
+    oneBin = oneBin && outMin[bd] >= 0 && std::floor(outMin[bd]) == std::floor(outMax[bd]);
+    narrow = narrow && outMax[bd] - outMin[bd] <= m_levelOfDetailTolerance;
+  }
+  if (!oneBin && !narrow)
+    return false;
+
+  if (!oneBin) {
+    // The centroid, kept within the box in case of signals of both signs
+    // (the first and last vertexes are the minimum and maximum corners)
+    const coord_t *boxMin = vertexes.get();
+    const coord_t *boxMax = vertexes.get() + (numVertexes - 1) * nd;
+    std::vector<coord_t> centroid(box.getCentroid(), box.getCentroid() + nd);
+    for (size_t d = 0; d < nd; d++)
+      centroid[d] = std::clamp(centroid[d], boxMin[d], boxMax[d]);
+    m_transform->apply(centroid.data(), outCenter.data());
+    outMin = outCenter;
+  }
+
+  linearIndex = 0;
+  inChunk = true;
+  for (size_t bd = 0; bd < m_outD; bd++) {
+    const coord_t x = outMin[bd];
+    const auto ix = size_t(x);
+    if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd]))
+      linearIndex += indexMultiplier[bd] * ix;
+    else
+      inChunk = false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add a box offered by MDBoxBase::getBoxesAtLevelOfDetail whole, if it can
+ * be.
+ *
+ * @param box :: the box
+ * @param chunkMin :: the minimum index in each dimension to consider "valid"
+ *(inclusive)
+ * @param chunkMax :: the maximum index in each dimension to consider "valid"
+ *(exclusive)
+ * @return true if the box was taken whole, possibly for a bin of another chunk
+ */
+template <typename MDE, size_t nd>
+bool BinMD::binBoxAtLevelOfDetail(const MDBoxBase<MDE, nd> &box, const size_t *const chunkMin,
+                                  const size_t *const chunkMax) {
+  size_t linearIndex = 0;
+  bool inChunk = false;
+  if (!findWholeBoxBin(box, chunkMin, chunkMax, linearIndex, inChunk))
+    return false;
+  if (inChunk) {
+    signals[linearIndex] += box.getSignal();
+    errors[linearIndex] += box.getErrorSquared();
+    numEvents[linearIndex] += static_cast<signal_t>(box.getNPoints());
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform binning by iterating through every event and placing them in the
  *output workspace
@@ -240,6 +560,9 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
     // Start with signal/error/numEvents at 0.0
     outWS->setTo(0.0, 0.0, 0.0);
   }
+  if (m_previousWS)
+    copyReusedBins();
+  const auto regions = regionsToBin();
 
   // The dimension (in the output workspace) along which we chunk for parallel
   // processing
@@ -260,6 +583,13 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
   if (!doParallel)
     chunkNumBins = int(m_binDimensions[chunkDimension]->getNBins());
 
+  const bool levelOfDetail = getProperty("LevelOfDetail");
+  m_levelOfDetailTolerance = getProperty("LevelOfDetailTolerance");
+  // The boxes with a masked box under them, found once for all the chunks
+  std::vector<bool> maskedBoxes;
+  if (levelOfDetail)
+    ws->getBox()->findMaskedBoxes(maskedBoxes);
+
   // Total number of steps
   size_t progNumSteps = 0;
   if (prog) {
@@ -273,58 +603,75 @@ template <typename MDE, size_t nd> void BinMD::binByIterating(typename MDEventWo
     PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
     for (int chunk = 0; chunk < int(m_binDimensions[chunkDimension]->getNBins()); chunk += chunkNumBins) {
       PARALLEL_START_INTERRUPT_REGION
-      // Region of interest for this chunk.
-      std::vector<size_t> chunkMin(m_outD);
-      std::vector<size_t> chunkMax(m_outD);
-      for (size_t bd = 0; bd < m_outD; bd++) {
-        // Same limits in the other dimensions
-        chunkMin[bd] = 0;
-        chunkMax[bd] = m_binDimensions[bd]->getNBins();
-      }
-      // Parcel out a chunk in that single dimension dimension
-      chunkMin[chunkDimension] = size_t(chunk);
-      if (size_t(chunk + chunkNumBins) > m_binDimensions[chunkDimension]->getNBins())
-        chunkMax[chunkDimension] = m_binDimensions[chunkDimension]->getNBins();
-      else
-        chunkMax[chunkDimension] = size_t(chunk + chunkNumBins);
-
-      // Build an implicit function (it needs to be in the space of the
-      // MDEventWorkspace)
-      auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
-
-      // Use getBoxes() to get an array with a pointer to each box
-      std::vector<API::IMDNode *> boxes;
-      // Leaf-only; no depth limit; with the implicit function passed to it.
-      ws->getBox()->getBoxes(boxes, 1000, true, function.get());
-
-      // Sort boxes by file position IF file backed. This reduces seeking time,
-      // hopefully.
-      if (bc->isFileBacked())
-        API::IMDNode::sortObjByID(boxes);
-
-      // For progress reporting, the # of boxes
-      if (prog) {
-        PARALLEL_CRITICAL(BinMD_progress) {
-          g_log.debug() << "Chunk " << chunk << ": found " << boxes.size() << " boxes within the implicit function.\n";
-          progNumSteps += boxes.size();
-          prog->setNumSteps(progNumSteps);
+      for (const auto &region : regions) {
+        // Region of interest for this chunk.
+        std::vector<size_t> chunkMin(region.first);
+        std::vector<size_t> chunkMax(region.second);
+        // Parcel out a chunk in that single dimension dimension
+        chunkMin[chunkDimension] = std::max(chunkMin[chunkDimension], size_t(chunk));
+        chunkMax[chunkDimension] = std::min(chunkMax[chunkDimension], size_t(chunk + chunkNumBins));
+        if (chunkMin[chunkDimension] >= chunkMax[chunkDimension])
+          continue;
+
+        // Build an implicit function (it needs to be in the space of the
+        // MDEventWorkspace)
+        auto function = this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data());
+
+        std::vector<API::IMDNode *> boxes;
+        std::vector<MDBoxBase<MDE, nd> *> lodBoxes;
+        if (levelOfDetail) {
+          // Add the largest boxes that can be added whole, and get the leaves of the rest
+          ws->getBox()->getBoxesAtLevelOfDetail(
+              lodBoxes,
+              [&](const MDBoxBase<MDE, nd> &box) {
+                return this->binBoxAtLevelOfDetail(box, chunkMin.data(), chunkMax.data());
+              },
+              function.get(), &maskedBoxes);
+        } else {
+          // Use getBoxes() to get an array with a pointer to each box
+          // Leaf-only; no depth limit; with the implicit function passed to it.
+          ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+
+          // Sort boxes by file position IF file backed. This reduces seeking time,
+          // hopefully.
+          if (bc->isFileBacked())
+            API::IMDNode::sortObjByID(boxes);
+        }
+        const size_t numBoxes = levelOfDetail ? lodBoxes.size() : boxes.size();
+
+        // For progress reporting, the # of boxes
+        if (prog) {
+          PARALLEL_CRITICAL(BinMD_progress) {
+            g_log.debug() << "Chunk " << chunk << ": found " << numBoxes << " boxes within the implicit function.\n";
+            progNumSteps += numBoxes;
+            prog->setNumSteps(progNumSteps);
+          }
         }
-      }
 
-      // Go through every box for this chunk.
-      for (auto &boxe : boxes) {
-        auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
-        // Perform the binning in this separate method.
-        if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
-
-        // Progress reporting
-        if (prog)
-          prog->report();
-        // For early cancelling of the loop
-        if (this->m_cancel)
-          break;
-      } // for each box in the vector
+        // Go through every box for this chunk.
+        for (size_t i = 0; i < numBoxes; ++i) {
+          // Perform the binning in this separate method.
+          if (levelOfDetail) {
+            auto *leaf = dynamic_cast<MDBox<MDE, nd> *>(lodBoxes[i]);
+            if (leaf && !leaf->getIsMasked()) {
+              const std::vector<MDE> &events = leaf->getConstEvents();
+              binEvents(events.data(), events.data() + events.size(), chunkMin.data(), chunkMax.data());
+              leaf->releaseEvents();
+            }
+          } else {
+            auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+            if (box && !box->getIsMasked())
+              this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          }
+
+          // Progress reporting
+          if (prog)
+            prog->report();
+          // For early cancelling of the loop
+          if (this->m_cancel)
+            break;
+        } // for each box in the vector
+      } // for each region to bin
       PARALLEL_END_INTERRUPT_REGION
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERRUPT_REGION
@@ -367,6 +714,19 @@ void BinMD::exec() {
     m_accumulate = true;
   }
 
+  // Reuse the bins of a previous output where possible
+  m_previousWS = nullptr;
+  std::shared_ptr<IMDHistoWorkspace> previous = this->getProperty("PreviousOutputWorkspace");
+  auto previousWS = std::dynamic_pointer_cast<const MDHistoWorkspace>(previous);
+  if (previousWS && !m_accumulate && !implicitFunction) {
+    if (findReusedBins(*previousWS))
+      m_previousWS = previousWS;
+    else
+      g_log.information() << "The bins of " << previousWS->getName()
+                           << " do not line up with the output, or cannot be verified to be current, so none "
+                              "of them are reused.\n";
+  }
+
   // Saves the geometry transformation from original to binned in the workspace
   outWS->setTransformFromOriginal(this->m_transformFromOriginal.release(), 0);
   outWS->setTransformToOriginal(this->m_transformToOriginal.release(), 0);
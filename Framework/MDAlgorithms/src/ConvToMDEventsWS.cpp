@@ -7,6 +7,7 @@
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
 #include "MantidAPI/Run.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
 namespace Mantid::MDAlgorithms {
@@ -52,24 +53,46 @@ template <class T> size_t ConvToMDEventsWS::convertEventList(size_t workspaceInd
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
-  // Iterators to start/end
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    double val = localUnitConv.convertUnits(it->tof());
-    double signal = it->weight();
-    double errorSq = it->errorSquared();
-    if (!setGoniometersFromLogs(it))
-      continue; // skip if log value is NaN
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
-      continue; // skip ND outside the range
-
-    sig_err.emplace_back(static_cast<float>(signal));
-    sig_err.emplace_back(static_cast<float>(errorSq));
-    expInfoIndex.emplace_back(expInfoIndexLoc);
-    goniometer_index.emplace_back(0); // default value
-    det_ids.emplace_back(detID);
-    allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+  if (m_useLogTimes) {
+    // The goniometer may change from event to event, so convert one at a time
+    for (auto it = events.cbegin(); it != events.cend(); it++) {
+      double val = localUnitConv.convertUnits(it->tof());
+      double signal = it->weight();
+      double errorSq = it->errorSquared();
+      if (!setGoniometersFromLogs(it))
+        continue; // skip if log value is NaN
+      if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+        continue; // skip ND outside the range
+
+      sig_err.emplace_back(static_cast<float>(signal));
+      sig_err.emplace_back(static_cast<float>(errorSq));
+      allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+    }
+  } else {
+    // Convert the whole spectrum in one batch
+    std::vector<double> vals(numEvents), signal(numEvents), errorSq(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+      vals[i] = events[i].tof();
+      signal[i] = events[i].weight();
+      errorSq[i] = events[i].errorSquared();
+    }
+    localUnitConv.convertUnits(vals);
+    std::vector<char> inRange;
+    m_QConverter->calcMatrixCoords(vals, locCoord, signal, errorSq, allCoord, inRange);
+    for (size_t i = 0; i < numEvents; ++i) {
+      if (!inRange[i])
+        continue; // skip ND outside the range
+      sig_err.emplace_back(static_cast<float>(signal[i]));
+      sig_err.emplace_back(static_cast<float>(errorSq[i]));
+    }
   }
 
+  // All events of the list share the experiment-info index and detector
+  const size_t numAdded = sig_err.size() / 2;
+  expInfoIndex.assign(numAdded, expInfoIndexLoc);
+  goniometer_index.assign(numAdded, 0); // default value
+  det_ids.assign(numAdded, detID);
+
   // Add them to the MDEW
   size_t n_added_events = expInfoIndex.size();
   m_OutWSWrapper->addMDData(sig_err, expInfoIndex, goniometer_index, det_ids, allCoord, n_added_events);
@@ -159,7 +182,7 @@ void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const A
   size_t lastNumBoxes = bc->getTotalNumMDBoxes();
   size_t nEventsInWS = m_OutWSWrapper->pWorkspace()->getNPoints();
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadSchedulerWorkStealing *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
@@ -170,7 +193,9 @@ void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const A
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
     // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    // Splitting a box queues the splitting of its children, so each thread
+    // keeps to its own part of the tree and idle threads steal the rest
+    ts = new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(nThreads));
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(m_NSpectra, 0, 1);
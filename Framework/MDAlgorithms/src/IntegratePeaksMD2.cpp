@@ -22,6 +22,7 @@
 #include "MantidDataObjects/LeanElasticPeaksWorkspace.h"
 #include "MantidDataObjects/MDBoxIterator.h"
 #include "MantidDataObjects/MDEventFactory.h"
+#include "MantidDataObjects/MortonIndex/BitInterleaving.h"
 #include "MantidDataObjects/Peak.h"
 #include "MantidDataObjects/PeakShapeEllipsoid.h"
 #include "MantidDataObjects/PeakShapeSpherical.h"
@@ -41,9 +42,12 @@
 
 #include "boost/math/distributions.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <gsl/gsl_integration.h>
+#include <limits>
+#include <numeric>
 
 namespace Mantid::MDAlgorithms {
 
@@ -57,6 +61,61 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 
+namespace {
+/** Order points along a Morton (Z-order) curve, so that points next to each
+ * other in the order are close to each other in space
+ * @param positions :: the points
+ * @param min :: minimum of the region holding the points
+ * @param max :: maximum of the region
+ * @return the indexes of the points in curve order
+ */
+std::vector<int> mortonOrder(const std::vector<V3D> &positions, const V3D &min, const V3D &max) {
+  std::vector<std::pair<uint64_t, int>> keys(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    morton_index::IntArray<3, uint16_t> cell;
+    for (size_t d = 0; d < 3; ++d) {
+      const double range = max[d] - min[d];
+      const double fraction = range > 0. ? std::clamp((positions[i][d] - min[d]) / range, 0., 1.) : 0.;
+      cell[d] = static_cast<uint16_t>(fraction * std::numeric_limits<uint16_t>::max());
+    }
+    keys[i] = {morton_index::interleave<3, uint16_t, uint64_t>(cell), static_cast<int>(i)};
+  }
+  std::sort(keys.begin(), keys.end());
+  std::vector<int> order;
+  order.reserve(keys.size());
+  std::transform(keys.cbegin(), keys.cend(), std::back_inserter(order), [](const auto &key) { return key.second; });
+  return order;
+}
+
+/** Find the deepest box that holds the whole of a sphere. Integrating the
+ * sphere from there gives the same result as from the top of the tree, but
+ * does not test the vertexes of the boxes above it.
+ * @param root :: the top box of the workspace
+ * @param center :: centre of the sphere
+ * @param radius :: radius of the sphere
+ * @return the box, which is root if the sphere is not inside the workspace
+ */
+const IMDNode *findBoxHoldingSphere(IMDNode *root, const coord_t *center, const double radius) {
+  const size_t nd = root->getNumDims();
+  auto holdsSphere = [center, radius, nd](const IMDNode &box) {
+    size_t numVertexes = 0;
+    const auto vertexes = box.getVertexesArray(numVertexes);
+    // The first and last vertexes are the minimum and maximum corners
+    for (size_t d = 0; d < nd; ++d) {
+      if (center[d] - radius < vertexes[d] || center[d] + radius > vertexes[(numVertexes - 1) * nd + d])
+        return false;
+    }
+    return true;
+  };
+  if (!holdsSphere(*root))
+    return root;
+  const IMDNode *box = root->getBoxAtCoord(center);
+  while (box && box != root && !holdsSphere(*box))
+    box = box->getParent();
+  return box ? box : root;
+}
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void IntegratePeaksMD2::init() {
@@ -467,10 +526,35 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
   Progress progress(this, 0., 1., nPeaks);
   int zeroHKLCount = 0;
   bool doParallel = cylinderBool ? false : Kernel::threadSafe(*ws, *peakWS);
+  // Integrate the peaks in the order of their positions along a Morton curve,
+  // so that each thread's share of the loop is a compact region of the
+  // workspace and neighbouring peaks read the same boxes one after the other.
+  // The cylinder profiles are written to file in peak order, so keep it there.
+  std::vector<int> peakOrder(nPeaks);
+  std::iota(peakOrder.begin(), peakOrder.end(), 0);
+  if (!cylinderBool && CoordinatesToUse != Mantid::Kernel::None) {
+    std::vector<V3D> positions(nPeaks);
+    for (int i = 0; i < nPeaks; ++i) {
+      const IPeak &p = peakWS->getPeak(i);
+      if (CoordinatesToUse == Mantid::Kernel::QLab)
+        positions[i] = p.getQLabFrame();
+      else if (CoordinatesToUse == Mantid::Kernel::QSample)
+        positions[i] = p.getQSampleFrame();
+      else
+        positions[i] = p.getHKL();
+    }
+    V3D wsMin, wsMax;
+    for (size_t d = 0; d < 3; ++d) {
+      wsMin[d] = ws->getDimension(d)->getMinimum();
+      wsMax[d] = ws->getDimension(d)->getMaximum();
+    }
+    peakOrder = mortonOrder(positions, wsMin, wsMax);
+  }
   PARALLEL_SET_CONFIG_THREADS PRAGMA_OMP(parallel for if(doParallel) reduction(+:zeroHKLCount))
-  for (int i = 0; i < nPeaks; ++i) {
+  for (int n = 0; n < nPeaks; ++n) {
     PARALLEL_START_INTERRUPT_REGION
     progress.report();
+    const int i = peakOrder[n];
 
     // Get a direct ref to that peak.
     IPeak &p = peakWS->getPeak(i);
@@ -548,6 +632,9 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
                                        *std::max_element(BackgroundOuterRadius.begin(), BackgroundOuterRadius.end());
       // define the radius squared for a sphere intially
       CoordTransformDistance getRadiusSq(nd, center, dimensionsUsed);
+      // the spheres around this peak are all within this box
+      const IMDNode *sphereBox = findBoxHoldingSphere(
+          ws->getBox(), center, std::max(PeakRadiusVector[i], BackgroundOuterRadiusVector[i]));
       // set spherical shape
       PeakShape *sphereShape =
           new PeakShapeSpherical(PeakRadiusVector[i], BackgroundInnerRadiusVector[i], BackgroundOuterRadiusVector[i],
@@ -558,7 +645,7 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
       // Integrate spherical background shell if specified
       if (BackgroundOuterRadius[0] > PeakRadius[0]) {
         // Get the total signal inside background shell
-        ws->getBox()->integrateSphere(
+        sphereBox->integrateSphere(
             getRadiusSq, static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)), bgSignal, bgErrorSquared,
             static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)), useOnePercentBackgroundCorrection);
         // correct bg signal by Vpeak/Vshell (same for sphere and ellipse)
@@ -703,9 +790,10 @@ template <typename MDE, size_t nd> void IntegratePeaksMD2::integrate(typename MD
           p.setPeakShape(ellipsoidShape);
         }
       }
-      ws->getBox()->integrateSphere(getRadiusSq, static_cast<coord_t>(PeakRadiusVector[i] * PeakRadiusVector[i]),
-                                    signal, errorSquared, 0.0 /* innerRadiusSquared */,
-                                    useOnePercentBackgroundCorrection);
+      // an ellipsoid may reach outside sphereBox
+      const IMDNode *peakBox = integrateAsEllipse ? ws->getBox() : sphereBox;
+      peakBox->integrateSphere(getRadiusSq, static_cast<coord_t>(PeakRadiusVector[i] * PeakRadiusVector[i]), signal,
+                               errorSquared, 0.0 /* innerRadiusSquared */, useOnePercentBackgroundCorrection);
       //
     } else {
       CoordTransformDistance cylinder(nd, center, dimensionsUsed, 2);
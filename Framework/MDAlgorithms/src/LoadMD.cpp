@@ -14,6 +14,7 @@
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
+#include "MantidDataObjects/MDBoxSlabIO.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidGeometry/MDGeometry/IMDDimension.h"
@@ -543,21 +544,10 @@ template <typename MDE, size_t nd> void LoadMD::doLoad(typename MDEventWorkspace
 
     const std::vector<uint64_t> &BoxEventIndex = FlatBoxTree.getEventIndex();
     prog->setNumSteps(numBoxes);
-    std::vector<coord_t> boxTemp;
-
-    for (size_t i = 0; i < numBoxes; i++) {
-      prog->report();
-      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]);
-      if (!box)
-        continue;
-
-      if (BoxEventIndex[2 * i + 1] > 0) // Load in memory NOT using the file as the back-end,
-      {
-        boxTree[i]->reserveMemoryForLoad(BoxEventIndex[2 * i + 1]);
-        boxTree[i]->loadAndAddFrom(loader.get(), BoxEventIndex[2 * i], static_cast<size_t>(BoxEventIndex[2 * i + 1]),
-                                   boxTemp);
-      }
-    }
+    // Load in memory NOT using the file as the back-end, reading the boxes in
+    // large slabs and converting the events of each slab in parallel while
+    // the next one is read
+    MDBoxSlabIO<MDE, nd>(*loader).load(boxTree, BoxEventIndex, prog.get());
     loader->closeFile();
   } else // box structure and metadata only
   {
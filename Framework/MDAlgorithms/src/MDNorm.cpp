@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/MDNorm.h"
+#include "MantidMDAlgorithms/MDNormGrid.h"
 #include "MantidAPI/CommonBinsValidator.h"
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/InstrumentValidator.h"
@@ -45,6 +46,33 @@ using VectorDoubleProperty = Kernel::PropertyWithValue<std::vector<double>>;
 // function to  compare two intersections (h,k,l,Momentum) by Momentum
 bool compareMomentum(const std::array<double, 4> &v1, const std::array<double, 4> &v2) { return (v1[3] < v2[3]); }
 
+/** Sort intersections by momentum. The intersections with each family of
+ * planes are found in order along the trajectory, so rather than sorting from
+ * scratch each run is put in ascending order and merged into those before it,
+ * through a buffer that each thread keeps between detectors.
+ * @param intersections :: the intersections, sorted on return
+ * @param runEnds :: the end of each run of intersections, in order
+ */
+template <size_t N>
+void sortIntersectionRuns(std::vector<std::array<double, 4>> &intersections, const std::array<size_t, N> &runEnds) {
+  thread_local std::vector<std::array<double, 4>> merged;
+  size_t runStart = 0;
+  for (const size_t runEnd : runEnds) {
+    if (runEnd == runStart)
+      continue;
+    const auto first = intersections.begin() + runStart;
+    const auto last = intersections.begin() + runEnd;
+    if (compareMomentum(*(last - 1), *first))
+      std::reverse(first, last);
+    if (runStart > 0) {
+      merged.clear();
+      std::merge(intersections.begin(), first, first, last, std::back_inserter(merged), compareMomentum);
+      std::copy(merged.cbegin(), merged.cend(), intersections.begin());
+    }
+    runStart = runEnd;
+  }
+}
+
 // k=sqrt(energyToK * E)
 constexpr double energyToK = 8.0 * M_PI * M_PI * PhysicalConstants::NeutronMass * PhysicalConstants::meV * 1e-20 /
                              (PhysicalConstants::h * PhysicalConstants::h);
@@ -445,6 +473,9 @@ std::map<std::string, std::string> MDNorm::validateInputs() {
 /** Execute the algorithm.
  */
 void MDNorm::exec() {
+  // Detector values are only shared within one execution; the workspaces may
+  // be changed in place between executions
+  m_detectorCache.clear();
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   // symmetry operations
   std::string symOps = this->getProperty("SymmetryOperations");
@@ -537,6 +568,7 @@ void MDNorm::exec() {
     // if more than one experiment info, keep accumulating
     m_accumulate = true;
   }
+  m_detectorCache.clear();
 
   API::IMDWorkspace_sptr out(nullptr);
 
@@ -1381,6 +1413,7 @@ inline void MDNorm::calcDiffractionIntersectionIntegral(std::vector<std::array<d
  * @param vmdDims: MD dimensions
  * @param pos: position from intersecton for memory efficiency
  * @param posNew: transformed positions
+ * @param thread: number of the calling thread
  * @param signalArray: (output) normalization
  * @param solidBkgd: background proton charge
  * @param bkgdSignalArray: (output) background normalization
@@ -1388,8 +1421,8 @@ inline void MDNorm::calcDiffractionIntersectionIntegral(std::vector<std::array<d
 inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double, 4>> &intersections, const double &solid,
                                            std::vector<double> &yValues, const size_t &vmdDims,
                                            std::vector<coord_t> &pos, std::vector<coord_t> &posNew,
-                                           std::vector<std::atomic<signal_t>> &signalArray, const double &solidBkgd,
-                                           std::vector<std::atomic<signal_t>> &bkgdSignalArray) {
+                                           const size_t thread, MDNormGrid &signalArray, const double &solidBkgd,
+                                           MDNormGrid &bkgdSignalArray) {
 
   auto intersectionsBegin = intersections.begin();
   for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
@@ -1448,10 +1481,10 @@ inline void MDNorm::calcSingleDetectorNorm(const std::vector<std::array<double,
 
     // Set to output
     // set the calculated signal to
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal, std::plus<signal_t>());
+    signalArray.add(thread, linIndex, signal);
     // [Task 89]
     if (m_backgroundWS)
-      Mantid::Kernel::AtomicOp(bkgdSignalArray[linIndex], bkgdSignal, std::plus<signal_t>());
+      bkgdSignalArray.add(thread, linIndex, bkgdSignal);
   }
   return;
 }
@@ -1483,30 +1516,25 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   const double protonChargeBkgd =
       (m_backgroundWS != nullptr) ? m_backgroundWS->getExperimentInfo(0)->run().getProtonCharge() : 0;
 
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mappings: solid angle and flux workspaces' detector to ws_index map
-  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
+  // Angles, flux and solid angle indices of the detectors; the same for every
+  // symmetry operation and usually for every run
   API::MatrixWorkspace_const_sptr solidAngleWS = getProperty("SolidAngleWorkspace");
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-  }
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
-  const detid2index_map solidAngDetToIdx =
-      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
-  const detid2index_map fluxDetToIdx =
-      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
+  const auto detectors = m_detectorCache.get(m_inputWS->getExperimentInfo(expInfoIndex), m_samplePos, m_beamDir,
+                                             m_diffraction ? integrFlux : nullptr, solidAngleWS);
+  const auto ndets = static_cast<int64_t>(detectors->size());
 
   // Define dimension, signal array
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
+  // Each thread adds into its own grid where memory allows
+  const auto numThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  MDNormGrid signalArray(m_normWS->getNPoints(), numThreads);
 
   size_t numNPoints = (m_backgroundWS) ? m_bkgdNormWS->getNPoints() : 0;
   if (m_backgroundWS && numNPoints != m_normWS->getNPoints()) {
     throw std::runtime_error("N points are different");
   }
-  std::vector<std::atomic<signal_t>> bkgdSignalArray(numNPoints);
+  MDNormGrid bkgdSignalArray(numNPoints, numThreads);
 
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
@@ -1520,54 +1548,32 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues, con
   // muliple threading
   bool safe = m_diffraction ? Kernel::threadSafe(*integrFlux) : true;
 
-PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (safe))
+PRAGMA_OMP(parallel for schedule(dynamic, 256) private(intersections, xValues, yValues, pos, posNew) if (safe))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERRUPT_REGION
 
-  // Skip: non-existing detector, monitor and masked detector
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i)) {
+  // Skip: non-existing detector, monitor, masked detector and detector
+  // masked in flux, but not in input workspace
+  const auto &spectrum = (*detectors)[i];
+  if (!spectrum.use)
     continue;
-  }
-
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
-  // get the flux spectrum number: this is for diffraction only!
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
-      continue;
-    }
-  }
 
   // Intersections for sample and background if present
-  this->calculateIntersections(intersections, theta, phi, Qtransform, lowValues[i], highValues[i]);
+  this->calculateIntersections(intersections, spectrum.twoTheta, spectrum.phi, Qtransform, lowValues[i],
+                               highValues[i]);
 
   // No need to do normalization calculation if there is no intersection
   if (intersections.empty())
     continue;
 
   // Get solid angle for this contribution
-  double solid = protonCharge;
+  const double solid = spectrum.solidAngle * protonCharge;
   // [Task 89]
-  double bkgdSolid = protonChargeBkgd;
-  if (haveSA) {
-    double solid_angle_factor = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0];
-    //  solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0]
-    solid = solid_angle_factor * protonCharge;
-    // [Task 89]
-    bkgdSolid = solid_angle_factor * protonChargeBkgd;
-  }
+  const double bkgdSolid = spectrum.solidAngle * protonChargeBkgd;
 
   if (m_diffraction) {
     // -- calculate integrals for the intersection --
-    calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, wsIdx);
+    calcDiffractionIntersectionIntegral(intersections, xValues, yValues, *integrFlux, spectrum.fluxIndex);
   }
 
   // Compute final position in HKL
@@ -1575,30 +1581,19 @@ for (int64_t i = 0; i < ndets; i++) {
   pos.resize(vmdDims + otherValues.size());
   std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
 
-  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, signalArray, bkgdSolid,
-                         bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
+  calcSingleDetectorNorm(intersections, solid, yValues, vmdDims, pos, posNew, PARALLEL_THREAD_NUMBER, signalArray,
+                         bkgdSolid, bkgdSignalArray); // [Task 89] ADD solidBkgd, bkgdYValues, bkgdSignalArray
 
   prog->report();
 
   PARALLEL_END_INTERRUPT_REGION
 }
 PARALLEL_CHECK_INTERRUPT_REGION
-if (m_accumulate) {
-  std::transform(signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(), m_normWS->mutableSignalArray(),
-                 [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-  // [Task 89] Process background
-  if (m_backgroundWS)
-    std::transform(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->getSignalArray(),
-                   m_bkgdNormWS->mutableSignalArray(),
-                   [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-
-} else {
-  // First time, init
-  std::copy(signalArray.cbegin(), signalArray.cend(), m_normWS->mutableSignalArray());
-  // [Task 89]
-  if (m_backgroundWS)
-    std::copy(bkgdSignalArray.cbegin(), bkgdSignalArray.cend(), m_bkgdNormWS->mutableSignalArray());
-}
+// Add to the normalization, or initialize it the first time
+signalArray.writeTo(m_normWS->mutableSignalArray(), m_accumulate);
+// [Task 89] Process background
+if (m_backgroundWS)
+  bkgdSignalArray.writeTo(m_bkgdNormWS->mutableSignalArray(), m_accumulate);
 m_accumulate = true;
 }
 
@@ -1647,6 +1642,8 @@ void MDNorm::calculateIntersections(std::vector<std::array<double, 4>> &intersec
   auto eNBins = m_eX.size();
   intersections.clear();
   intersections.reserve(hNBins + kNBins + lNBins + eNBins + 2);
+  // where the intersections with each family of planes, and each endpoint, end
+  std::array<size_t, 6> runEnds{};
 
   // calculate intersections with planes perpendicular to h
   if (fabs(hStart - hEnd) > eps) {
@@ -1668,6 +1665,7 @@ void MDNorm::calculateIntersections(std::vector<std::array<double, 4>> &intersec
       }
     }
   }
+  runEnds[0] = intersections.size();
   // calculate intersections with planes perpendicular to k
   if (fabs(kStart - kEnd) > eps) {
     double fmom = (kfmax - kfmin) / (kEnd - kStart);
@@ -1688,6 +1686,7 @@ void MDNorm::calculateIntersections(std::vector<std::array<double, 4>> &intersec
       }
     }
   }
+  runEnds[1] = intersections.size();
 
   // calculate intersections with planes perpendicular to l
   if (fabs(lStart - lEnd) > eps) {
@@ -1707,6 +1706,7 @@ void MDNorm::calculateIntersections(std::vector<std::array<double, 4>> &intersec
       }
     }
   }
+  runEnds[2] = intersections.size();
   // intersections with dE
   if (!m_dEIntegrated) {
     for (size_t i = 0; i < eNBins; i++) {
@@ -1722,19 +1722,22 @@ void MDNorm::calculateIntersections(std::vector<std::array<double, 4>> &intersec
       }
     }
   }
+  runEnds[3] = intersections.size();
 
   // endpoints
   if ((hStart >= m_hX[0]) && (hStart <= m_hX[hNBins - 1]) && (kStart >= m_kX[0]) && (kStart <= m_kX[kNBins - 1]) &&
       (lStart >= m_lX[0]) && (lStart <= m_lX[lNBins - 1])) {
     intersections.push_back({{hStart, kStart, lStart, kfmin}});
   }
+  runEnds[4] = intersections.size();
   if ((hEnd >= m_hX[0]) && (hEnd <= m_hX[hNBins - 1]) && (kEnd >= m_kX[0]) && (kEnd <= m_kX[kNBins - 1]) &&
       (lEnd >= m_lX[0]) && (lEnd <= m_lX[lNBins - 1])) {
     intersections.push_back({{hEnd, kEnd, lEnd, kfmax}});
   }
+  runEnds[5] = intersections.size();
 
   // sort intersections by final momentum
-  std::stable_sort(intersections.begin(), intersections.end(), compareMomentum);
+  sortIntersectionRuns(intersections, runEnds);
 }
 
 /**
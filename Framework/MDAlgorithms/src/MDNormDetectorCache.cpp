@@ -0,0 +1,129 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/MDNormDetectorCache.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+
+namespace Mantid::MDAlgorithms {
+using Kernel::V3D;
+
+namespace {
+/// Most sets of spectra kept at once
+constexpr size_t MAX_CACHED = 4;
+
+/// @return true if a weak pointer was made from the same shared pointer, or both are empty
+template <typename T> bool sameObject(const std::weak_ptr<const T> &weak, const std::shared_ptr<const T> &shared) {
+  return !weak.owner_before(shared) && !shared.owner_before(weak);
+}
+
+/// Work out the values for every spectrum
+std::vector<MDNormDetectorCache::Spectrum> makeSpectra(const API::ExperimentInfo &exptInfo, const V3D &samplePos,
+                                                       const V3D &beamDir, const API::MatrixWorkspace *flux,
+                                                       const API::MatrixWorkspace *solidAngle) {
+  const auto &spectrumInfo = exptInfo.spectrumInfo();
+  const detid2index_map fluxDetToIdx = flux ? flux->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
+  const detid2index_map solidAngDetToIdx =
+      solidAngle ? solidAngle->getDetectorIDToWorkspaceIndexMap() : detid2index_map();
+
+  std::vector<MDNormDetectorCache::Spectrum> spectra(spectrumInfo.size());
+  const auto numberOfSpectra = static_cast<int64_t>(spectrumInfo.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    // Skip: non-existing detector, monitor and masked detector
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i))
+      continue;
+    auto &spectrum = spectra[i];
+    const auto &detector = spectrumInfo.detector(i);
+    spectrum.twoTheta = detector.getTwoTheta(samplePos, beamDir);
+    spectrum.phi = detector.getPhi();
+    // If the detector is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+    if (flux) {
+      const auto index = fluxDetToIdx.find(detID);
+      // masked detector in flux, but not in input workspace
+      if (index == fluxDetToIdx.end())
+        continue;
+      spectrum.fluxIndex = index->second;
+    }
+    if (solidAngle)
+      spectrum.solidAngle = solidAngle->y(solidAngDetToIdx.find(detID)->second)[0];
+    spectrum.use = true;
+  }
+  return spectra;
+}
+} // namespace
+
+/** Constructor
+ * @param exptInfo :: the experiment the values are for
+ * @param samplePos :: position of the sample
+ * @param beamDir :: direction of the beam
+ * @param flux :: the flux workspace, or nullptr if there is none
+ * @param solidAngle :: the solid angle workspace, or nullptr if there is none
+ * @param spectra :: the values for each spectrum
+ */
+MDNormDetectorCache::Detectors::Detectors(const API::ExperimentInfo_const_sptr &exptInfo, const V3D &samplePos,
+                                          const V3D &beamDir, const API::MatrixWorkspace_const_sptr &flux,
+                                          const API::MatrixWorkspace_const_sptr &solidAngle,
+                                          std::vector<Spectrum> spectra)
+    : m_exptInfo(exptInfo), m_samplePos(samplePos), m_beamDir(beamDir), m_flux(flux), m_solidAngle(solidAngle),
+      m_spectra(std::move(spectra)) {}
+
+/** Check if the values were worked out for these inputs. The workspaces must
+ * be the same objects, not just equal ones; a workspace destroyed since never
+ * matches a new one, even at the same address.
+ * @param exptInfo :: the experiment
+ * @param samplePos :: position of the sample
+ * @param beamDir :: direction of the beam
+ * @param flux :: the flux workspace, or nullptr if there is none
+ * @param solidAngle :: the solid angle workspace, or nullptr if there is none
+ * @return true if the values are for these inputs
+ */
+bool MDNormDetectorCache::Detectors::isFor(const API::ExperimentInfo_const_sptr &exptInfo, const V3D &samplePos,
+                                           const V3D &beamDir, const API::MatrixWorkspace_const_sptr &flux,
+                                           const API::MatrixWorkspace_const_sptr &solidAngle) const {
+  return sameObject(m_exptInfo, exptInfo) && sameObject(m_flux, flux) && sameObject(m_solidAngle, solidAngle) &&
+         m_samplePos == samplePos && m_beamDir == beamDir && exptInfo->spectrumInfo().size() == m_spectra.size();
+}
+
+/** Get the values for the spectra of an experiment, from the cache if they
+ * have been worked out before
+ * @param exptInfo :: the experiment
+ * @param samplePos :: position of the sample
+ * @param beamDir :: direction of the beam
+ * @param flux :: the flux workspace, or nullptr if there is none
+ * @param solidAngle :: the solid angle workspace, or nullptr if there is none
+ * @return the values
+ */
+std::shared_ptr<const MDNormDetectorCache::Detectors>
+MDNormDetectorCache::get(const API::ExperimentInfo_const_sptr &exptInfo, const V3D &samplePos, const V3D &beamDir,
+                         const API::MatrixWorkspace_const_sptr &flux,
+                         const API::MatrixWorkspace_const_sptr &solidAngle) {
+  const auto found = std::find_if(m_cache.begin(), m_cache.end(), [&](const auto &cached) {
+    return cached->isFor(exptInfo, samplePos, beamDir, flux, solidAngle);
+  });
+  if (found != m_cache.end()) {
+    m_cache.splice(m_cache.begin(), m_cache, found);
+    return m_cache.front();
+  }
+
+  m_cache.emplace_front(std::make_shared<const Detectors>(
+      exptInfo, samplePos, beamDir, flux, solidAngle,
+      makeSpectra(*exptInfo, samplePos, beamDir, flux.get(), solidAngle.get())));
+  if (m_cache.size() > MAX_CACHED)
+    m_cache.pop_back();
+  return m_cache.front();
+}
+
+/// Empty the cache
+void MDNormDetectorCache::clear() { m_cache.clear(); }
+
+} // namespace Mantid::MDAlgorithms
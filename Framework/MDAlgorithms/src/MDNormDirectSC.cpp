@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/MDNormDirectSC.h"
+#include "MantidMDAlgorithms/MDNormGrid.h"
 
 #include "MantidAPI/CommonBinsValidator.h"
 #include "MantidAPI/InstrumentValidator.h"
@@ -121,6 +122,9 @@ void MDNormDirectSC::init() {
  * Execute the algorithm.
  */
 void MDNormDirectSC::exec() {
+  // Detector values are only shared within one execution; the workspaces may
+  // be changed in place between executions
+  m_detectorCache.clear();
   cacheInputs();
   auto outputWS = binInputWS();
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
@@ -149,6 +153,7 @@ void MDNormDirectSC::exec() {
     // if more than one experiment info, keep accumulating
     m_accumulate = true;
   }
+  m_detectorCache.clear();
 
   // Set the display normalization based on the input workspace
   outputWS->setDisplayNormalization(m_inputWS->displayNormalizationHisto());
@@ -443,49 +448,36 @@ void MDNormDirectSC::calculateNormalization(const std::vector<coord_t> &otherVal
   }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
 
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mapping
-  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
+  // Angles and solid angles of the detectors
   API::MatrixWorkspace_const_sptr solidAngleWS = getProperty("SolidAngleWorkspace");
-  detid2index_map solidAngDetToIdx;
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-    solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
-  }
+  const auto detectors =
+      m_detectorCache.get(m_inputWS->getExperimentInfo(expInfoIndex), m_samplePos, m_beamDir, nullptr, solidAngleWS);
+  const auto ndets = static_cast<int64_t>(detectors->size());
 
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
+  // Each thread adds into its own grid where memory allows
+  MDNormGrid signalArray(m_normWS->getNPoints(), static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
   std::vector<std::array<double, 4>> intersections;
   std::vector<coord_t> pos, posNew;
   double progStep = 0.7 / m_numExptInfos;
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * expInfoIndex, 0.3 + progStep * (expInfoIndex + 1.), ndets);
 
-PRAGMA_OMP(parallel for private(intersections, pos, posNew))
+PRAGMA_OMP(parallel for schedule(dynamic, 256) private(intersections, pos, posNew))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERRUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i)) {
+  const auto &spectrum = (*detectors)[i];
+  if (!spectrum.use)
     continue;
-  }
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the detector is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi);
+  this->calculateIntersections(intersections, spectrum.twoTheta, spectrum.phi);
   if (intersections.empty())
     continue;
 
   // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
+  double solid = spectrum.solidAngle * protonCharge;
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
   pos.resize(vmdDims + otherValues.size() + 1);
@@ -514,19 +506,14 @@ for (int64_t i = 0; i < ndets; i++) {
     // signal = integral between two consecutive intersections *solid angle
     // *PC
     double signal = solid * delta;
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal, std::plus<signal_t>());
+    signalArray.add(PARALLEL_THREAD_NUMBER, linIndex, signal);
   }
   prog->report();
 
   PARALLEL_END_INTERRUPT_REGION
 }
 PARALLEL_CHECK_INTERRUPT_REGION
-if (m_accumulate) {
-  std::transform(signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(), m_normWS->mutableSignalArray(),
-                 [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(), m_normWS->mutableSignalArray());
-}
+signalArray.writeTo(m_normWS->mutableSignalArray(), m_accumulate);
 }
 
 /**
@@ -0,0 +1,52 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidMDAlgorithms/MDNormGrid.h"
+#include "MantidKernel/Memory.h"
+
+#include <algorithm>
+
+namespace Mantid::MDAlgorithms {
+
+/** Constructor
+ * @param numPoints :: number of bins in the grid
+ * @param numThreads :: number of threads that will add to the grid
+ * @param memoryLimit :: most memory, in bytes, for the private copies of the
+ * grid; by default a quarter of the memory available
+ */
+MDNormGrid::MDNormGrid(size_t numPoints, size_t numThreads, std::optional<size_t> memoryLimit)
+    : m_numPoints(numPoints) {
+  numThreads = std::max<size_t>(numThreads, 1);
+  const size_t limit = memoryLimit.value_or(Kernel::MemoryStats().availMem() * 1024 / 4);
+  if (numThreads == 1 || numThreads * numPoints * sizeof(signal_t) <= limit)
+    m_private.resize(numThreads);
+  else
+    m_shared = std::vector<std::atomic<signal_t>>(numPoints);
+}
+
+/** Write the sum of everything added out to a signal array
+ * @param signal :: array of numPoints values
+ * @param accumulate :: if true add the sum to the values already in signal,
+ * otherwise replace them
+ */
+void MDNormGrid::writeTo(signal_t *signal, const bool accumulate) const {
+  const auto numPoints = static_cast<int64_t>(m_numPoints);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numPoints; ++i) {
+    signal_t sum = accumulate ? signal[i] : 0.;
+    if (m_shared.empty()) {
+      for (const auto &grid : m_private) {
+        if (!grid.empty())
+          sum += grid[i];
+      }
+    } else {
+      sum += m_shared[i];
+    }
+    signal[i] = sum;
+  }
+}
+
+} // namespace Mantid::MDAlgorithms
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/MDNormSCD.h"
+#include "MantidMDAlgorithms/MDNormGrid.h"
 
 #include "MantidAPI/CommonBinsValidator.h"
 #include "MantidAPI/InstrumentValidator.h"
@@ -123,6 +124,9 @@ void MDNormSCD::init() {
  * Execute the algorithm.
  */
 void MDNormSCD::exec() {
+  // Detector values are only shared within one execution; the workspaces may
+  // be changed in place between executions
+  m_detectorCache.clear();
   cacheInputs();
   auto outputWS = binInputWS();
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
@@ -150,6 +154,7 @@ void MDNormSCD::exec() {
     }
     m_accumulate = true;
   }
+  m_detectorCache.clear();
 }
 
 /**
@@ -396,44 +401,37 @@ void MDNormSCD::calculateNormalization(const std::vector<coord_t> &otherValues,
   }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
 
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mappings
-  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  const detid2index_map fluxDetToIdx = integrFlux->getDetectorIDToWorkspaceIndexMap();
-  const detid2index_map solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
+  // Angles, flux and solid angle indices of the detectors
+  const auto detectors =
+      m_detectorCache.get(m_inputWS->getExperimentInfo(expInfoIndex), m_samplePos, m_beamDir, integrFlux, solidAngleWS);
+  const auto ndets = static_cast<int64_t>(detectors->size());
 
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
+  // Each thread adds into its own grid where memory allows
+  MDNormGrid signalArray(m_normWS->getNPoints(), static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
   double progStep = 0.7 / m_numExptInfos;
   auto prog =
       std::make_unique<API::Progress>(this, 0.3 + progStep * expInfoIndex, 0.3 + progStep * (expInfoIndex + 1.), ndets);
+  const bool safe = Kernel::threadSafe(*integrFlux);
 
-PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (Kernel::threadSafe(*integrFlux)))
+PRAGMA_OMP(parallel for schedule(dynamic, 256) private(intersections, xValues, yValues, pos, posNew) if (safe))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERRUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) || spectrumInfo.isMasked(i)) {
+  const auto &spectrum = (*detectors)[i];
+  if (!spectrum.use)
     continue;
-  }
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi);
+  this->calculateIntersections(intersections, spectrum.twoTheta, spectrum.phi);
   if (intersections.empty())
     continue;
 
-  // get the flux spetrum number
-  size_t wsIdx = fluxDetToIdx.find(detID)->second;
   // Get solid angle for this contribution
-  double solid = solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
+  double solid = spectrum.solidAngle * protonCharge;
 
   // -- calculate integrals for the intersection --
   // momentum values at intersections
@@ -448,7 +446,7 @@ for (int64_t i = 0; i < ndets; i++) {
   // calculate integrals at momenta from xValues by interpolating between
   // points in spectrum sp
   // of workspace integrFlux. The result is stored in yValues
-  calcIntegralsForIntersections(xValues, *integrFlux, wsIdx, yValues);
+  calcIntegralsForIntersections(xValues, *integrFlux, spectrum.fluxIndex, yValues);
 
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
@@ -476,19 +474,14 @@ for (int64_t i = 0; i < ndets; i++) {
     auto k = static_cast<size_t>(std::distance(intersectionsBegin, it));
     // signal = integral between two consecutive intersections
     signal_t signal = (yValues[k] - yValues[k - 1]) * solid;
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal, std::plus<signal_t>());
+    signalArray.add(PARALLEL_THREAD_NUMBER, linIndex, signal);
   }
   prog->report();
 
   PARALLEL_END_INTERRUPT_REGION
 }
 PARALLEL_CHECK_INTERRUPT_REGION
-if (m_accumulate) {
-  std::transform(signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(), m_normWS->mutableSignalArray(),
-                 [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(), m_normWS->mutableSignalArray());
-}
+signalArray.writeTo(m_normWS->mutableSignalArray(), m_accumulate);
 }
 
 /**
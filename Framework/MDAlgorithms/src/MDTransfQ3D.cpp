@@ -164,6 +164,82 @@ bool MDTransfQ3D::calcMatrixCoord3DElastic(const double &k0, std::vector<coord_t
   return true;
 }
 
+/** Calculates the 3D transformation for a batch of values of one detector,
+  giving the same result as calcMatrixCoord for each value.
+  *
+  * For a given detector the momentum transfer is q = s*u + t*v, with fixed lab
+  * frame vectors u and v and a scale s depending on the value only. The
+  * rotation and the sign of the convention are applied to u and v once, so
+  * each value costs a square root and a few multiply-adds, and the convention
+  * is not looked up for every value. The loop still tests the limits of each
+  * value and appends the coordinates of those within them, so it is not
+  * vectorized; the saving is in the work done per value.
+  *@param deltaEOrK0 -- In elastic the moduli of K0, in inelastic the energy
+  transfers
+  *@param Coord -- 3 or 4D coordinate, used as the buffer for each event
+  *@param s -- the signals, Lorentz corrected if requested
+  *@param err -- the squared errors, Lorentz corrected if requested
+  *@param allCoord -- the coordinates of the values within the limits are appended to this
+  *@param inRange -- set for each value to whether it is within the limits
+*/
+void MDTransfQ3D::calcMatrixCoords(const std::vector<double> &deltaEOrK0, std::vector<coord_t> &Coord,
+                                   std::vector<double> &s, std::vector<double> &err, std::vector<coord_t> &allCoord,
+                                   std::vector<char> &inRange) const {
+  const size_t numValues = deltaEOrK0.size();
+  inRange.assign(numValues, 0);
+
+  // e is minus the detector direction and z the beam direction, in the
+  // internal coordinate system. Elastic: u = e + z, v = 0. Direct: u = e,
+  // v = z. Indirect: u = z, v = e.
+  const bool elastic = m_Emode == Kernel::DeltaEMode::Elastic;
+  const bool direct = m_Emode == Kernel::DeltaEMode::Direct;
+  const double e[3] = {-m_ex, -m_ey, -m_ez};
+  const double z[3] = {0., 0., 1.};
+  double u[3], v[3];
+  for (size_t d = 0; d < 3; ++d) {
+    u[d] = elastic ? e[d] + z[d] : (direct ? e[d] : z[d]);
+    v[d] = elastic ? 0. : (direct ? z[d] : e[d]);
+  }
+  const double sign = convention == "Crystallography" ? -1. : 1.;
+  double a[3], b[3], lower[3], upper[3];
+  for (size_t d = 0; d < 3; ++d) {
+    a[d] = sign * (m_RotMat[3 * d] * u[0] + m_RotMat[3 * d + 1] * u[1] + m_RotMat[3 * d + 2] * u[2]);
+    b[d] = sign * (m_RotMat[3 * d] * v[0] + m_RotMat[3 * d + 1] * v[1] + m_RotMat[3 * d + 2] * v[2]);
+    // In elastic mode the limits are compared as coord_t, as in calcMatrixCoord3DElastic
+    lower[d] = elastic ? static_cast<coord_t>(m_DimMin[d]) : m_DimMin[d];
+    upper[d] = elastic ? static_cast<coord_t>(m_DimMax[d]) : m_DimMax[d];
+  }
+  const double t = elastic ? 0. : m_kFixed;
+  const double energySign = direct ? -1. : 1.;
+
+  for (size_t i = 0; i < numValues; ++i) {
+    const double x = deltaEOrK0[i];
+    double scale = x;
+    if (!elastic) {
+      Coord[3] = static_cast<coord_t>(x);
+      if (Coord[3] < m_DimMin[3] || Coord[3] >= m_DimMax[3])
+        continue;
+      scale = sqrt((m_eFixed + energySign * x) / PhysicalConstants::E_mev_toNeutronWavenumberSq);
+    }
+    bool inside = true;
+    for (size_t d = 0; d < 3; ++d) {
+      Coord[d] = static_cast<coord_t>(a[d] * scale + b[d] * t);
+      inside = inside && !(Coord[d] < lower[d] || Coord[d] >= upper[d]);
+    }
+    if (!inside || std::sqrt(Coord[0] * Coord[0] + Coord[1] * Coord[1] + Coord[2] * Coord[2]) < m_AbsMin)
+      continue;
+
+    if (elastic && m_isLorentzCorrected) {
+      double kdash = x / (2 * M_PI);
+      double correct = m_SinThetaSq * kdash * kdash * kdash * kdash;
+      s[i] *= correct;
+      err[i] *= (correct * correct);
+    }
+    inRange[i] = 1;
+    allCoord.insert(allCoord.end(), Coord.begin(), Coord.end());
+  }
+}
+
 std::vector<double> MDTransfQ3D::getExtremumPoints(const double xMin, const double xMax, size_t det_num) const {
   UNUSED_ARG(det_num);
 
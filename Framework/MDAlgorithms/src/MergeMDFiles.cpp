@@ -11,13 +11,16 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/VectorHelper.h"
 #include "MantidNexus/NexusFile.h"
 
 #include <boost/scoped_ptr.hpp>
 #include <filesystem>
+#include <limits>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
@@ -25,6 +28,82 @@ using namespace Mantid::DataObjects;
 
 namespace Mantid::MDAlgorithms {
 
+namespace {
+/** Reads the events of the boxes of one input file in the order they are
+ * merged. The boxes that are next to each other in the file are read together,
+ * up to a fixed number of events, so that the file is read in a few large
+ * sequential blocks instead of with one seek for every box.
+ */
+class BoxEventStream {
+public:
+  /** Constructor
+   * @param io :: the opened input file
+   * @param eventIndex :: the file position and number of events of each box in the file
+   * @param boxIDs :: the IDs of the boxes, in the order they will be read
+   * @param numColumns :: the number of values stored for each event
+   * @param windowEvents :: the most events held in memory, unless one box has more
+   */
+  BoxEventStream(API::IBoxControllerIO *io, const std::vector<uint64_t> &eventIndex, const std::vector<size_t> &boxIDs,
+                 const size_t numColumns, const uint64_t windowEvents)
+      : m_io(io), m_eventIndex(eventIndex), m_boxIDs(boxIDs), m_numColumns(numColumns) {
+    for (size_t step = 0; step < boxIDs.size(); ++step) {
+      const uint64_t position = eventIndex[2 * boxIDs[step]];
+      const uint64_t numEvents = eventIndex[2 * boxIDs[step] + 1];
+      if (numEvents == 0)
+        continue;
+      if (!m_windows.empty()) {
+        auto &window = m_windows.back();
+        if (position == window.position + window.numEvents && window.numEvents + numEvents <= windowEvents) {
+          window.endStep = step + 1;
+          window.numEvents += numEvents;
+          continue;
+        }
+      }
+      m_windows.emplace_back(Window{step + 1, position, numEvents});
+    }
+  }
+
+  /** Get the events of a box, reading the next window of the file if needed.
+   * The steps must be asked for in increasing order.
+   * @param step :: the place of the box in the list of box IDs
+   * @return the first value of the events of the box
+   */
+  const coord_t *boxData(const size_t step) {
+    while (m_windows[m_next].endStep <= step)
+      ++m_next;
+    if (m_loaded != m_next) {
+      const auto &window = m_windows[m_next];
+      m_buffer.clear();
+      m_io->loadBlock(m_buffer, window.position, static_cast<size_t>(window.numEvents));
+      m_loaded = m_next;
+    }
+    return m_buffer.data() + (m_eventIndex[2 * m_boxIDs[step]] - m_windows[m_loaded].position) * m_numColumns;
+  }
+
+private:
+  /// A run of boxes that are next to each other in the file
+  struct Window {
+    /// One past the step of the last box
+    size_t endStep;
+    /// Position of the first event in the file
+    uint64_t position;
+    /// Number of events in the boxes
+    uint64_t numEvents;
+  };
+
+  API::IBoxControllerIO *m_io;
+  const std::vector<uint64_t> &m_eventIndex;
+  const std::vector<size_t> &m_boxIDs;
+  const size_t m_numColumns;
+  std::vector<Window> m_windows;
+  /// The window holding the box asked for last
+  size_t m_next{0};
+  /// The window in the buffer
+  size_t m_loaded{std::numeric_limits<size_t>::max()};
+  std::vector<coord_t> m_buffer;
+};
+} // namespace
+
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
@@ -60,6 +139,16 @@ void MergeMDFiles::init() {
                   "Run the loading tasks in parallel.\n"
                   "This can be faster but might use more memory.");
 
+  declareProperty("Streaming", true,
+                  "Read each input file in large blocks of boxes that are next to each other in the file, "
+                  "instead of reading every box of every file separately.");
+
+  auto mustBePositive = std::make_shared<BoundedValidator<int>>();
+  mustBePositive->setLower(1);
+  declareProperty("StreamingMemory", 512, mustBePositive,
+                  "The memory, in MB, shared between the input files for the blocks read when Streaming.");
+  setPropertySettings("StreamingMemory", std::make_unique<EnabledWhenProperty>("Streaming", IS_DEFAULT));
+
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>("OutputWorkspace", "", Direction::Output),
                   "An output MDEventWorkspace.");
 }
@@ -174,6 +263,79 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Merge the events of all the files, box by box, reading each file in the
+ * order of its boxes through a BoxEventStream. The boxes of the output are
+ * filled, and saved if file-backed, in the order of their file positions, so
+ * the output file is written sequentially too.
+ *
+ * The output workspace is only passed for the type of its events.
+ */
+template <typename MDE, size_t nd>
+void MergeMDFiles::mergeStreaming(typename MDEventWorkspace<MDE, nd>::sptr /*ws*/) {
+  std::vector<MDBox<MDE, nd> *> boxes;
+  std::vector<size_t> boxIDs;
+  for (auto *node : m_BoxStruct.getBoxes()) {
+    if (auto *box = dynamic_cast<MDBox<MDE, nd> *>(node)) {
+      boxes.emplace_back(box);
+      boxIDs.emplace_back(box->getID());
+    }
+  }
+
+  std::vector<coord_t> tableData;
+  size_t numColumns;
+  double totalSignal, totalErrSq;
+  MDE::eventsToData(std::vector<MDE>(), tableData, numColumns, totalSignal, totalErrSq);
+
+  // Share the memory out between the files, so it does not grow with their number
+  const int memoryMB = getProperty("StreamingMemory");
+  const uint64_t windowEvents = std::max(
+      uint64_t{1}, (static_cast<uint64_t>(memoryMB) << 20) / (sizeof(coord_t) * numColumns * m_EventLoader.size()));
+  std::vector<BoxEventStream> streams;
+  streams.reserve(m_EventLoader.size());
+  for (size_t iw = 0; iw < m_EventLoader.size(); ++iw)
+    streams.emplace_back(m_EventLoader[iw], m_fileComponentsStructure[iw].getEventIndex(), boxIDs, numColumns,
+                         windowEvents);
+
+  std::vector<MDE> events;
+  for (size_t step = 0; step < boxIDs.size(); ++step) {
+    const size_t ID = boxIDs[step];
+    auto *box = boxes[step];
+    // get rid of the events and averages which are in the memory erroneously (from cloning)
+    box->clear();
+
+    uint64_t nBoxEvents(0);
+    for (auto &structure : m_fileComponentsStructure)
+      nBoxEvents += structure.getEventIndex()[2 * ID + 1];
+    box->reserveMemoryForLoad(nBoxEvents);
+
+    for (size_t iw = 0; iw < streams.size(); ++iw) {
+      const auto numEvents = static_cast<size_t>(m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 1]);
+      if (numEvents == 0)
+        continue;
+      const coord_t *data = streams[iw].boxData(step);
+      tableData.assign(data, data + numEvents * numColumns);
+      MDE::dataToEvents(tableData, events, true);
+      box->addEvents(events);
+    }
+    this->saveMergedBox(box);
+    m_progress->report("Loading and merging box data");
+  }
+}
+
+/** Write the events of a box just merged to the output file, if the output is
+ * file-backed, and free their memory.
+ * @param box :: the box of the output workspace
+ */
+void MergeMDFiles::saveMergedBox(API::IMDNode *box) {
+  if (!m_fileBasedTargetWS)
+    return;
+  if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
+    box->getISaveable()->save();
+    box->clearDataFromMemory();
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -239,42 +401,20 @@ void MergeMDFiles::doExecByCloning(const Mantid::API::IMDEventWorkspace_sptr &ws
   }
 
   this->m_totalLoaded = 0;
-  const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
-
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(box);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() > 0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
-      }
+  const bool streaming = getProperty("Streaming");
+  if (streaming) {
+    CALL_MDEVENT_FUNCTION(this->mergeStreaming, m_OutIWS);
+  } else {
+    const std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+    for (size_t ib = 0; ib < numBoxes; ib++) {
+      auto box = boxes[ib];
+      if (!box->isBox())
+        continue;
+      // load all contributed events into current box;
+      this->loadEventsFromSubBoxes(box);
+      this->saveMergedBox(box);
+      m_progress->reportIncrement(ib, "Loading and merging box data");
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
   }
   if (DiskBuf) {
     DiskBuf->flushCache();
@@ -14,6 +14,7 @@
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
 #include "MantidDataObjects/MDBoxIterator.h"
+#include "MantidDataObjects/MDBoxSlabIO.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
@@ -148,26 +149,23 @@ template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWor
       bc->setFileBacked(Saver, filename);
       // get access to boxes array
       std::vector<API::IMDNode *> &boxes = BoxFlatStruct.getBoxes();
+      std::vector<uint64_t> &eventIndex = BoxFlatStruct.getEventIndex();
       // calculate the position of the boxes on file, indicating to make them
       // saveable and that the boxes were not saved.
       BoxFlatStruct.setBoxesFilePositions(true);
       prog->resetNumSteps(boxes.size(), 0.06, 0.90);
-      for (auto &boxe : boxes) {
-        auto saveableTag = boxe->getISaveable();
-        if (saveableTag) // only boxes can be saveable
-        {
-          // do not spend time on empty or masked boxes
-          if (boxe->getDataInMemorySize() == 0 || boxe->getIsMasked())
-            continue;
-          // save boxes directly using the boxes file postion, precalculated in boxFlatStructure.
-          saveableTag->save();
-          // remove boxes data from memory. This will actually correctly set the
-          // tag indicatin that data were not loaded.
-          saveableTag->clearDataFromMemory();
-          // put boxes into write buffer wich will save them when necessary
-          // Saver->toWrite(saveTag);
-          prog->report("Saving Box");
-        }
+      // save the boxes in large slabs directly at the file positions
+      // precalculated in boxFlatStructure
+      MDBoxSlabIO<MDE, nd>(*Saver).save(boxes, eventIndex, prog.get());
+      for (size_t i = 0; i < boxes.size(); ++i) {
+        auto saveableTag = boxes[i]->getISaveable();
+        // only boxes can be saveable; empty or masked boxes were not saved
+        if (!saveableTag || eventIndex[2 * i + 1] == 0 || boxes[i]->getIsMasked())
+          continue;
+        saveableTag->setFilePosition(eventIndex[2 * i], static_cast<size_t>(eventIndex[2 * i + 1]), true);
+        // remove boxes data from memory. This will actually correctly set the
+        // tag indicatin that data were not loaded.
+        saveableTag->clearDataFromMemory();
       }
       // remove everything from diskBuffer;  (not sure if it really necessary
       // but just in case , should not make any harm)
@@ -181,12 +179,9 @@ template <typename MDE, size_t nd> void SaveMD::doSaveEvents(typename MDEventWor
       std::vector<API::IMDNode *> &boxes = BoxFlatStruct.getBoxes();
       std::vector<uint64_t> &eventIndex = BoxFlatStruct.getEventIndex();
       prog->resetNumSteps(boxes.size(), 0.06, 0.90);
-      for (size_t i = 0; i < boxes.size(); i++) {
-        if (eventIndex[2 * i + 1] == 0 || boxes[i]->getIsMasked())
-          continue;
-        boxes[i]->saveAt(Saver.get(), eventIndex[2 * i]);
-        prog->report("Saving Box");
-      }
+      // Write the boxes in large slabs, converting the events of each slab in
+      // parallel while the one before is written
+      MDBoxSlabIO<MDE, nd>(*Saver).save(boxes, eventIndex, prog.get());
       Saver->closeFile();
     }
   }
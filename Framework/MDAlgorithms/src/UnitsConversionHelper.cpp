@@ -8,6 +8,7 @@
 #include "MantidAPI/NumericAxis.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/UnitFactory.h"
+#include <algorithm>
 #include <cmath>
 
 using Mantid::Kernel::UnitParams;
@@ -348,6 +349,38 @@ double UnitsConversionHelper::convertUnits(double val) const {
     throw std::runtime_error("updateConversion: unknown type of conversion requested");
   }
 }
+
+/** Convert a batch of values in place. The result is the same as calling
+ * convertUnits for each value, but the choice of conversion is made once for
+ * the batch rather than once for every value.
+ * @param vals :: the values to convert, replaced by the converted values
+ */
+void UnitsConversionHelper::convertUnits(std::vector<double> &vals) const {
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    const double factor = m_Factor;
+    const double power = m_Power;
+    std::transform(vals.cbegin(), vals.cend(), vals.begin(),
+                   [factor, power](const double val) { return factor * std::pow(val, power); });
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    for (auto &val : vals)
+      val = m_TargetUnit->singleFromTOF(val);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    for (auto &val : vals)
+      val = m_TargetUnit->singleFromTOF(m_SourceWSUnit->singleToTOF(val));
+    return;
+  }
+  default:
+    throw std::runtime_error("updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(const UnitsConversionHelper &another) {
   m_UnitCnvrsn = another.m_UnitCnvrsn;
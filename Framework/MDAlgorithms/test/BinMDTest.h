@@ -27,6 +27,7 @@
 #include "MantidMDAlgorithms/SaveMD2.h"
 
 #include <cmath>
+#include <map>
 #include <utility>
 
 #include <cxxtest/TestSuite.h>
@@ -86,6 +87,34 @@ private:
     return AnalysisDataService::Instance().retrieve("3D_Workspace");
   }
 
+  // helper binning BinMDTest_ws, optionally reusing a previous output
+  MDHistoWorkspace_sptr binWithPrevious(const std::string &dim0, const std::string &dim1, const std::string &previous,
+                                        const std::string &output,
+                                        const std::map<std::string, std::string> &otherProperties = {}) {
+    BinMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", "BinMDTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim0", dim0));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim1", dim1));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0, 5"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("PreviousOutputWorkspace", previous));
+    for (const auto &[name, value] : otherProperties)
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue(name, value));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", output));
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+    return AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(output);
+  }
+
+  void assertSameBins(const MDHistoWorkspace &actual, const MDHistoWorkspace &expected) {
+    TS_ASSERT_EQUALS(actual.getNPoints(), expected.getNPoints());
+    for (size_t i = 0; i < expected.getNPoints(); i++) {
+      TS_ASSERT_DELTA(actual.getSignalAt(i), expected.getSignalAt(i), 1e-6);
+      TS_ASSERT_DELTA(actual.getErrorAt(i), expected.getErrorAt(i), 1e-6);
+      TS_ASSERT_EQUALS(actual.getNumEventsAt(i), expected.getNumEventsAt(i));
+    }
+  }
+
 public:
   void testSetup() {
     using namespace Mantid::Kernel;
@@ -266,6 +295,87 @@ public:
     TSM_ASSERT_DELTA("Data was unmasked bin should have a signal of 1", out_ws->getSignalAt(3), 1.0, 1e-5);
   }
 
+  void test_exec_LevelOfDetail_gives_the_same_result() {
+    Mantid::Geometry::QSample frame;
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(10, 0.0, 10.0, frame, 20);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    FrameworkManager::Instance().exec("MaskMD", 6, "Workspace", "BinMDTest_ws", "Dimensions", "Axis0,Axis1,Axis2",
+                                      "Extents", "0,2,0,10,0,10");
+
+    std::vector<MDHistoWorkspace_sptr> outputs;
+    for (const bool levelOfDetail : {false, true}) {
+      BinMD alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("InputWorkspace", "BinMDTest_ws"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim0", "Axis0,0.0,10.0, 2"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim1", "Axis1,0.0,10.0, 5"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AlignedDim2", "Axis2,2.5,7.5, 3"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("LevelOfDetail", levelOfDetail));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "BinMDTest_out"));
+      TS_ASSERT_THROWS_NOTHING(alg.execute();)
+      TS_ASSERT(alg.isExecuted());
+      outputs.emplace_back(AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>("BinMDTest_out"));
+    }
+
+    TS_ASSERT_EQUALS(outputs[0]->getNPoints(), outputs[1]->getNPoints());
+    for (size_t i = 0; i < outputs[0]->getNPoints(); i++) {
+      TS_ASSERT_DELTA(outputs[0]->getSignalAt(i), outputs[1]->getSignalAt(i), 1e-6);
+      TS_ASSERT_DELTA(outputs[0]->getErrorAt(i), outputs[1]->getErrorAt(i), 1e-6);
+      TS_ASSERT_EQUALS(outputs[0]->getNumEventsAt(i), outputs[1]->getNumEventsAt(i));
+    }
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    AnalysisDataService::Instance().remove("BinMDTest_out");
+  }
+
+  void test_exec_PreviousOutputWorkspace_gives_the_same_result() {
+    Mantid::Geometry::QSample frame;
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(10, 0.0, 10.0, frame, 20);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+
+    binWithPrevious("Axis0,0.0,6.0, 6", "Axis1,0.0,10.0, 10", "", "BinMDTest_previous");
+    // Shifted in Axis0 and Axis1, with bins twice as wide in Axis0
+    const auto expected = binWithPrevious("Axis0,2.0,10.0, 4", "Axis1,3.0,8.0, 5", "", "BinMDTest_expected");
+    const auto reused =
+        binWithPrevious("Axis0,2.0,10.0, 4", "Axis1,3.0,8.0, 5", "BinMDTest_previous", "BinMDTest_out");
+    assertSameBins(*reused, *expected);
+
+    for (const auto &name : {"BinMDTest_ws", "BinMDTest_previous", "BinMDTest_expected", "BinMDTest_out"})
+      AnalysisDataService::Instance().remove(name);
+  }
+
+  void test_exec_PreviousOutputWorkspace_is_not_reused_if_it_is_out_of_date() {
+    Mantid::Geometry::QSample frame;
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(10, 0.0, 10.0, frame, 20);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    const std::string previousDim0("Axis0,0.0,6.0, 6"), previousDim1("Axis1,0.0,10.0, 10");
+    const std::string dim0("Axis0,2.0,10.0, 4"), dim1("Axis1,3.0,8.0, 5");
+    const auto expected = binWithPrevious(dim0, dim1, "", "BinMDTest_expected");
+
+    // Filtered by an implicit function, which rejects every bin
+    const std::string functionXML = std::string("<Function>") + "<Type>MockImplicitFunction</Type>" +
+                                    "<ParameterList>" + "</ParameterList>" + "</Function>";
+    binWithPrevious(previousDim0, previousDim1, "", "BinMDTest_previous", {{"ImplicitFunctionXML", functionXML}});
+    assertSameBins(*binWithPrevious(dim0, dim1, "BinMDTest_previous", "BinMDTest_out"), *expected);
+
+    // Accumulated into a temporary data workspace, which doubles every bin
+    binWithPrevious(previousDim0, previousDim1, "", "BinMDTest_previous");
+    binWithPrevious(previousDim0, previousDim1, "", "BinMDTest_previous",
+                    {{"TemporaryDataWorkspace", "BinMDTest_previous"}});
+    assertSameBins(*binWithPrevious(dim0, dim1, "BinMDTest_previous", "BinMDTest_out"), *expected);
+
+    // The input has changed since
+    binWithPrevious(previousDim0, previousDim1, "", "BinMDTest_previous");
+    FrameworkManager::Instance().exec("FakeMDEventData", 4, "InputWorkspace", "BinMDTest_ws", "UniformParams", "500");
+    const auto changed = binWithPrevious(dim0, dim1, "", "BinMDTest_expected");
+    assertSameBins(*binWithPrevious(dim0, dim1, "BinMDTest_previous", "BinMDTest_out"), *changed);
+
+    for (const auto &name : {"BinMDTest_ws", "BinMDTest_previous", "BinMDTest_expected", "BinMDTest_out"})
+      AnalysisDataService::Instance().remove(name);
+  }
+
   void test_exec_3D() {
     do_test_exec("", "Axis0,2.0,8.0, 6", "Axis1,2.0,8.0, 6", "Axis2,2.0,8.0, 6", "", 1.0 /*signal*/,
                  6 * 6 * 6 /*# of bins*/, true /*IterateEvents*/);
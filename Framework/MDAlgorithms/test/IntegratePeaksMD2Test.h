@@ -10,6 +10,7 @@
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/Run.h"
+#include "MantidDataObjects/CoordTransformDistance.h"
 #include "MantidDataObjects/LeanElasticPeaksWorkspace.h"
 #include "MantidDataObjects/MDEventFactory.h"
 #include "MantidDataObjects/PeakShapeSpherical.h"
@@ -28,12 +29,16 @@
 #include <boost/math/special_functions/pow.hpp>
 
 #include <cxxtest/TestSuite.h>
+#include <algorithm>
 #include <random>
+#include <tuple>
 
 #include <MantidDataObjects/PeakShapeEllipsoid.h>
 #include <filesystem>
 
 using Mantid::API::AnalysisDataService;
+using Mantid::coord_t;
+using Mantid::signal_t;
 using Mantid::Geometry::MDHistoDimension;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -105,8 +110,13 @@ public:
   }
 
   //-------------------------------------------------------------------------------
-  /** Create the (blank) MDEW */
-  static void createMDEW() {
+  /** Create the (blank) MDEW
+   * @param splitInto :: number of boxes each box is split into along a dimension
+   * @param maxRecursionDepth :: maximum depth of the box tree
+   * @param splitThreshold :: number of events above which a box is split, or 0
+   * for the default
+   */
+  static void createMDEW(const int splitInto = 5, const int maxRecursionDepth = 2, const int splitThreshold = 0) {
     // ---- Start with empty MDEW ----
 
     CreateMDWorkspace algC;
@@ -121,8 +131,10 @@ public:
     std::string frames =
         Mantid::Geometry::HKL::HKLName + "," + Mantid::Geometry::HKL::HKLName + "," + Mantid::Geometry::HKL::HKLName;
     TS_ASSERT_THROWS_NOTHING(algC.setProperty("Frames", frames));
-    TS_ASSERT_THROWS_NOTHING(algC.setProperty("SplitInto", "5"));
-    TS_ASSERT_THROWS_NOTHING(algC.setProperty("MaxRecursionDepth", "2"));
+    TS_ASSERT_THROWS_NOTHING(algC.setProperty("SplitInto", std::to_string(splitInto)));
+    TS_ASSERT_THROWS_NOTHING(algC.setProperty("MaxRecursionDepth", std::to_string(maxRecursionDepth)));
+    if (splitThreshold > 0)
+      TS_ASSERT_THROWS_NOTHING(algC.setProperty("SplitThreshold", splitThreshold));
     TS_ASSERT_THROWS_NOTHING(algC.setPropertyValue("OutputWorkspace", "IntegratePeaksMD2Test_MDEWS"));
     TS_ASSERT_THROWS_NOTHING(algC.execute());
     TS_ASSERT(algC.isExecuted());
@@ -1111,6 +1123,117 @@ public:
     }
   }
 
+  //-------------------------------------------------------------------------------
+  /** Integrate a sphere, or a spherical shell, around a position starting from
+   * the top box of the workspace
+   * @param ws :: the workspace
+   * @param position :: centre of the sphere
+   * @param radius :: radius of the sphere
+   * @param innerRadius :: inner radius of the shell, 0 for a sphere
+   * @return the signal and error squared
+   */
+  static std::pair<double, double> integrateFromTopBox(const MDEventWorkspace3Lean &ws, const V3D &position,
+                                                       const double radius, const double innerRadius = 0.0) {
+    coord_t center[3];
+    bool dimensionsUsed[3];
+    for (size_t d = 0; d < 3; ++d) {
+      center[d] = static_cast<coord_t>(position[d]);
+      dimensionsUsed[d] = true;
+    }
+    CoordTransformDistance getRadiusSq(3, center, dimensionsUsed);
+    signal_t signal = 0;
+    signal_t errorSquared = 0;
+    ws.getBox()->integrateSphere(getRadiusSq, static_cast<coord_t>(radius * radius), signal, errorSquared,
+                                 static_cast<coord_t>(innerRadius * innerRadius), true);
+    return {signal, errorSquared};
+  }
+
+  /** Check the intensity of each peak against the integration of its sphere and
+   * background shell from the top box of the workspace
+   */
+  static void checkAgainstTopBox(const MDEventWorkspace3Lean &ws, const PeaksWorkspace &peakWS, const double radius,
+                                 const double bgInnerRadius, const double bgOuterRadius) {
+    const double scaleFactor = pow(radius, 3) / (pow(bgOuterRadius, 3) - pow(bgInnerRadius, 3));
+    for (int i = 0; i < peakWS.getNumberPeaks(); ++i) {
+      const auto &peak = peakWS.getPeak(i);
+      const auto [signal, errorSquared] = integrateFromTopBox(ws, peak.getHKL(), radius);
+      double bgSignal = 0.0;
+      double bgErrorSquared = 0.0;
+      if (bgOuterRadius > radius)
+        std::tie(bgSignal, bgErrorSquared) = integrateFromTopBox(ws, peak.getHKL(), bgOuterRadius, bgInnerRadius);
+      TSM_ASSERT_DELTA("Peak " + std::to_string(i), peak.getIntensity(), signal - scaleFactor * bgSignal, 1e-6);
+      TSM_ASSERT_DELTA("Peak " + std::to_string(i), peak.getSigmaIntensity(),
+                       sqrt(errorSquared + scaleFactor * scaleFactor * bgErrorSquared), 1e-6);
+    }
+  }
+
+  void test_exec_deeply_split_workspace_matches_integration_from_the_top_box() {
+    createMDEW(2, 10, 20);
+    addUniform(20000, {{-10., 10.}, {-10., 10.}, {-10., 10.}});
+    // Peaks on the edges of boxes at several depths, and at the boundary of the
+    // workspace so that the spheres reach outside of it
+    const std::vector<V3D> positions{{0.01, -0.01, 0.02}, {5.01, -2.49, 2.5},  {-7.5, 7.5, -0.02},
+                                     {1.25, 3.75, -8.75}, {9.9, 9.8, -9.95}, {-9.99, 0.3, 4.99}};
+    for (const auto &position : positions)
+      addPeak(500, position.X(), position.Y(), position.Z(), 0.5);
+
+    auto mdews = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3Lean>("IntegratePeaksMD2Test_MDEWS");
+    mdews->setCoordinateSystem(Mantid::Kernel::HKL);
+    std::vector<IMDNode *> boxes;
+    mdews->getBox()->getBoxes(boxes, 1000, true);
+    const auto deepest = std::max_element(boxes.cbegin(), boxes.cend(), [](const auto *lhs, const auto *rhs) {
+      return lhs->getDepth() < rhs->getDepth();
+    });
+    TS_ASSERT_LESS_THAN(3, (*deepest)->getDepth());
+
+    Instrument_sptr inst = ComponentCreationHelper::createTestInstrumentRectangular(1, 100, 0.05);
+    PeaksWorkspace_sptr peakWS = std::make_shared<PeaksWorkspace>();
+    for (const auto &position : positions)
+      peakWS->addPeak(Peak(inst, 15050, 1.0, position));
+    AnalysisDataService::Instance().addOrReplace("IntegratePeaksMD2Test_peaks", peakWS);
+
+    doRun({0.6}, {0.0});
+    checkAgainstTopBox(*mdews, *peakWS, 0.6, 0.0, 0.0);
+
+    doRun({0.6}, {1.0}, "IntegratePeaksMD2Test_peaks", {0.8});
+    checkAgainstTopBox(*mdews, *peakWS, 0.6, 0.8, 1.0);
+
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_MDEWS");
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_peaks");
+  }
+
+  void test_exec_shuffled_peaks_get_their_own_intensities() {
+    createMDEW(2, 10, 20);
+    // Peaks of different sizes on a grid, so that each intensity tells which
+    // peak it was integrated from
+    std::vector<std::pair<V3D, double>> peaks;
+    for (int i = 0; i < 27; ++i) {
+      const V3D position(-7.0 + 7.0 * (i % 3), -7.0 + 7.0 * ((i / 3) % 3), -7.0 + 7.0 * (i / 9));
+      const auto counts = static_cast<size_t>(100 * (i + 1));
+      addPeak(counts, position.X(), position.Y(), position.Z(), 0.5);
+      peaks.emplace_back(position, static_cast<double>(counts));
+    }
+    std::shuffle(peaks.begin(), peaks.end(), std::mt19937(42));
+
+    auto mdews = AnalysisDataService::Instance().retrieveWS<MDEventWorkspace3Lean>("IntegratePeaksMD2Test_MDEWS");
+    mdews->setCoordinateSystem(Mantid::Kernel::HKL);
+    Instrument_sptr inst = ComponentCreationHelper::createTestInstrumentRectangular(1, 100, 0.05);
+    PeaksWorkspace_sptr peakWS = std::make_shared<PeaksWorkspace>();
+    for (const auto &peak : peaks)
+      peakWS->addPeak(Peak(inst, 15050, 1.0, peak.first));
+    AnalysisDataService::Instance().addOrReplace("IntegratePeaksMD2Test_peaks", peakWS);
+
+    doRun({1.0}, {0.0});
+    for (int i = 0; i < peakWS->getNumberPeaks(); ++i) {
+      TS_ASSERT_EQUALS(peakWS->getPeak(i).getHKL(), peaks[i].first);
+      TS_ASSERT_DELTA(peakWS->getPeak(i).getIntensity(), peaks[i].second, 1e-2);
+    }
+    checkAgainstTopBox(*mdews, *peakWS, 1.0, 0.0, 0.0);
+
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_MDEWS");
+    AnalysisDataService::Instance().remove("IntegratePeaksMD2Test_peaks");
+  }
+
   void test_writes_out_selected_algorithm_parameters() {
     createMDEW();
     const double peakRadius = 2;
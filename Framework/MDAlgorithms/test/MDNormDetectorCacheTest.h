@@ -0,0 +1,116 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidMDAlgorithms/MDNormDetectorCache.h"
+
+#include <cxxtest/TestSuite.h>
+
+using Mantid::Kernel::V3D;
+using Mantid::MDAlgorithms::MDNormDetectorCache;
+
+class MDNormDetectorCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormDetectorCacheTest *createSuite() { return new MDNormDetectorCacheTest(); }
+  static void destroySuite(MDNormDetectorCacheTest *suite) { delete suite; }
+
+  MDNormDetectorCacheTest()
+      : m_samplePos(0., 0., 0.), m_beamDir(0., 0., 1.),
+        m_inputWS(WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 10)),
+        m_flux(WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 10)),
+        m_solidAngle(WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 10)) {
+    for (size_t i = 0; i < 4; ++i)
+      m_solidAngle->mutableY(i)[0] = static_cast<double>(i + 1);
+  }
+
+  void setUp() override { m_cache.clear(); }
+
+  void test_values_for_each_spectrum() {
+    const auto detectors = get(m_inputWS);
+    TS_ASSERT_EQUALS(detectors->size(), 4);
+    const auto &spectrumInfo = m_inputWS->spectrumInfo();
+    for (size_t i = 0; i < detectors->size(); ++i) {
+      const auto &spectrum = (*detectors)[i];
+      TS_ASSERT(spectrum.use);
+      TS_ASSERT_DELTA(spectrum.twoTheta, spectrumInfo.detector(i).getTwoTheta(m_samplePos, m_beamDir), 1e-12);
+      TS_ASSERT_DELTA(spectrum.phi, spectrumInfo.detector(i).getPhi(), 1e-12);
+      TS_ASSERT_EQUALS(spectrum.fluxIndex, i);
+      TS_ASSERT_EQUALS(spectrum.solidAngle, static_cast<double>(i + 1));
+    }
+  }
+
+  void test_without_solid_angle_workspace_solid_angle_is_one() {
+    const auto detectors = m_cache.get(m_inputWS, m_samplePos, m_beamDir, nullptr, nullptr);
+    TS_ASSERT_EQUALS((*detectors)[2].solidAngle, 1.);
+  }
+
+  void test_same_inputs_reuse_the_cached_values() {
+    const auto first = get(m_inputWS);
+    TS_ASSERT_EQUALS(get(m_inputWS), first);
+  }
+
+  void test_masking_a_detector_changes_the_values() {
+    const auto first = get(m_inputWS);
+    const Mantid::API::MatrixWorkspace_sptr masked = m_inputWS->clone();
+    masked->mutableSpectrumInfo().setMasked(1, true);
+    const auto second = get(masked);
+    TS_ASSERT_DIFFERS(second, first);
+    TS_ASSERT(!(*second)[1].use);
+    TS_ASSERT((*second)[0].use);
+  }
+
+  void test_values_are_only_reused_for_the_same_inputs() {
+    const auto first = get(m_inputWS);
+    // An equal copy of the experiment is a different one
+    const Mantid::API::MatrixWorkspace_sptr copy = m_inputWS->clone();
+    TS_ASSERT_DIFFERS(get(copy), first);
+    const Mantid::API::MatrixWorkspace_const_sptr solidAngle = m_solidAngle->clone();
+    TS_ASSERT_DIFFERS(m_cache.get(m_inputWS, m_samplePos, m_beamDir, m_flux, solidAngle), first);
+    TS_ASSERT_DIFFERS(m_cache.get(m_inputWS, m_samplePos, m_beamDir, nullptr, m_solidAngle), first);
+    TS_ASSERT_DIFFERS(m_cache.get(m_inputWS, V3D(0., 0., 0.1), m_beamDir, m_flux, m_solidAngle), first);
+    TS_ASSERT_DIFFERS(m_cache.get(m_inputWS, m_samplePos, V3D(0., 1., 0.), m_flux, m_solidAngle), first);
+  }
+
+  void test_changing_the_solid_angles_needs_clear() {
+    const Mantid::API::MatrixWorkspace_sptr solidAngle = m_solidAngle->clone();
+    const auto first = m_cache.get(m_inputWS, m_samplePos, m_beamDir, m_flux, solidAngle);
+    solidAngle->mutableY(3)[0] = 10.;
+    m_cache.clear();
+    const auto second = m_cache.get(m_inputWS, m_samplePos, m_beamDir, m_flux, solidAngle);
+    TS_ASSERT_DIFFERS(second, first);
+    TS_ASSERT_EQUALS((*second)[3].solidAngle, 10.);
+  }
+
+  void test_caches_do_not_share_values() {
+    const auto first = get(m_inputWS);
+    MDNormDetectorCache other;
+    TS_ASSERT_DIFFERS(other.get(m_inputWS, m_samplePos, m_beamDir, m_flux, m_solidAngle), first);
+  }
+
+  void test_detectors_missing_from_flux_are_not_used() {
+    const auto flux = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(2, 10);
+    const auto detectors = m_cache.get(m_inputWS, m_samplePos, m_beamDir, flux, nullptr);
+    TS_ASSERT((*detectors)[1].use);
+    TS_ASSERT(!(*detectors)[2].use);
+  }
+
+private:
+  std::shared_ptr<const MDNormDetectorCache::Detectors> get(const Mantid::API::ExperimentInfo_const_sptr &exptInfo) {
+    return m_cache.get(exptInfo, m_samplePos, m_beamDir, m_flux, m_solidAngle);
+  }
+
+  const V3D m_samplePos;
+  const V3D m_beamDir;
+  Mantid::API::MatrixWorkspace_sptr m_inputWS;
+  Mantid::API::MatrixWorkspace_sptr m_flux;
+  Mantid::API::MatrixWorkspace_sptr m_solidAngle;
+  MDNormDetectorCache m_cache;
+};
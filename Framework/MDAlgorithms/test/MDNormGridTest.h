@@ -0,0 +1,107 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidMDAlgorithms/MDNormGrid.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <numeric>
+#include <vector>
+
+using Mantid::MDAlgorithms::MDNormGrid;
+
+class MDNormGridTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormGridTest *createSuite() { return new MDNormGridTest(); }
+  static void destroySuite(MDNormGridTest *suite) { delete suite; }
+
+  void test_threads_add_into_private_grids() {
+    MDNormGrid grid(4, 3);
+    TS_ASSERT(grid.isPrivate());
+    grid.add(0, 1, 1.5);
+    grid.add(2, 1, 2.0);
+    grid.add(2, 3, 4.0);
+
+    std::vector<double> signal(4, 10.);
+    grid.writeTo(signal.data(), false);
+    TS_ASSERT_EQUALS(signal, std::vector<double>({0., 3.5, 0., 4.}));
+    grid.writeTo(signal.data(), true);
+    TS_ASSERT_EQUALS(signal, std::vector<double>({0., 7., 0., 8.}));
+  }
+
+  void test_threads_share_a_grid_beyond_the_memory_limit() {
+    MDNormGrid grid(4, 3, 4 * sizeof(double));
+    TS_ASSERT(!grid.isPrivate());
+    grid.add(0, 1, 1.5);
+    grid.add(2, 1, 2.0);
+
+    std::vector<double> signal(4, 1.);
+    grid.writeTo(signal.data(), true);
+    TS_ASSERT_EQUALS(signal, std::vector<double>({1., 4.5, 1., 1.}));
+  }
+
+  void test_a_single_thread_always_has_its_own_grid() {
+    MDNormGrid grid(4, 1, 0);
+    TS_ASSERT(grid.isPrivate());
+  }
+
+  void test_result_is_the_same_from_many_threads() {
+    const int numPoints = 1000;
+    MDNormGrid grid(numPoints, static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 100 * numPoints; ++i)
+      grid.add(PARALLEL_THREAD_NUMBER, i % numPoints, 0.5);
+
+    std::vector<double> signal(numPoints);
+    grid.writeTo(signal.data(), false);
+    TS_ASSERT_EQUALS(signal, std::vector<double>(numPoints, 50.));
+  }
+};
+
+/** Adds trajectories of 100 bins for each of the 300,000 detectors of a large
+ * single crystal instrument into a 200^3 grid, as MDNorm does.
+ */
+class MDNormGridTestPerformance : public CxxTest::TestSuite {
+public:
+  static MDNormGridTestPerformance *createSuite() { return new MDNormGridTestPerformance(); }
+  static void destroySuite(MDNormGridTestPerformance *suite) { delete suite; }
+
+  void test_private_grids() {
+    MDNormGrid grid(m_numPoints, m_numThreads);
+    addTrajectories(grid);
+  }
+
+  void test_shared_grid() {
+    MDNormGrid grid(m_numPoints, m_numThreads, 0);
+    addTrajectories(grid);
+  }
+
+private:
+  void addTrajectories(MDNormGrid &grid) {
+    const int numDetectors = 300000;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int detector = 0; detector < numDetectors; ++detector) {
+      const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+      // A straight line through the grid from a point that depends on the detector
+      size_t index = (static_cast<size_t>(detector) * 7919) % m_numPoints;
+      for (int step = 0; step < 100; ++step) {
+        grid.add(thread, index, 1.);
+        index = (index + 201) % m_numPoints;
+      }
+    }
+    std::vector<double> signal(m_numPoints);
+    grid.writeTo(signal.data(), false);
+    TS_ASSERT_DELTA(std::accumulate(signal.cbegin(), signal.cend(), 0.), 100. * numDetectors, 1e-6);
+  }
+
+  const size_t m_numPoints{200 * 200 * 200};
+  const size_t m_numThreads{static_cast<size_t>(PARALLEL_GET_MAX_THREADS)};
+};
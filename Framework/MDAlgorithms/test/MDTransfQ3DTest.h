@@ -29,18 +29,17 @@ public:
   double getCurSinThetaSq() const { return m_SinThetaSq; }
 };
 
-std::tuple<MDTransfQ3DTestHelper, MDWSDescription> createTestTransform(const double efixed,
-                                                                       const DeltaEMode::Type emode) {
+MDWSDescription createTestDescription(const double efixed, const DeltaEMode::Type emode,
+                                      const bool lorentzCorrected = false) {
   auto indirectInelasticWS = WorkspaceCreationHelper::createProcessedWorkspaceWithCylComplexInstrument(4, 10, true);
   // Set efixed. Test helpers buildPreprocessedDetectorsWorkspace sets efixed
   // column to the value of Ei in the log
   indirectInelasticWS->mutableRun().addProperty("Ei", efixed, "meV", true);
-  const int ndimensions{4};
+  const int ndimensions = emode == DeltaEMode::Elastic ? 3 : 4;
   MDWSDescription wsDescription(ndimensions);
-  MDTransfQ3DTestHelper q3dTransform;
   // set wide limits to catch everything
-  wsDescription.setMinMax({-100, -100, -100, -100}, {100, 100, 100, 100});
-  wsDescription.buildFromMatrixWS(indirectInelasticWS, q3dTransform.transfID(), DeltaEMode::asString(emode), {});
+  wsDescription.setMinMax(std::vector<double>(ndimensions, -100), std::vector<double>(ndimensions, 100));
+  wsDescription.buildFromMatrixWS(indirectInelasticWS, MDTransfQ3D().transfID(), DeltaEMode::asString(emode), {});
   auto ppDets_alg = Mantid::API::AlgorithmManager::Instance().createUnmanaged("PreprocessDetectorsToMD");
   ppDets_alg->initialize();
   ppDets_alg->setChild(true);
@@ -48,6 +47,14 @@ std::tuple<MDTransfQ3DTestHelper, MDWSDescription> createTestTransform(const dou
   ppDets_alg->setProperty("OutputWorkspace", "UnitsConversionHelperTableWs");
   ppDets_alg->execute();
   wsDescription.m_PreprDetTable = ppDets_alg->getProperty("OutputWorkspace");
+  wsDescription.setLorentsCorr(lorentzCorrected);
+  return wsDescription;
+}
+
+std::tuple<MDTransfQ3DTestHelper, MDWSDescription> createTestTransform(const double efixed,
+                                                                       const DeltaEMode::Type emode) {
+  auto wsDescription = createTestDescription(efixed, emode);
+  MDTransfQ3DTestHelper q3dTransform;
   q3dTransform.initialize(wsDescription);
 
   return std::make_tuple(q3dTransform, wsDescription);
@@ -233,4 +240,117 @@ public:
     TS_ASSERT_DELTA(1.0, signal, 1e-05)
     TS_ASSERT_DELTA(1.0, error, 1e-05)
   }
+
+  void testBatchGivesSameAsSingleDirect() { doTestBatchGivesSameAsSingle(13., DeltaEMode::Direct); }
+
+  void testBatchGivesSameAsSingleIndirect() { doTestBatchGivesSameAsSingle(2.45, DeltaEMode::Indirect); }
+
+  void testBatchGivesSameAsSingleElastic() { doTestBatchGivesSameAsSingle(13., DeltaEMode::Elastic); }
+
+  void testBatchGivesSameAsSingleElasticWithLorentzCorrection() {
+    doTestBatchGivesSameAsSingle(13., DeltaEMode::Elastic, true);
+  }
+
+private:
+  void doTestBatchGivesSameAsSingle(const double efixed, const DeltaEMode::Type emode,
+                                    const bool lorentzCorrected = false) {
+    // Initialized here, as the transform points to its own array of sin(theta)^2
+    const auto wsDescription = createTestDescription(efixed, emode, lorentzCorrected);
+    MDTransfQ3DTestHelper q3dTransform;
+    q3dTransform.initialize(wsDescription);
+    TS_ASSERT_EQUALS(q3dTransform.getLorentzCorr(), lorentzCorrected);
+    const size_t nd = emode == DeltaEMode::Elastic ? 3 : 4;
+
+    // Energy transfers, or momenta in elastic mode. The first two are out of
+    // range in inelastic mode.
+    std::vector<double> deltaE{-200., 150.};
+    for (int i = -4; i < 25; ++i)
+      deltaE.emplace_back(0.5 * i);
+    size_t totalInRange = 0;
+    size_t numCorrected = 0;
+    for (size_t det = 0; det < 4; ++det) {
+      std::vector<coord_t> coord(nd);
+      q3dTransform.calcYDepCoordinates(coord, det);
+      std::vector<double> signal(deltaE.size(), 1.), errorSq(deltaE.size(), 1.);
+      std::vector<coord_t> allCoord;
+      std::vector<char> inRange;
+      q3dTransform.calcMatrixCoords(deltaE, coord, signal, errorSq, allCoord, inRange);
+      TS_ASSERT_EQUALS(inRange.size(), deltaE.size());
+      if (emode != DeltaEMode::Elastic) {
+        TS_ASSERT(!inRange[0]);
+        TS_ASSERT(!inRange[1]);
+      }
+
+      size_t numInRange = 0;
+      for (size_t i = 0; i < deltaE.size(); ++i) {
+        std::vector<coord_t> expected(nd);
+        double expectedSignal{1.}, expectedErrorSq{1.};
+        const bool expectedInRange = q3dTransform.calcMatrixCoord(deltaE[i], expected, expectedSignal, expectedErrorSq);
+        TS_ASSERT_EQUALS(static_cast<bool>(inRange[i]), expectedInRange);
+        if (!expectedInRange || !inRange[i])
+          continue;
+        for (size_t d = 0; d < nd; ++d)
+          TS_ASSERT_DELTA(allCoord[nd * numInRange + d], expected[d], 1e-5);
+        TS_ASSERT_DELTA(signal[i], expectedSignal, 1e-12 * std::abs(expectedSignal));
+        TS_ASSERT_DELTA(errorSq[i], expectedErrorSq, 1e-12 * std::abs(expectedErrorSq));
+        if (expectedSignal != 1.)
+          ++numCorrected;
+        ++numInRange;
+      }
+      TS_ASSERT_EQUALS(allCoord.size(), nd * numInRange);
+      totalInRange += numInRange;
+    }
+    TS_ASSERT_LESS_THAN(0, totalInRange);
+    // The Lorentz correction was applied, and only when asked for
+    if (lorentzCorrected) {
+      TS_ASSERT_LESS_THAN(0, numCorrected);
+    } else {
+      TS_ASSERT_EQUALS(numCorrected, 0);
+    }
+  }
+};
+
+class MDTransfQ3DTestPerformance : public CxxTest::TestSuite {
+public:
+  static MDTransfQ3DTestPerformance *createSuite() { return new MDTransfQ3DTestPerformance(); }
+  static void destroySuite(MDTransfQ3DTestPerformance *suite) { delete suite; }
+
+  MDTransfQ3DTestPerformance() : m_deltaE(NUM_EVENTS) {
+    std::tie(m_q3dTransform, m_wsDescription) = createTestTransform(13., DeltaEMode::Direct);
+    for (size_t i = 0; i < NUM_EVENTS; ++i)
+      m_deltaE[i] = -10. + 20. * static_cast<double>(i) / static_cast<double>(NUM_EVENTS);
+  }
+
+  void test_convert_events_in_batches() {
+    std::vector<double> signal(NUM_EVENTS, 1.), errorSq(NUM_EVENTS, 1.);
+    std::vector<coord_t> allCoord;
+    std::vector<char> inRange;
+    for (size_t det = 0; det < 4; ++det) {
+      std::vector<coord_t> coord(4);
+      m_q3dTransform.calcYDepCoordinates(coord, det);
+      allCoord.clear();
+      m_q3dTransform.calcMatrixCoords(m_deltaE, coord, signal, errorSq, allCoord, inRange);
+      TS_ASSERT_EQUALS(allCoord.size(), 4 * NUM_EVENTS);
+    }
+  }
+
+  void test_convert_events_one_at_a_time() {
+    for (size_t det = 0; det < 4; ++det) {
+      std::vector<coord_t> coord(4);
+      m_q3dTransform.calcYDepCoordinates(coord, det);
+      size_t numInRange = 0;
+      for (const double deltaE : m_deltaE) {
+        double signal{1.}, errorSq{1.};
+        if (m_q3dTransform.calcMatrixCoord(deltaE, coord, signal, errorSq))
+          ++numInRange;
+      }
+      TS_ASSERT_EQUALS(numInRange, NUM_EVENTS);
+    }
+  }
+
+private:
+  static constexpr size_t NUM_EVENTS = 2000000;
+  MDTransfQ3DTestHelper m_q3dTransform;
+  MDWSDescription m_wsDescription;
+  std::vector<double> m_deltaE;
 };
@@ -32,7 +32,17 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(const std::string &OutputFilename) {
+  void test_exec_not_streaming() { do_test_exec("", false); }
+
+  void test_exec_fileBacked_not_streaming() { do_test_exec("MergeMDFilesTest_OutputWS.nxs", false); }
+
+  void test_exec_with_less_streaming_memory_than_the_files() {
+    // 1 MB between the files holds fewer than the events of one file
+    do_test_exec("", true, 1, 20000);
+  }
+
+  void do_test_exec(const std::string &OutputFilename, const bool streaming = true, const int streamingMemory = 512,
+                    const long nFileEvents = 1000) {
     if (OutputFilename != "") {
       if (std::filesystem::exists(OutputFilename))
         std::filesystem::remove(OutputFilename);
@@ -43,8 +53,6 @@ public:
     Mantid::Kernel::SpecialCoordinateSystem appliedCoord = Mantid::Kernel::QSample;
     Mantid::Geometry::QSample frame;
     std::vector<MDEventWorkspace3Lean::sptr> inWorkspaces;
-    // how many events put into each file.
-    long nFileEvents(1000);
     for (size_t i = 0; i < 3; i++) {
       std::ostringstream mess;
       mess << "MergeMDFilesTestInput" << i;
@@ -63,6 +71,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("Filenames", filenames));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputFilename", OutputFilename));
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Streaming", streaming));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("StreamingMemory", streamingMemory));
 
     // clean up possible rubbish from previous runs
     std::string fullName = alg.getPropertyValue("OutputFilename");
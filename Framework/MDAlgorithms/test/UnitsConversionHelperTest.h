@@ -78,6 +78,12 @@ public:
       TS_ASSERT_DELTA(X[i] * 8.06554465, Conv.convertUnits(X[i]), 1.e-4);
     }
 
+    std::vector<double> batch(X.cbegin(), X.cend() - 1);
+    Conv.convertUnits(batch);
+    for (size_t i = 0; i < n_bins; i++) {
+      TS_ASSERT_EQUALS(Conv.convertUnits(X[i]), batch[i]);
+    }
+
     auto range = Conv.getConversionRange(0, 10);
     TS_ASSERT_EQUALS(0, range.first);
     TS_ASSERT_EQUALS(3, range.second);
@@ -161,6 +167,10 @@ public:
       TOFS[i] = Conv.convertUnits(X[i]);
     }
 
+    std::vector<double> batch(X.cbegin(), X.cend());
+    Conv.convertUnits(batch);
+    TS_ASSERT_EQUALS(TOFS, batch);
+
     // Let WS know that it is in TOF now (one column)
     auto &T = ws2D->dataX(0);
 
@@ -5,6 +5,7 @@
 #include "MantidNexus/NexusDescriptor.h"
 #include "MantidNexus/NexusFile_fwd.h"
 #include "MantidNexus/UniqueID.h"
+#include <future>
 #include <map>
 #include <memory>
 #include <set>
@@ -92,6 +93,9 @@ private:
    * - firstEntryNameType
    */
   NexusDescriptor m_descriptor;
+  /** Background thread running the reads queued by getSlabAsync(), created on first use */
+  class ReadQueue;
+  std::unique_ptr<ReadQueue> m_readQueue;
 
   //------------------------------------------------------------------------------------------------------------------
   // CONSTRUCTORS / ASSIGNMENT / DECONSTRUCTOR
@@ -380,6 +384,27 @@ public:
    */
   template <typename NumT> void getSlab(NumT *data, DimVector const &start, DimVector const &size);
 
+  /**
+   * Queue a read of a section of the open dataset on a background thread, so
+   * that reading and decompressing the next chunk of a dataset overlaps the
+   * processing of the current one. Reads queued on the same File run one at a
+   * time, in order. The dataset may be closed, and others opened, before the
+   * read has run, but the File must outlive it.
+   *
+   * If the HDF5 library was not built thread-safe, or the dataset holds
+   * scalars or strings, the read is done before returning.
+   *
+   * \param data The pointer to insert that data into. It must stay valid
+   * until the returned future is ready.
+   * \param start The offset into the file's data block to start the read
+   * from.
+   * \param size The size of the block to read from the file.
+   * \return A future that is ready once the data has been read, and rethrows
+   * any error from the read.
+   */
+  template <typename NumT>
+  std::future<void> getSlabAsync(NumT *data, DimVector const &start, DimVector const &size);
+
   /** Get data and coerce into an int vector.
    *
    * @throw Exception if the data is actually a float or
@@ -9,12 +9,16 @@
 #include <algorithm>
 #include <array>
 #include <assert.h>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <hdf5.h>
 #include <iostream>
+#include <mutex>
 #include <numeric>
 #include <sstream>
+#include <thread>
 #include <typeinfo>
 
 using std::string;
@@ -127,6 +131,58 @@ template <> MANTID_NEXUS_DLL NXnumtype getType(string const) { return NXnumtype:
 } // namespace Mantid::Nexus
 
 namespace Mantid::Nexus {
+/**
+ * The reads queued by File::getSlabAsync(), and the thread that runs them in order.
+ * The thread is started by the first read and joined, after finishing the
+ * reads left in the queue, on destruction.
+ */
+class File::ReadQueue {
+public:
+  ~ReadQueue() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_one();
+    if (m_thread.joinable())
+      m_thread.join();
+  }
+
+  std::future<void> push(std::packaged_task<void()> read) {
+    auto result = read.get_future();
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_reads.emplace_back(std::move(read));
+      if (!m_thread.joinable())
+        m_thread = std::thread(&ReadQueue::run, this);
+    }
+    m_wake.notify_one();
+    return result;
+  }
+
+private:
+  void run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_wake.wait(lock, [this] { return m_stopping || !m_reads.empty(); });
+      if (m_reads.empty())
+        return;
+      auto read = std::move(m_reads.front());
+      m_reads.pop_front();
+      lock.unlock();
+      // any exception is passed on through the future
+      read();
+      lock.lock();
+    }
+  }
+
+  std::deque<std::packaged_task<void()>> m_reads;
+  bool m_stopping{false};
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::thread m_thread;
+};
+
 //------------------------------------------------------------------------------------------------------------------
 // CONSTRUCTORS / ASSIGNMENT / DECONSTRUCTOR
 //------------------------------------------------------------------------------------------------------------------
@@ -218,6 +274,8 @@ File::File(File const &f)
 // deconstructor
 
 File::~File() {
+  // finish any reads still queued, as they use the file
+  m_readQueue.reset();
   // release all open groups and datasets
   if (H5Iis_valid(m_current_data_id) > 0) {
     H5Dclose(m_current_data_id);
@@ -1175,6 +1233,46 @@ template <typename NumT> void File::getSlab(NumT *data, DimVector const &start,
   }
 }
 
+template <typename NumT>
+std::future<void> File::getSlabAsync(NumT *data, DimVector const &start, DimVector const &size) {
+#ifdef H5_HAVE_THREADSAFE
+  const bool threadSafe = true;
+#else
+  const bool threadSafe = false;
+#endif
+  const int rank = isDataSetOpen() ? H5Sget_simple_extent_ndims(m_current_space_id) : -1;
+  if (!threadSafe || data == nullptr || rank <= 0 || start.size() != static_cast<size_t>(rank) ||
+      size.size() != start.size() || H5Tget_class(m_current_type_id) == H5T_STRING) {
+    // read now; getSlab() reports anything invalid
+    std::promise<void> done;
+    try {
+      this->getSlab(data, start, size);
+      done.set_value();
+    } catch (...) {
+      done.set_exception(std::current_exception());
+    }
+    return done.get_future();
+  }
+
+  // The read holds its own references, so the dataset can be closed before it runs
+  H5Iinc_ref(m_current_data_id);
+  DataSetID dataset(m_current_data_id);
+  DataTypeID memtype(h5MemType(m_current_type_id));
+  DataSpaceID filespace(H5Scopy(m_current_space_id));
+  std::packaged_task<void()> read([dataset = std::move(dataset), memtype = std::move(memtype),
+                                   filespace = std::move(filespace), data, start, size, filename = m_filename]() {
+    if (H5Sselect_hyperslab(filespace, H5S_SELECT_SET, start.data(), nullptr, size.data(), nullptr) < 0)
+      throw Exception("Selecting slab failed", "getSlabAsync", filename);
+    DataSpaceID memspace = H5Screate_simple(static_cast<int>(size.size()), size.data(), nullptr);
+    if (H5Dread(dataset, memtype, memspace, filespace, H5P_DEFAULT, data) < 0)
+      throw Exception("Reading slab failed", "getSlabAsync", filename);
+  });
+
+  if (!m_readQueue)
+    m_readQueue = std::make_unique<ReadQueue>();
+  return m_readQueue->push(std::move(read));
+}
+
 void File::getDataCoerce(vector<int> &data) {
   Info info = this->getInfo();
   // if it is not a float or special
@@ -2043,6 +2141,31 @@ template MANTID_NEXUS_DLL void File::getSlab(uint64_t *data, const DimVector &st
 template MANTID_NEXUS_DLL void File::getSlab(char *data, const DimVector &start, const DimVector &size);
 template MANTID_NEXUS_DLL void File::getSlab(bool *data, const DimVector &start, const DimVector &size);
 
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(float *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(double *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(int8_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(uint8_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(int16_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(uint16_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(int32_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(uint32_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(int64_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(uint64_t *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(char *data, const DimVector &start,
+                                                            const DimVector &size);
+template MANTID_NEXUS_DLL std::future<void> File::getSlabAsync(bool *data, const DimVector &start,
+                                                            const DimVector &size);
+
 template MANTID_NEXUS_DLL void File::putSlab(const float *data, const DimVector &start, const DimVector &size);
 template MANTID_NEXUS_DLL void File::putSlab(const double *data, const DimVector &start, const DimVector &size);
 template MANTID_NEXUS_DLL void File::putSlab(const int8_t *data, const DimVector &start, const DimVector &size);
@@ -8,6 +8,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidNexus/NexusException.h"
 #include "MantidNexus/NexusFile.h"
 #include "test_helper.h"
 #include <cstdarg>
@@ -15,8 +16,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <filesystem>
+#include <future>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -289,6 +292,44 @@ public:
     fileid.close();
   }
 
+  void test_getSlabAsync() {
+    FileResource resource("NexusFile_test_slab_async.h5");
+    File fileid = do_prep_files(resource.fullPath());
+
+    constexpr dimsize_t DATA_SIZE(1000), CHUNK(300);
+    vector<int64_t> data(DATA_SIZE);
+    std::iota(data.begin(), data.end(), int64_t(-500));
+    fileid.makeCompData("events", NXnumtype::INT64, {DATA_SIZE}, NXcompression::LZW, {CHUNK}, true);
+    fileid.putData(data);
+    fileid.closeData();
+
+    // queue every chunk up front, and close the dataset before any has been waited for
+    vector<vector<int64_t>> chunks;
+    vector<std::future<void>> reads;
+    fileid.openData("events");
+    for (dimsize_t start = 0; start < DATA_SIZE; start += CHUNK) {
+      const dimsize_t size = std::min(CHUNK, DATA_SIZE - start);
+      chunks.emplace_back(size);
+      reads.emplace_back(fileid.getSlabAsync(chunks.back().data(), {start}, {size}));
+    }
+    fileid.closeData();
+
+    vector<int64_t> output;
+    for (size_t i = 0; i < reads.size(); ++i) {
+      TS_ASSERT_THROWS_NOTHING(reads[i].get());
+      output.insert(output.end(), chunks[i].cbegin(), chunks[i].cend());
+    }
+    TS_ASSERT_EQUALS(output, data);
+
+    // errors come back through the future
+    fileid.openData("events");
+    vector<int64_t> beyondEnd(CHUNK);
+    auto bad = fileid.getSlabAsync(beyondEnd.data(), {DATA_SIZE - 1}, {CHUNK});
+    TS_ASSERT_THROWS(bad.get(), const Mantid::Nexus::Exception &);
+    fileid.closeData();
+    fileid.close();
+  }
+
   void test_openPath() {
     cout << "tests for openPath" << endl;
 
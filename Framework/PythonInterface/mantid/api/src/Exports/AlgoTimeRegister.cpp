@@ -38,6 +38,13 @@ void export_AlgoTimeRegister() {
            "Adds a time entry in the file for a function with <name> that starts at <begin> time_ns and ends at <end> "
            "time_ns relative to the <START_POINT> clock")
       .staticmethod("addTime")
+      .def("addCounter", &AlgoTimeRegisterImpl::addCounter, (arg("self"), arg("name"), arg("value")),
+           "Adds <value> to the counter <name> of the innermost algorithm running on this thread in the trace")
+      .def("summaryTable", &AlgoTimeRegisterImpl::summaryTable, arg("self"),
+           "Returns a table of the traced algorithm executions, slowest first")
+      .def("writeTrace", &AlgoTimeRegisterImpl::writeTrace, (arg("self"), arg("filename")),
+           "Writes the traced algorithm executions to <filename> in the Chrome trace-event format")
+      .def("clearSpans", &AlgoTimeRegisterImpl::clearSpans, arg("self"), "Forgets the traced algorithm executions")
       .def("Instance", &AlgoTimeRegister::Instance, return_value_policy<reference_existing_object>(),
            "Returns a reference to the AlgoTimeRegister")
       .staticmethod("Instance");